@@ -0,0 +1,240 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+
+using namespace SST::Core;
+
+constexpr char     BinaryConfigGraphOutput::magic[8];
+constexpr uint32_t BinaryConfigGraphOutput::version;
+
+namespace {
+
+// Number of links or components in each record
+const size_t record_batch = 10000;
+
+void
+deleteComponent(SST::ConfigComponent* comp)
+{
+    for ( SST::ConfigComponent* sub : comp->subComponents ) {
+        deleteComponent(sub);
+    }
+    delete comp;
+}
+
+} // namespace
+
+BinaryConfigGraphOutput::BinaryConfigGraphOutput(const char* path) : ConfigGraphOutput(path), path(path) {}
+
+void
+BinaryConfigGraphOutput::write(const void* data, size_t size, size_t count)
+{
+    if ( fwrite(data, size, count, outputFile) != count ) fail("writing");
+}
+
+uint64_t
+BinaryConfigGraphOutput::tell()
+{
+    long offset = tell();
+    if ( offset < 0 ) fail("getting the position in");
+    return offset;
+}
+
+void
+BinaryConfigGraphOutput::seek(uint64_t offset)
+{
+    if ( fseek(outputFile, offset, SEEK_SET) != 0 ) fail("seeking in");
+}
+
+void
+BinaryConfigGraphOutput::fail(const char* what)
+{
+    Output::getDefaultObject().fatal(
+        CALL_INFO, 1, "Problem %s binary graph file %s - %s\n", what, path.c_str(), strerror(errno));
+}
+
+void
+BinaryConfigGraphOutput::writeRecord(const std::function<void(SST::Core::Serialization::serializer&)>& pack)
+{
+    SST::Core::Serialization::serializer ser;
+
+    ser.start_sizing();
+    pack(ser);
+    uint64_t size = ser.size();
+
+    buffer.resize(size);
+    ser.start_packing(buffer.data(), size);
+    pack(ser);
+
+    write(&size, sizeof(size), 1);
+    write(buffer.data(), 1, size);
+}
+
+void
+BinaryConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
+{
+    if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
+
+    ConfigComponentMap_t& comps     = graph->getComponentMap();
+    ConfigLinkMap_t&      links     = graph->getLinkMap();
+    uint32_t              num_ranks = cfg->num_ranks();
+
+    Header header;
+    memcpy(header.magic, magic, sizeof(magic));
+    header.version   = version;
+    header.num_ranks = num_ranks;
+
+    // The index is filled in once the sections are written
+    std::vector<Section> index(num_ranks + 1);
+    write(&header, sizeof(header), 1);
+    write(index.data(), sizeof(Section), index.size());
+
+    // Section 0: program options and parameter globals.  The ranks
+    // are already assigned, so the graph is not partitioned again.
+    index[0].offset = tell();
+
+    std::vector<std::pair<std::string, std::string>> options = {
+        { "verbose", std::to_string(cfg->verbose()) },
+        { "stop-at", cfg->stop_at() },
+        { "print-timing-info", cfg->print_timing() ? "true" : "false" },
+        { "heartbeat-period", cfg->heartbeatPeriod() },
+        { "timebase", cfg->timeBase() },
+        { "partitioner", "sst.self" },
+        { "timeVortex", cfg->timeVortex() },
+        { "interthread-links", cfg->interthread_links() ? "true" : "false" },
+        { "output-prefix-core", cfg->output_core_prefix() },
+        { "num-threads", std::to_string(cfg->num_threads()) },
+    };
+    writeRecord([&](SST::Core::Serialization::serializer& ser) { ser& options; });
+    writeRecord([](SST::Core::Serialization::serializer& ser) { serializeParamsGlobals(ser); });
+
+    index[0].size = tell() - index[0].offset;
+
+    // Sort the components and links by rank in one pass over the
+    // graph.  Links that cross ranks go in both sections, along with
+    // the component on the other side.
+    std::vector<std::vector<ComponentId_t>> local(num_ranks);
+    std::vector<std::vector<ComponentId_t>> remote(num_ranks);
+    std::vector<std::vector<LinkId_t>>      rank_links(num_ranks);
+
+    for ( ConfigComponent* comp : comps ) {
+        local[comp->rank.rank].push_back(comp->id);
+    }
+    for ( ConfigLink* link : links ) {
+        ComponentId_t id0   = COMPONENT_ID_MASK(link->component[0]);
+        ComponentId_t id1   = COMPONENT_ID_MASK(link->component[1]);
+        uint32_t      rank0 = comps[id0]->rank.rank;
+        uint32_t      rank1 = comps[id1]->rank.rank;
+
+        rank_links[rank0].push_back(link->id);
+        if ( rank0 == rank1 ) continue;
+        rank_links[rank1].push_back(link->id);
+        remote[rank0].push_back(id1);
+        remote[rank1].push_back(id0);
+    }
+
+    // Each section is laid out the way the subgraph is sent to other
+    // ranks: statistic configuration and counts, then the links and
+    // components in id order
+    for ( uint32_t r = 0; r < num_ranks; r++ ) {
+        index[r + 1].offset = tell();
+
+        std::sort(remote[r].begin(), remote[r].end());
+        remote[r].erase(std::unique(remote[r].begin(), remote[r].end()), remote[r].end());
+
+        std::vector<ComponentId_t> ids;
+        ids.reserve(local[r].size() + remote[r].size());
+        std::merge(local[r].begin(), local[r].end(), remote[r].begin(), remote[r].end(), std::back_inserter(ids));
+        std::vector<ComponentId_t>().swap(local[r]);
+        std::vector<ComponentId_t>().swap(remote[r]);
+
+        // Only the StatGroups that reference a component in this section
+        std::map<std::string, ConfigStatGroup> stat_groups;
+        for ( auto& kv : graph->getStatGroups() ) {
+            for ( auto& id : kv.second.components ) {
+                if ( std::binary_search(ids.begin(), ids.end(), id) ) {
+                    stat_groups.insert(kv);
+                    break;
+                }
+            }
+        }
+
+        uint8_t                       load_level = graph->getStatLoadLevel();
+        std::pair<uint64_t, uint64_t> counts(rank_links[r].size(), ids.size());
+        writeRecord([&](SST::Core::Serialization::serializer& ser) {
+            ser& graph->getStatOutputs();
+            ser& load_level;
+            ser& stat_groups;
+            ser& counts;
+        });
+
+        std::vector<ConfigLink*> link_batch;
+        for ( size_t i = 0; i < rank_links[r].size(); ) {
+            for ( ; i < rank_links[r].size() && link_batch.size() < record_batch; ++i ) {
+                link_batch.push_back(links[rank_links[r][i]]);
+            }
+            writeRecord([&](SST::Core::Serialization::serializer& ser) { ser& link_batch; });
+            link_batch.clear();
+        }
+        std::vector<LinkId_t>().swap(rank_links[r]);
+
+        // Components of other ranks are written without parameters
+        // and with only the links to this rank
+        std::vector<ConfigComponent*> comp_batch;
+        std::vector<ConfigComponent*> remote_comps;
+        for ( size_t i = 0; i < ids.size(); ) {
+            for ( ; i < ids.size() && comp_batch.size() < record_batch; ++i ) {
+                ConfigComponent* comp = comps[ids[i]];
+                if ( comp->rank.rank == r ) {
+                    comp_batch.push_back(comp);
+                    continue;
+                }
+
+                ConfigComponent* copy = comp->cloneWithoutLinksOrParams(graph);
+                for ( LinkId_t l : comp->allLinks() ) {
+                    const ConfigLink* link = links[l];
+                    int               end  = COMPONENT_ID_MASK(link->component[0]) == comp->id ? 0 : 1;
+                    if ( comps[COMPONENT_ID_MASK(link->component[1 - end])]->rank.rank != r ) continue;
+                    copy->findSubComponent(link->component[end])->links.push_back(l);
+                }
+                comp_batch.push_back(copy);
+                remote_comps.push_back(copy);
+            }
+            writeRecord([&](SST::Core::Serialization::serializer& ser) { ser& comp_batch; });
+            comp_batch.clear();
+
+            for ( ConfigComponent* copy : remote_comps ) {
+                deleteComponent(copy);
+            }
+            remote_comps.clear();
+        }
+
+        index[r + 1].size = tell() - index[r + 1].offset;
+    }
+
+    seek(sizeof(header));
+    write(index.data(), sizeof(Section), index.size());
+    if ( fflush(outputFile) != 0 ) fail("writing");
+}
@@ -0,0 +1,80 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_BINARY_CONFIG_OUTPUT_H
+#define SST_CORE_BINARY_CONFIG_OUTPUT_H
+
+#include "sst/core/configGraph.h"
+#include "sst/core/configGraphOutput.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Core {
+
+/**
+   Writes a partitioned ConfigGraph in a binary format that loads
+   without rebuilding or repartitioning the graph.
+
+   The file starts with a Header followed by num_ranks + 1 Section
+   entries.  Section 0 holds the program options and the parameter
+   key map and global param sets, which every rank reads.  Section
+   r + 1 holds the subgraph of rank r, including the components of
+   other ranks that its links connect to, so each rank only reads its
+   own section.  Sections are a sequence of records, each of which is
+   a uint64_t size followed by that many bytes packed with the SST
+   serializer.  Everything is written in the byte order of the
+   machine that wrote the file.
+ */
+class BinaryConfigGraphOutput : public ConfigGraphOutput
+{
+public:
+    /** Marks the start of a binary graph file */
+    static constexpr char magic[8] = { 'S', 'S', 'T', 'G', 'R', 'A', 'P', 'H' };
+
+    /** Incremented whenever the layout of the file changes */
+    static constexpr uint32_t version = 1;
+
+    struct Header
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t num_ranks;
+    };
+
+    struct Section
+    {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    BinaryConfigGraphOutput(const char* path);
+    virtual void generate(const Config* cfg, ConfigGraph* graph) override;
+
+private:
+    void writeRecord(const std::function<void(SST::Core::Serialization::serializer&)>& pack);
+
+    // Checked wrappers for the file calls, which fatal on an error
+    void     write(const void* data, size_t size, size_t count);
+    uint64_t tell();
+    void     seek(uint64_t offset);
+    void     fail(const char* what);
+
+    std::string       path;
+    std::vector<char> buffer;
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_BINARY_CONFIG_OUTPUT_H
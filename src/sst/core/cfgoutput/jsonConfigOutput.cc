@@ -18,11 +18,15 @@
 #include "sst/core/configGraph.h"
 #include "sst/core/configGraphOutput.h"
 #include "sst/core/params.h"
+#include "sst/core/threadsafe.h"
 
 #include "nlohmann/json.hpp"
 
+#include <algorithm>
 #include <map>
-#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace SST::Core;
 namespace json = ::nlohmann;
@@ -75,6 +79,10 @@ to_json(json::ordered_json& j, SubCompWrapper const& comp_wrapper)
         j["params"][paramsItr] = comp->params.find<std::string>(paramsItr);
     }
 
+    for ( auto const& id : comp->getParamTemplates() ) {
+        j["param_templates"].push_back(id);
+    }
+
     for ( auto const& paramsItr : comp->getSubscribedGlobalParamSets() ) {
         j["params_global_sets"].push_back(paramsItr);
     }
@@ -98,6 +106,10 @@ to_json(json::ordered_json& j, CompWrapper const& comp_wrapper)
         j["params"][paramsItr] = comp->params.find<std::string>(paramsItr);
     }
 
+    for ( auto const& id : comp->getParamTemplates() ) {
+        j["param_templates"].push_back(id);
+    }
+
     for ( auto const& paramsItr : comp->getSubscribedGlobalParamSets() ) {
         j["params_global_sets"].push_back(paramsItr);
     }
@@ -136,6 +148,77 @@ to_json(json::ordered_json& j, LinkConfPair const& pair)
     j["right"]["latency"]   = link->latency_str[1];
 }
 
+// Number of elements each thread formats at a time
+const size_t format_block = 1000;
+
+// Appends an element of a top level array, indented to its depth
+void
+appendElement(std::string& out, const std::string& element)
+{
+    out.append("    ");
+    for ( char c : element ) {
+        out.push_back(c);
+        if ( c == '\n' ) out.append("    ");
+    }
+}
+
+// Writes the elements of map as the value of a top level key.  The
+// elements are formatted in rounds by a pool of threads, each of which
+// formats one block into its own buffer.  The calling thread takes part
+// as thread 0 and writes the buffers in order at the end of each round.
+template <typename MapT, typename WrapT>
+void
+writeArray(FILE* file, const char* key, MapT& map, WrapT wrap, bool last, size_t num_threads)
+{
+    fprintf(file, "  \"%s\": ", key);
+
+    const size_t count = map.size();
+    if ( count == 0 ) { fprintf(file, "null"); }
+    else {
+        fprintf(file, "[\n");
+
+        num_threads = std::max<size_t>(1, std::min(num_threads, (count + format_block - 1) / format_block));
+
+        std::vector<std::string>       buffers(num_threads);
+        SST::Core::ThreadSafe::Barrier formatted(num_threads);
+        SST::Core::ThreadSafe::Barrier written(num_threads);
+
+        auto worker = [&](size_t t) {
+            for ( size_t start = 0; start < count; start += num_threads * format_block ) {
+                std::string& out = buffers[t];
+                out.clear();
+                size_t first = std::min(start + t * format_block, count);
+                size_t end   = std::min(first + format_block, count);
+                for ( size_t i = first; i < end; i++ ) {
+                    if ( i != 0 ) out.append(",\n");
+                    json::ordered_json j = wrap(*(map.begin() + i));
+                    appendElement(out, j.dump(2));
+                }
+
+                formatted.wait();
+                if ( t == 0 ) {
+                    for ( auto& buffer : buffers ) {
+                        fwrite(buffer.data(), 1, buffer.size(), file);
+                    }
+                }
+                written.wait();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for ( size_t t = 1; t < num_threads; t++ ) {
+            pool.emplace_back(worker, t);
+        }
+        worker(0);
+        for ( auto& thread : pool ) {
+            thread.join();
+        }
+
+        fprintf(file, "\n  ]");
+    }
+    fprintf(file, last ? "\n" : ",\n");
+}
+
 } // namespace
 
 void
@@ -143,8 +226,8 @@ JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
 {
     if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
 
-    const auto& compMap = graph->getComponentMap();
-    const auto& linkMap = graph->getLinkMap();
+    auto& compMap = graph->getComponentMap();
+    auto& linkMap = graph->getLinkMap();
 
     json::ordered_json outputJson;
 
@@ -168,25 +251,34 @@ JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
         }
     }
 
-    // no components exist in this rank
-    if ( const_cast<ConfigComponentMap_t&>(compMap).size() == 0 ) { outputJson["components"]; }
-
-    for ( const auto& compItr : compMap ) {
-        outputJson["components"].emplace_back(CompWrapper { compItr, cfg->output_partition() });
+    // Put in the parameter templates, which components refer to by
+    // their index in the list
+    for ( uint32_t id = 0; id < getNumParamTemplates(); id++ ) {
+        json::ordered_json& tmpl = outputJson["param_templates"][id];
+        tmpl                     = json::ordered_json::object();
+        for ( const auto& kvp : getParamTemplate(id) ) {
+            tmpl[kvp.first] = kvp.second;
+        }
     }
 
-    // no links exist in this rank
-    if ( const_cast<ConfigLinkMap_t&>(linkMap).size() == 0 ) { outputJson["links"]; }
-
-    for ( const auto& linkItr : linkMap ) {
-        outputJson["links"].push_back(LinkConfPair { linkItr, graph });
+    // Write everything but the closing brace of the top level object,
+    // then stream the components and links into it
+    std::string head = outputJson.dump(2);
+    if ( head.size() < 2 || head.compare(head.size() - 2, 2, "\n}") != 0 ) {
+        throw ConfigGraphOutputException("Unexpected end of the JSON program options");
     }
-
-    std::stringstream ss;
-    ss << std::setw(2) << outputJson << std::endl;
-
-    // Avoid lifetime issues, I don't think it's a big deal in this case due to
-    // lifetime extension, but this temp is the careful way.
-    std::string outputString = ss.str();
-    fprintf(outputFile, "%s", outputString.c_str());
+    head.erase(head.size() - 2);
+    fprintf(outputFile, "%s,\n", head.c_str());
+
+    bool   output_partition = cfg->output_partition();
+    size_t num_threads      = cfg->num_threads();
+    writeArray(
+        outputFile, "components", compMap,
+        [output_partition](const SST::ConfigComponent* comp) { return CompWrapper { comp, output_partition }; }, false,
+        num_threads);
+    writeArray(
+        outputFile, "links", linkMap, [graph](const SST::ConfigLink* link) { return LinkConfPair { link, graph }; }, true,
+        num_threads);
+
+    fprintf(outputFile, "}\n");
 }
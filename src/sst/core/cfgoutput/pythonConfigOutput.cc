@@ -73,19 +73,25 @@ PythonConfigGraphOutput::generateCommonComponent(const char* objName, const Conf
         fprintf(outputFile, "%s.addParams(", objName);
         generateParams(comp->params);
         fprintf(outputFile, ")\n");
+        // Add parameter templates
+        for ( auto id : getParamTemplates(comp->params) ) {
+            fprintf(outputFile, "%s.addParamTemplate(param_template_%" PRIu32 ")\n", objName, id);
+        }
         // Add global param sets
         for ( auto x : getSubscribedGlobalParamSets(comp->params) ) {
             fprintf(outputFile, "%s.addGlobalParamSet(\"%s\")\n", objName, x.c_str());
         }
     }
 
-    fprintf(outputFile, "%s.setCoordinates(", objName);
-    bool first = true;
-    for ( double d : comp->coords ) {
-        fprintf(outputFile, first ? "%lg" : ", %lg", d);
-        first = false;
+    if ( comp->coordsSet ) {
+        fprintf(outputFile, "%s.setCoordinates(", objName);
+        bool first = true;
+        for ( double d : comp->coords ) {
+            fprintf(outputFile, first ? "%lg" : ", %lg", d);
+            first = false;
+        }
+        fprintf(outputFile, ")\n");
     }
-    fprintf(outputFile, ")\n");
 
     for ( auto& pair : comp->enabledStatNames ) {
         auto& name       = pair.first;
@@ -254,6 +260,28 @@ PythonConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
     }
     fprintf(outputFile, "\n");
 
+    // Output the parameter templates
+    if ( getNumParamTemplates() > 0 ) {
+        fprintf(outputFile, "# Define the parameter templates:\n");
+        for ( uint32_t id = 0; id < getNumParamTemplates(); id++ ) {
+            fprintf(outputFile, "param_template_%" PRIu32 " = sst.createParamTemplate({\n", id);
+            for ( auto y : getParamTemplate(id) ) {
+                char* esParamName = makeEscapeSafe(y.first.c_str());
+                char* esValue     = makeEscapeSafe(y.second.c_str());
+                if ( isMultiLine(esValue) ) {
+                    fprintf(outputFile, "    \"%s\" : \"\"\"%s\"\"\",\n", esParamName, esValue);
+                }
+                else {
+                    fprintf(outputFile, "    \"%s\" : \"%s\",\n", esParamName, esValue);
+                }
+                free(esParamName);
+                free(esValue);
+            }
+            fprintf(outputFile, "})\n");
+        }
+        fprintf(outputFile, "\n");
+    }
+
     // Output the graph
     fprintf(outputFile, "# Define the SST Components:\n");
 
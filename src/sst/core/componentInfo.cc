@@ -226,6 +226,10 @@ ComponentInfo::findSubComponent(ComponentId_t id)
     /* Check to make sure we're part of the same component */
     if ( COMPONENT_ID_MASK(id) != COMPONENT_ID_MASK(this->id) ) return nullptr;
 
+    /* Check our direct children before searching the whole tree */
+    auto child = subComponents.find(id);
+    if ( child != subComponents.end() ) return &child->second;
+
     for ( auto& s : subComponents ) {
         ComponentInfo* found = s.second.findSubComponent(id);
         if ( found != nullptr ) return found;
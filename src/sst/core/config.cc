@@ -158,6 +158,28 @@ public:
         return 0;
     }
 
+    // thread partitioner
+    static int setThreadPartitioner(Config* cfg, const std::string& arg)
+    {
+        cfg->thread_partitioner_ = arg;
+        if ( !arg.empty() && arg.find('.') == arg.npos ) { cfg->thread_partitioner_ = "sst." + arg; }
+        return 0;
+    }
+
+    // partitioner cost file
+    static int setPartitionerCostFile(Config* cfg, const std::string& arg)
+    {
+        cfg->partitioner_cost_file_ = arg;
+        return 0;
+    }
+
+    // partitioner params
+    static int setPartitionerParams(Config* cfg, const std::string& arg)
+    {
+        cfg->partitioner_params_ = arg;
+        return 0;
+    }
+
     // heart beat
     static int setHeartbeat(Config* cfg, const std::string& arg)
     {
@@ -197,6 +219,13 @@ public:
         return 0;
     }
 
+    // output partitioned graph
+    static int setWriteGraph(Config* cfg, const std::string& arg)
+    {
+        cfg->output_graph_ = arg;
+        return 0;
+    }
+
     // parallel output
 #ifdef SST_CONFIG_HAVE_MPI
     static int enableParallelOutput(Config* cfg, const std::string& arg)
@@ -327,6 +356,19 @@ public:
         return success ? 0 : -1;
     }
 
+    // node shared arrays
+    static int setNodeSharedArrays(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->node_shared_arrays_ = true;
+            return 0;
+        }
+
+        bool success             = false;
+        cfg->node_shared_arrays_ = cfg->parseBoolean(arg, success, "node-shared-arrays");
+        return success ? 0 : -1;
+    }
+
 #ifdef USE_MEMPOOL
     // cache align mempool allocations
     static int setCacheAlignMempools(Config* cfg, const std::string& arg)
@@ -413,6 +455,12 @@ public:
             "  --enable-profiling=\"events:sst.profile.handler.event.time.high_resolution(level=component)[event]\"\n");
         msg.append("  --enable-profiling=\"clocks:sst.profile.handler.clock.count(level=subcomponent)[clock]\"\n");
         msg.append("  --enable-profiling=sync:sst.profile.sync.time.steady[sync]\n");
+        msg.append("\n");
+        msg.append("The cost profilers record measured work per component and events per port.  Their output can be "
+                   "used to partition the next run with --partitioner=sst.profiled:\n");
+        msg.append("  --enable-profiling=\"events:sst.profile.handler.event.cost[event];"
+                   "clocks:sst.profile.handler.clock.cost[clock]\" --profiling-output=costs.txt\n");
+        msg.append("  --partitioner=sst.profiled --partitioner-cost-file=costs.txt\n");
         return msg;
     }
 
@@ -477,11 +525,15 @@ Config::print()
     std::cout << "stop_at = " << stop_at_ << std::endl;
     std::cout << "exit_after = " << exit_after_ << std::endl;
     std::cout << "partitioner = " << partitioner_ << std::endl;
+    std::cout << "thread_partitioner = " << thread_partitioner_ << std::endl;
+    std::cout << "partitioner_cost_file = " << partitioner_cost_file_ << std::endl;
+    std::cout << "partitioner_params = " << partitioner_params_ << std::endl;
     std::cout << "heartbeatPeriod = " << heartbeatPeriod_ << std::endl;
     std::cout << "output_directory = " << output_directory_ << std::endl;
     std::cout << "output_core_prefix = " << output_core_prefix_ << std::endl;
     std::cout << "output_config_graph = " << output_config_graph_ << std::endl;
     std::cout << "output_json = " << output_json_ << std::endl;
+    std::cout << "output_graph = " << output_graph_ << std::endl;
     std::cout << "parallel_output = " << parallel_output_ << std::endl;
     std::cout << "output_dot = " << output_dot_ << std::endl;
     std::cout << "dot_verbosity = " << dot_verbosity_ << std::endl;
@@ -491,6 +543,7 @@ Config::print()
     std::cout << "parallel_load = " << parallel_load_ << std::endl;
     std::cout << "timeVortex = " << timeVortex_ << std::endl;
     std::cout << "interthread_links = " << interthread_links_ << std::endl;
+    std::cout << "node_shared_arrays = " << node_shared_arrays_ << std::endl;
 #ifdef USE_MEMPOOL
     std::cout << "cache_align_mempools = " << cache_align_mempools_ << std::endl;
 #endif
@@ -535,15 +588,18 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     // Basic Options
     first_rank_ = first_rank;
 
-    num_ranks_       = num_ranks;
-    num_threads_     = 1;
-    configFile_      = "NONE";
-    model_options_   = "";
-    print_timing_    = false;
-    stop_at_         = "0 ns";
-    exit_after_      = 0;
-    partitioner_     = "sst.linear";
-    heartbeatPeriod_ = "";
+    num_ranks_             = num_ranks;
+    num_threads_           = 1;
+    configFile_            = "NONE";
+    model_options_         = "";
+    print_timing_          = false;
+    stop_at_               = "0 ns";
+    exit_after_            = 0;
+    partitioner_           = "sst.linear";
+    thread_partitioner_    = "";
+    partitioner_cost_file_ = "";
+    partitioner_params_    = "";
+    heartbeatPeriod_       = "";
 
     char* wd_buf = (char*)malloc(sizeof(char) * PATH_MAX);
     getcwd(wd_buf, PATH_MAX);
@@ -560,6 +616,7 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
 
     output_config_graph_ = "";
     output_json_         = "";
+    output_graph_        = "";
     parallel_output_     = false;
 
     // Graph output
@@ -574,6 +631,7 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     parallel_load_mode_multi_ = true;
     timeVortex_               = "sst.timevortex.priority_queue";
     interthread_links_        = false;
+    node_shared_arrays_       = false;
 #ifdef USE_MEMPOOL
     cache_align_mempools_ = false;
 #endif
@@ -670,6 +728,21 @@ Config::insertOptions()
     DEF_ARG(
         "partitioner", 0, "PARTITIONER", "Select the partitioner to be used. <lib.partitionerName>",
         std::bind(&ConfigHelper::setPartitioner, this, _1), true);
+    DEF_ARG(
+        "thread-partitioner", 0, "PARTITIONER",
+        "Select a partitioner to split each rank's components across its threads.  When set, --partitioner only "
+        "partitions across ranks (two-level partitioning). <lib.partitionerName>",
+        std::bind(&ConfigHelper::setThreadPartitioner, this, _1), true);
+    DEF_ARG(
+        "partitioner-cost-file", 0, "FILE",
+        "File with measured component and port costs, written by the cost profiling tools, for use by partitioners "
+        "that support it (e.g. sst.profiled)",
+        std::bind(&ConfigHelper::setPartitionerCostFile, this, _1), true);
+    DEF_ARG(
+        "partitioner-params", 0, "PARAMS",
+        "Comma separated list of key=value tuning parameters for partitioners that support them (e.g. "
+        "imbalance=0.05 for sst.multilevel)",
+        std::bind(&ConfigHelper::setPartitionerParams, this, _1), true);
     DEF_ARG(
         "heartbeat-period", 0, "PERIOD",
         "Set time for heartbeats to be published (these are approximate timings, published by the core, to update on "
@@ -691,6 +764,11 @@ Config::insertOptions()
     DEF_ARG(
         "output-json", 0, "FILE", "File to write SST configuration graph (in JSON format)",
         std::bind(&ConfigHelper::setWriteJSON, this, _1), true);
+    DEF_ARG(
+        "output-graph", 0, "FILE",
+        "File to write the partitioned SST configuration graph (in binary format).  The file can be used as input to "
+        "skip building and partitioning the graph on a job with the same number of ranks.",
+        std::bind(&ConfigHelper::setWriteGraph, this, _1), true);
 #ifdef SST_CONFIG_HAVE_MPI
     DEF_FLAG_OPTVAL(
         "parallel-output", 0,
@@ -735,6 +813,12 @@ Config::insertOptions()
     DEF_FLAG_OPTVAL(
         "interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used",
         std::bind(&ConfigHelper::setInterThreadLinks, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "node-shared-arrays", 0,
+        "[EXPERIMENTAL] Once init() is complete, keep one read-only copy of each SharedArray per node, in memory "
+        "shared by the ranks on that node.  Arrays of types that are not trivially copyable are not shared.  The "
+        "element types of shared arrays must not contain pointers",
+        std::bind(&ConfigHelper::setNodeSharedArrays, this, _1), true);
 #ifdef USE_MEMPOOL
     DEF_FLAG_OPTVAL(
         "cache-align-mempools", 0, "[EXPERIMENTAL] Set whether mempool allocations are cache aligned",
@@ -840,6 +924,8 @@ Config::checkArgsAfterParsing()
 
     if ( output_json_.size() > 0 && isFileNameOnly(output_json_) ) { output_json_.insert(0, output_directory_); }
 
+    if ( output_graph_.size() > 0 && isFileNameOnly(output_graph_) ) { output_graph_.insert(0, output_directory_); }
+
     if ( debugFile_.size() > 0 && isFileNameOnly(debugFile_) ) { debugFile_.insert(0, output_directory_); }
     return 0;
 }
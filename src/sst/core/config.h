@@ -131,6 +131,24 @@ public:
     */
     const std::string& partitioner() const { return partitioner_; }
 
+    /**
+       Partitioner to use to split each rank across its threads.  If
+       set, partitioner() is only used across ranks.
+    */
+    const std::string& threadPartitioner() const { return thread_partitioner_; }
+
+    /**
+       File with measured costs from a profiled run, used by
+       partitioners that support it
+    */
+    const std::string& partitionerCostFile() const { return partitioner_cost_file_; }
+
+    /**
+       Tuning parameters for the partitioner, as a comma separated
+       list of key=value pairs
+    */
+    const std::string& partitionerParams() const { return partitioner_params_; }
+
     /**
        Simulation period at which to print out a "heartbeat" message
     */
@@ -160,6 +178,12 @@ public:
     */
     const std::string& output_json() const { return output_json_; }
 
+    /**
+       File to output the partitioned config graph to in binary format
+       (empty string means no output)
+    */
+    const std::string& output_graph() const { return output_graph_; }
+
     /**
        If true, and a config graph output option is specified, write
        each ranks graph separately
@@ -236,6 +260,12 @@ public:
     */
     bool interthread_links() const { return interthread_links_; }
 
+    /**
+       Share the data of SharedArrays between the ranks on a node
+       after init
+    */
+    bool node_shared_arrays() const { return node_shared_arrays_; }
+
 #ifdef USE_MEMPOOL
     /**
        Controls whether mempool items are cache-aligned
@@ -360,12 +390,16 @@ public:
         ser& stop_at_;
         ser& exit_after_;
         ser& partitioner_;
+        ser& thread_partitioner_;
+        ser& partitioner_cost_file_;
+        ser& partitioner_params_;
         ser& heartbeatPeriod_;
         ser& output_directory_;
         ser& output_core_prefix_;
 
         ser& output_config_graph_;
         ser& output_json_;
+        ser& output_graph_;
         ser& parallel_output_;
 
         ser& output_dot_;
@@ -378,6 +412,7 @@ public:
         ser& parallel_load_mode_multi_;
         ser& timeVortex_;
         ser& interthread_links_;
+        ser& node_shared_arrays_;
 #ifdef USE_MEMPOOL
         ser& cache_align_mempools_;
 #endif
@@ -436,21 +471,25 @@ private:
     // Basic options
     // uint32_t    verbose_; ** in ConfigShared
     // Num threads held in RankInfo.thread
-    uint32_t    num_ranks_;          /*!< Number of ranks in the simulation */
-    uint32_t    num_threads_;        /*!< Number of threads requested */
-    std::string configFile_;         /*!< Graph generation file */
-    std::string model_options_;      /*!< Options to pass to Python Model generator */
-    bool        print_timing_;       /*!< Print SST timing information */
-    std::string stop_at_;            /*!< When to stop the simulation */
-    uint32_t    exit_after_;         /*!< When (wall-time) to stop the simulation */
-    std::string partitioner_;        /*!< Partitioner to use */
-    std::string heartbeatPeriod_;    /*!< Sets the heartbeat period for the simulation */
-    std::string output_directory_;   /*!< Output directory to dump all files to */
-    std::string output_core_prefix_; /*!< Set the SST::Output prefix for the core */
+    uint32_t    num_ranks_;             /*!< Number of ranks in the simulation */
+    uint32_t    num_threads_;           /*!< Number of threads requested */
+    std::string configFile_;            /*!< Graph generation file */
+    std::string model_options_;         /*!< Options to pass to Python Model generator */
+    bool        print_timing_;          /*!< Print SST timing information */
+    std::string stop_at_;               /*!< When to stop the simulation */
+    uint32_t    exit_after_;            /*!< When (wall-time) to stop the simulation */
+    std::string partitioner_;           /*!< Partitioner to use */
+    std::string thread_partitioner_;    /*!< Partitioner to use across threads of a rank */
+    std::string partitioner_cost_file_; /*!< Measured costs for the partitioner */
+    std::string partitioner_params_;    /*!< Tuning parameters for the partitioner */
+    std::string heartbeatPeriod_;       /*!< Sets the heartbeat period for the simulation */
+    std::string output_directory_;      /*!< Output directory to dump all files to */
+    std::string output_core_prefix_;    /*!< Set the SST::Output prefix for the core */
 
     // Configuration output
     std::string output_config_graph_; /*!< File to dump configuration graph */
     std::string output_json_;         /*!< File to dump JSON output */
+    std::string output_graph_;        /*!< File to dump binary partitioned graph */
     bool        parallel_output_;     /*!< Output simulation graph in parallel */
 
     // Graph output
@@ -465,6 +504,7 @@ private:
     bool        parallel_load_mode_multi_; /*!< If true, load using multiple files */
     std::string timeVortex_;               /*!< TimeVortex implementation to use */
     bool        interthread_links_;        /*!< Use interthread links */
+    bool        node_shared_arrays_;       /*!< Share SharedArray data between ranks on a node */
 #ifdef USE_MEMPOOL
     bool cache_align_mempools_; /*!< Cache align allocations from mempools */
 #endif
@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <fstream>
 #include <string.h>
+#include <unordered_set>
 
 using namespace std;
 
@@ -73,6 +74,36 @@ checkForValidLinkName(const std::string& name)
 
 namespace SST {
 
+// Pool of interned strings and the number of ConfigGraphs using it.
+// Elements of an unordered_set are never moved, so references to them
+// stay valid as the pool grows.
+static std::unordered_set<std::string>* intern_pool       = nullptr;
+static uint32_t                         intern_pool_users = 0;
+
+const std::string&
+InternedString::intern(const std::string& str)
+{
+    static const std::string empty;
+    if ( str.empty() ) return empty;
+
+    if ( intern_pool == nullptr ) intern_pool = new std::unordered_set<std::string>();
+    return *intern_pool->insert(str).first;
+}
+
+void
+InternedString::acquirePool()
+{
+    intern_pool_users++;
+}
+
+void
+InternedString::releasePool()
+{
+    if ( --intern_pool_users > 0 ) return;
+    delete intern_pool;
+    intern_pool = nullptr;
+}
+
 void
 ConfigLink::updateLatencies(TimeLord* timeLord)
 {
@@ -218,6 +249,7 @@ ConfigComponent::cloneWithoutLinks(ConfigGraph* new_graph) const
     ret->enabledAllStats  = enabledAllStats;
     ret->allStatConfig    = allStatConfig;
     ret->coords           = coords;
+    ret->coordsSet        = coordsSet;
     ret->nextSubID        = nextSubID;
     ret->graph            = new_graph;
     for ( auto* i : subComponents ) {
@@ -238,6 +270,7 @@ ConfigComponent::cloneWithoutLinksOrParams(ConfigGraph* new_graph) const
     ret->rank            = rank;
     ret->statLoadLevel   = statLoadLevel;
     ret->coords          = coords;
+    ret->coordsSet       = coordsSet;
     ret->nextSubID       = nextSubID;
     ret->graph           = new_graph;
     for ( auto* i : subComponents ) {
@@ -322,7 +355,8 @@ ConfigComponent::setWeight(double w)
 void
 ConfigComponent::setCoordinates(const std::vector<double>& c)
 {
-    coords = c;
+    coords    = c;
+    coordsSet = true;
     /* Maintain minimum of 3D information */
     while ( coords.size() < 3 )
         coords.push_back(0.0);
@@ -712,16 +746,26 @@ ConfigGraph::postCreationCleanup()
         link->updateLatencies(timeLord);
     }
 
+    // Links are ordered by name
+    std::vector<ConfigLink*> sorted_links(links.begin(), links.end());
+    std::sort(sorted_links.begin(), sorted_links.end(), [](const ConfigLink* a, const ConfigLink* b) {
+        return a->name < b->name;
+    });
     LinkId_t count = 1;
-    for ( auto& it : link_names ) {
-        ConfigLink* link = links[it.second];
-        link->order      = count;
+    for ( ConfigLink* link : sorted_links ) {
+        link->order = count;
         count++;
     }
 
+    // Link names are only looked up while links are being added
+    decltype(link_names)().swap(link_names);
+    link_names_released = true;
+
     /* Force component / statistic registration for Group stats */
     for ( auto& cfg : getStatGroups() ) {
         for ( ComponentId_t compID : cfg.second.components ) {
+            // A subgraph may only hold some of the group's components
+            if ( !containsComponent(COMPONENT_ID_MASK(compID)) ) continue;
             ConfigComponent* ccomp = findComponent(compID);
             if ( ccomp ) { /* Should always be true */
                 for ( auto& kv : cfg.second.statMap ) {
@@ -735,7 +779,7 @@ ConfigGraph::postCreationCleanup()
 // Checks for errors that can't be easily detected during the build
 // process
 bool
-ConfigGraph::checkForStructuralErrors()
+ConfigGraph::checkForStructuralErrors(uint32_t rank)
 {
     // Check to make sure there are no dangling links.  A dangling
     // link is found by looking though the links in the graph and
@@ -766,6 +810,7 @@ ConfigGraph::checkForStructuralErrors()
     // Loop over all the Components
     for ( ConfigComponentMap_t::iterator iter = comps.begin(); iter != comps.end(); ++iter ) {
         ConfigComponent* ccomp = *iter;
+        if ( rank != UINT32_MAX && ccomp->rank.rank != rank ) continue;
         ccomp->checkPorts();
     }
 
@@ -777,7 +822,7 @@ ConfigGraph::addComponent(const std::string& name, const std::string& type)
 {
     checkForValidComponentName(name);
     ComponentId_t cid = nextComponentId++;
-    comps.insert(new ConfigComponent(cid, this, name, type, 1.0f, RankInfo()));
+    ConfigComponent* comp = comps.insert(new ConfigComponent(cid, this, name, type, 1.0f, RankInfo()));
 
     auto ret = compsByName.insert(std::make_pair(name, cid));
     // Check to see if the name has already been used
@@ -787,6 +832,28 @@ ConfigGraph::addComponent(const std::string& name, const std::string& type)
     return cid;
 }
 
+void
+ConfigGraph::addRemoteComponents(const std::vector<RemoteComponent>& remote)
+{
+    if ( remote.empty() ) return;
+
+    // Inserting out of order into the SparseVectorMap is slow, so
+    // rebuild it in one pass
+    std::vector<ConfigComponent*> all(comps.begin(), comps.end());
+    all.reserve(all.size() + remote.size());
+    for ( auto& r : remote ) {
+        ConfigComponent* comp = new ConfigComponent(r.id, this, r.name, r.type, 1.0f, r.rank);
+        all.push_back(comp);
+
+        auto ret = compsByName.insert(std::make_pair(r.name, r.id));
+        if ( !ret.second ) {
+            output.fatal(
+                CALL_INFO, 1, "ERROR: trying to add Component with name that already exists: %s\n", r.name.c_str());
+        }
+    }
+    comps = ConfigComponentMap_t(all);
+}
+
 void
 ConfigGraph::addGlobalParam(const std::string& global_set, const std::string& key, const std::string& value)
 {
@@ -822,6 +889,7 @@ ConfigGraph::addLink(
     ComponentId_t comp_id, const std::string& link_name, const std::string& port, const std::string& latency_str,
     bool no_cut)
 {
+    checkLinkNamesAvailable("addLink");
     checkForValidLinkName(link_name);
 
     // If the link already exists, it just gets it out of the links
@@ -831,9 +899,14 @@ ConfigGraph::addLink(
     // returns a reference to the newly inserted link.
     auto link_name_it = link_names.find(link_name);
 
-    ConfigLink* link = (link_name_it == link_names.end())
-                           ? links.insert(new ConfigLink(link_names[link_name] = links.size(), link_name))
-                           : links[link_name_it->second];
+    ConfigLink* link;
+    if ( link_name_it == link_names.end() ) {
+        link = links.insert(new ConfigLink(links.size(), link_name));
+        link_names.emplace(link->name, link->id);
+    }
+    else {
+        link = links[link_name_it->second];
+    }
 
     // Check to make sure the link has not been referenced too many
     // times.
@@ -865,13 +938,32 @@ ConfigGraph::addLink(
 void
 ConfigGraph::setLinkNoCut(const std::string& link_name)
 {
+    checkLinkNamesAvailable("setLinkNoCut");
+
     // If link doesn't exist, return
-    if ( link_names.find(link_name) == link_names.end() ) return;
+    auto link_name_it = link_names.find(link_name);
+    if ( link_name_it == link_names.end() ) return;
 
-    ConfigLink* link = links[link_names[link_name]];
+    ConfigLink* link = links[link_name_it->second];
     link->no_cut     = true;
 }
 
+bool
+ConfigGraph::containsLink(const std::string& link_name) const
+{
+    checkLinkNamesAvailable("containsLink");
+    return link_names.count(link_name) != 0;
+}
+
+void
+ConfigGraph::checkLinkNamesAvailable(const char* caller) const
+{
+    if ( !link_names_released ) return;
+    output.fatal(
+        CALL_INFO, 1, "ERROR: ConfigGraph::%s() called after the link names were released by postCreationCleanup()\n",
+        caller);
+}
+
 bool
 ConfigGraph::containsComponent(ComponentId_t id) const
 {
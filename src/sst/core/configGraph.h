@@ -25,7 +25,9 @@
 
 #include <climits>
 #include <map>
+#include <ostream>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 using namespace SST::Statistics;
@@ -41,16 +43,96 @@ class ConfigGraph;
 typedef SparseVectorMap<ComponentId_t> ComponentIdMap_t;
 typedef std::vector<LinkId_t>          LinkIdMap_t;
 
+/**
+   Handle to a string held in a pool of interned strings.  Component
+   types, port names and latencies repeat across most of the components
+   and links of a large graph, so they are stored once in the pool and
+   each component or link only holds a pointer.  The pool is shared by
+   the ConfigGraphs of the process and is released when the last of
+   them is deleted, so an InternedString must not be used after that.
+   Graphs are only built, split and serialized by the main thread, so
+   the pool is not locked.  Serializes as a std::string.
+ */
+class InternedString
+{
+public:
+    InternedString() : value(&intern(std::string())) {}
+    InternedString(const std::string& str) : value(&intern(str)) {}
+    InternedString(const char* str) : value(&intern(str)) {}
+
+    InternedString& operator=(const std::string& str)
+    {
+        value = &intern(str);
+        return *this;
+    }
+
+    operator const std::string&() const { return *value; }
+
+    const std::string& str() const { return *value; }
+    const char*        c_str() const { return value->c_str(); }
+    bool               empty() const { return value->empty(); }
+    size_t             size() const { return value->size(); }
+
+    bool operator==(const InternedString& other) const { return value == other.value; }
+    bool operator!=(const InternedString& other) const { return value != other.value; }
+
+    friend bool operator==(const InternedString& a, const std::string& b) { return *a.value == b; }
+    friend bool operator==(const std::string& a, const InternedString& b) { return a == *b.value; }
+    friend bool operator==(const InternedString& a, const char* b) { return *a.value == b; }
+    friend bool operator!=(const InternedString& a, const std::string& b) { return *a.value != b; }
+    friend bool operator!=(const std::string& a, const InternedString& b) { return a != *b.value; }
+    friend bool operator!=(const InternedString& a, const char* b) { return *a.value != b; }
+
+    friend std::ostream& operator<<(std::ostream& os, const InternedString& str) { return os << *str.value; }
+
+private:
+    friend class ConfigGraph;
+
+    const std::string* value;
+
+    /** Returns the pooled copy of str, adding it to the pool if needed */
+    static const std::string& intern(const std::string& str);
+
+    /** Called by each ConfigGraph as it is created and deleted.  The
+     * pool is released when the last graph is deleted. */
+    static void acquirePool();
+    static void releasePool();
+};
+
+} // namespace SST
+
+namespace SST {
+namespace Core {
+namespace Serialization {
+
+template <>
+class serialize<SST::InternedString>
+{
+public:
+    void operator()(SST::InternedString& str, SST::Core::Serialization::serializer& ser)
+    {
+        // Sent as the string itself and re-interned on unpack
+        std::string value = str;
+        ser.string(value);
+        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) str = value;
+    }
+};
+} // namespace Serialization
+} // namespace Core
+} // namespace SST
+
+namespace SST {
+
 /** Represents the configuration of a generic Link */
 class ConfigLink : public SST::Core::Serialization::serializable
 {
 public:
-    LinkId_t      id;             /*!< ID of this link */
-    std::string   name;           /*!< Name of this link */
-    ComponentId_t component[2];   /*!< IDs of the connected components */
-    std::string   port[2];        /*!< Names of the connected ports */
-    SimTime_t     latency[2];     /*!< Latency from each side */
-    std::string   latency_str[2]; /*!< Temp string holding latency */
+    LinkId_t       id;             /*!< ID of this link */
+    std::string    name;           /*!< Name of this link */
+    ComponentId_t  component[2];   /*!< IDs of the connected components */
+    InternedString port[2];        /*!< Names of the connected ports */
+    SimTime_t      latency[2];     /*!< Latency from each side */
+    InternedString latency_str[2]; /*!< Temp string holding latency */
 
     LinkId_t order;  /*!< Number of components currently referring to this Link.  After graph construction, it will
                        be repurposed to hold the enforce_order value */
@@ -223,7 +305,7 @@ public:
     ConfigGraph*          graph;         /*!< Graph that this component belongs to */
     std::string           name;          /*!< Name of this component, or slot name for subcomp */
     int                   slot_num;      /*!< Slot number.  Only valid for subcomponents */
-    std::string           type;          /*!< Type of this component */
+    InternedString        type;          /*!< Type of this component */
     float                 weight;        /*!< Partitioning weight for this component */
     RankInfo              rank;          /*!< Parallel Rank for this component */
     std::vector<LinkId_t> links;         /*!< List of links connected */
@@ -237,6 +319,7 @@ public:
 
     std::vector<ConfigComponent*> subComponents; /*!< List of subcomponents */
     std::vector<double>           coords;
+    bool                          coordsSet; /*!< True if coords were set with setCoordinates() */
     uint16_t nextSubID;  /*!< Next subID to use for children, if component, if subcomponent, subid of parent */
     uint16_t nextStatID; /*!< Next statID to use for children */
     bool     visited;    /*! Used when traversing graph to indicate component was visited already */
@@ -257,6 +340,7 @@ public:
         id(null_id),
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
+        coordsSet(false),
         nextSubID(1),
         visited(false)
     {}
@@ -287,8 +371,10 @@ public:
     void setStatisticLoadLevel(uint8_t level, bool recursively = false);
 
     void                     addGlobalParamSet(const std::string& set) { params.addGlobalParamSet(set); }
+    void                     addParamTemplate(uint32_t id) { params.addParamTemplate(id); }
     std::vector<std::string> getParamsLocalKeys() const { return params.getLocalKeys(); }
     std::vector<std::string> getSubscribedGlobalParamSets() const { return params.getSubscribedGlobalParamSets(); }
+    std::vector<uint32_t>    getParamTemplates() const { return params.getParamTemplates(); }
 
 
     std::vector<LinkId_t> allLinks() const;
@@ -316,6 +402,7 @@ public:
         ser& statLoadLevel;
         ser& subComponents;
         ser& coords;
+        ser& coordsSet;
         ser& nextSubID;
         ser& nextStatID;
     }
@@ -344,6 +431,7 @@ private:
         rank(rank),
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
+        coordsSet(false),
         nextSubID(1),
         nextStatID(1)
     {
@@ -362,6 +450,7 @@ private:
         rank(rank),
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
+        coordsSet(false),
         nextSubID(parent_subid),
         nextStatID(parent_subid)
     {
@@ -373,13 +462,13 @@ private:
 // typedef std::map<std::string,ConfigLink> ConfigLinkMap_t;
 // typedef SparseVectorMap<std::string,ConfigLink> ConfigLinkMap_t;
 /** Map IDs to Components */
-typedef SparseVectorMap<ComponentId_t, ConfigComponent*> ConfigComponentMap_t;
+typedef SparseVectorMap<ComponentId_t, ConfigComponent*>    ConfigComponentMap_t;
 /** Map names to Components */
-typedef std::map<std::string, ComponentId_t>             ConfigComponentNameMap_t;
+typedef std::unordered_map<std::string, ComponentId_t>      ConfigComponentNameMap_t;
 /** Map names to Parameter Sets: XML only */
-typedef std::map<std::string, Params*>                   ParamsMap_t;
+typedef std::map<std::string, Params*>                      ParamsMap_t;
 /** Map names to variable values:  XML only */
-typedef std::map<std::string, std::string>               VariableMap_t;
+typedef std::map<std::string, std::string>                  VariableMap_t;
 
 class PartitionGraph;
 
@@ -398,8 +487,9 @@ public:
         }
     }
 
-    ConfigGraph() : nextComponentId(0)
+    ConfigGraph() : nextComponentId(0), link_names_released(false)
     {
+        InternedString::acquirePool();
         links.clear();
         comps.clear();
         // Init the statistic output settings
@@ -410,6 +500,11 @@ public:
         output.init(o.getPrefix(), o.getVerboseLevel(), o.getVerboseMask(), Output::STDERR);
     }
 
+    ~ConfigGraph() { InternedString::releasePool(); }
+
+    ConfigGraph(const ConfigGraph&) = delete;
+    ConfigGraph& operator=(const ConfigGraph&) = delete;
+
     size_t getNumComponents() { return comps.data.size(); }
 
     size_t getNumComponentsInMPIRank(uint32_t rank);
@@ -425,6 +520,26 @@ public:
     /** Create a new component */
     ComponentId_t addComponent(const std::string& name, const std::string& type);
 
+    /** Take the id of a component that is not added to this graph
+     * because another rank builds it during a parallel load.  Keeps
+     * the ids of later components the same as in a full load. */
+    ComponentId_t reserveComponentId() { return nextComponentId++; }
+
+    /** Component built by another rank during a parallel load */
+    struct RemoteComponent
+    {
+        ComponentId_t id;
+        std::string   name;
+        std::string   type;
+        RankInfo      rank;
+    };
+
+    /** Add placeholders for components built by other ranks during a
+     * parallel load, holding only what is needed to connect links that
+     * cross ranks.  The ids must come from reserveComponentId() and may
+     * be in any order. */
+    void addRemoteComponents(const std::vector<RemoteComponent>& remote);
+
     /** Add a parameter to a global param set */
     void addGlobalParam(const std::string& global_set, const std::string& key, const std::string& value);
 
@@ -451,14 +566,20 @@ public:
         ComponentId_t comp_id, const std::string& link_name, const std::string& port, const std::string& latency_str,
         bool no_cut = false);
 
-    /** Set a Link to be no-cut */
+    /** Set a Link to be no-cut.  Only valid before
+     * postCreationCleanup() */
     void setLinkNoCut(const std::string& link_name);
 
+    /** Check whether a Link with the given name has been added.  Only
+     * valid before postCreationCleanup() */
+    bool containsLink(const std::string& link_name) const;
+
     /** Perform any post-creation cleanup processes */
     void postCreationCleanup();
 
-    /** Check the graph for Structural errors */
-    bool checkForStructuralErrors();
+    /** Check the graph for Structural errors.  If rank is given, only
+     * the ports of the components on that rank are checked. */
+    bool checkForStructuralErrors(uint32_t rank = UINT32_MAX);
 
     // Temporary until we have a better API
     /** Return the map of components */
@@ -508,6 +629,8 @@ public:
             // Need to reintialize the ConfigGraph ptrs in the
             // ConfigComponents
             setComponentConfigGraphPointers();
+            // The link name index is not sent
+            link_names_released = true;
         }
     }
 
@@ -521,10 +644,16 @@ private:
 
     ConfigLinkMap_t                        links;       // SparseVectorMap
     ConfigComponentMap_t                   comps;       // SparseVectorMap
-    ConfigComponentNameMap_t               compsByName; // std::map
+    ConfigComponentNameMap_t               compsByName; // std::unordered_map
     std::map<std::string, ConfigStatGroup> statGroups;
 
-    std::map<std::string, LinkId_t> link_names;
+    // Only used while links are being added
+    std::unordered_map<std::string, LinkId_t> link_names;
+    // Set once link_names has been dropped, after which links can no
+    // longer be looked up or added by name
+    bool                                      link_names_released;
+
+    void checkLinkNamesAvailable(const char* caller) const;
 
     std::vector<ConfigStatOutput> statOutputs; // [0] is default
     uint8_t                       statLoadLevel;
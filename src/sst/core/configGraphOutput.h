@@ -74,6 +74,33 @@ protected:
     static std::vector<std::string> getGlobalParamSetNames() { return Params::getGlobalParamSetNames(); }
 
 
+    /**
+     * Get the contents of a parameter template.
+     *
+     * @param id Id of the template, less than getNumParamTemplates()
+     *
+     * @return returns a copy of the requested template
+     *
+     */
+    static std::map<std::string, std::string> getParamTemplate(uint32_t id) { return Params::getParamTemplate(id); }
+
+
+    /**
+     * Get the number of parameter templates.
+     */
+    static uint32_t getNumParamTemplates() { return Params::getNumParamTemplates(); }
+
+
+    /**
+     * Serialize the key map and the global param sets, which the
+     * Params of serialized components refer to.
+     *
+     * @param ser serializer to pack the data into
+     *
+     */
+    static void serializeParamsGlobals(SST::Core::Serialization::serializer& ser) { Params::serializeGlobals(ser); }
+
+
     /**
      * Get a vector of the local keys
      *
@@ -96,6 +123,13 @@ protected:
     {
         return params.getSubscribedGlobalParamSets();
     }
+
+
+    /**
+     * Get a vector of the ids of the parameter templates this Params
+     * object uses, in the order they were added
+     */
+    std::vector<uint32_t> getParamTemplates(const Params& params) const { return params.getParamTemplates(); }
 };
 
 } // namespace Core
@@ -157,22 +157,32 @@ Exit::computeEndTime()
 // bool Exit::handler( Event* e )
 void
 Exit::check()
+{
+    check(0);
+}
+
+// value is summed in the same collective as the reference counts, so
+// other flags exchanged at a rank sync do not need their own
+int
+Exit::check(int value)
 {
     // TraceFunction trace(CALL_INFO_LONG);
-    int value = (m_refCount > 0);
-    int out;
+    int values[2] = { (m_refCount > 0), value };
+    int out[2];
 
 #ifdef SST_CONFIG_HAVE_MPI
-    if ( !single_rank ) { MPI_Allreduce(&value, &out, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD); }
+    if ( !single_rank ) { MPI_Allreduce(values, out, 2, MPI_INT, MPI_SUM, MPI_COMM_WORLD); }
     else {
-        out = value;
+        out[0] = values[0];
+        out[1] = values[1];
     }
 #else
-    out = value;
+    out[0] = values[0];
+    out[1] = values[1];
 #endif
-    global_count = out;
+    global_count = out[0];
     // If out is 0, then it's time to end
-    if ( !out ) { computeEndTime(); }
+    if ( !out[0] ) { computeEndTime(); }
     // else {
     //     // Reinsert into TimeVortex.  We do this even when ending so that
     //     // it will get deleted with the TimeVortex on termination.  We do
@@ -184,6 +194,7 @@ Exit::check()
     //     SimTime_t next = sim->getCurrentSimCycle() +
     //     sim->insertActivity( next, this );
     // }
+    return out[1];
 }
 
 } // namespace SST
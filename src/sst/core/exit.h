@@ -62,6 +62,8 @@ public:
     SimTime_t computeEndTime();
     void      execute(void) override;
     void      check();
+    /** Same as check(), and also returns the sum of value over all ranks */
+    int       check(int value);
 
     void print(const std::string& header, Output& out) const override
     {
@@ -0,0 +1,178 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/geometricpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+SSTGeometricPartition::SSTGeometricPartition(RankInfo mpiranks, RankInfo UNUSED(my_rank), int verbosity)
+{
+    rankcount  = mpiranks;
+    partOutput = new Output("GeometricPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTGeometricPartition::~SSTGeometricPartition()
+{
+    delete partOutput;
+}
+
+void
+SSTGeometricPartition::performPartition(ConfigGraph* graph)
+{
+    // Only the rank that built the graph has components to partition
+    if ( graph->getNumComponents() == 0 ) return;
+
+    uint32_t tot_parts = rankcount.rank * rankcount.thread;
+
+    PartitionGraph*          pgraph  = graph->getCollapsedPartitionGraph();
+    PartitionComponentMap_t& compMap = pgraph->getComponentMap();
+    ConfigComponentMap_t&    ccomps  = graph->getComponentMap();
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a geometric partition scheme for simulation model.\n");
+
+    // Place every partition component at the weighted center of the
+    // components in its group that have coordinates
+    vector<PartitionComponent*> comps;
+    vector<Item>                items;
+    vector<uint32_t>            linear;
+    double                      total_weight = 0.0;
+    comps.reserve(pgraph->getNumComponents());
+    for ( auto* pcomp : compMap ) {
+        Item item = { { 0.0, 0.0, 0.0 }, pcomp->weight, (uint32_t)comps.size() };
+        comps.push_back(pcomp);
+        total_weight += item.weight;
+
+        double coord_weight = 0.0;
+        for ( ComponentId_t id : pcomp->group ) {
+            const ConfigComponent* ccomp = ccomps[id];
+            const auto&            c     = ccomp->coords;
+            if ( !ccomp->coordsSet ) continue;
+
+            // Weight by component weight, but do not let zero weight
+            // components drop out of the average
+            double w = std::max(ccomp->weight, 1.0e-6f);
+            for ( int d = 0; d < 3 && d < (int)c.size(); d++ ) {
+                item.coord[d] += w * c[d];
+            }
+            coord_weight += w;
+        }
+
+        if ( coord_weight == 0.0 ) {
+            linear.push_back(item.index);
+            continue;
+        }
+        for ( int d = 0; d < 3; d++ ) {
+            item.coord[d] /= coord_weight;
+        }
+        items.push_back(item);
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Partition Count:                  %10" PRIu32 "\n", tot_parts);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Components with coordinates:      %10zu\n", items.size());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Components without coordinates:   %10zu\n", linear.size());
+
+    vector<uint32_t> part(comps.size(), 0);
+    vector<double>   capacity(tot_parts, total_weight / tot_parts);
+
+    // Components without coordinates are assigned linearly in id
+    // order, moving to the next part once the current one is full
+    uint32_t current = 0;
+    for ( uint32_t index : linear ) {
+        double weight = comps[index]->weight;
+        while ( current < tot_parts - 1 && capacity[current] < weight / 2 ) {
+            current++;
+        }
+        part[index] = current;
+        capacity[current] -= weight;
+    }
+    for ( auto& cap : capacity ) {
+        cap = std::max(cap, 0.0);
+    }
+
+    // Remaining capacity is filled by recursive coordinate bisection
+    bisect(items.begin(), items.end(), 0, tot_parts, capacity, part);
+
+    for ( size_t i = 0; i < comps.size(); i++ ) {
+        comps[i]->rank = RankInfo(part[i] / rankcount.thread, part[i] % rankcount.thread);
+    }
+
+    graph->annotateRanks(pgraph);
+    delete pgraph;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Geometric partition scheme completed.\n");
+}
+
+void
+SSTGeometricPartition::bisect(
+    vector<Item>::iterator begin, vector<Item>::iterator end, uint32_t first_part, uint32_t num_parts,
+    const vector<double>& capacity, vector<uint32_t>& part)
+{
+    if ( begin == end ) return;
+    if ( num_parts == 1 ) {
+        for ( auto it = begin; it != end; ++it ) {
+            part[it->index] = first_part;
+        }
+        return;
+    }
+
+    // Split the parts in half and give each half a share of the weight
+    // proportional to its remaining capacity
+    uint32_t left_parts = num_parts / 2;
+    double   left_cap   = 0.0;
+    double   total_cap  = 0.0;
+    for ( uint32_t p = first_part; p < first_part + num_parts; p++ ) {
+        if ( p < first_part + left_parts ) left_cap += capacity[p];
+        total_cap += capacity[p];
+    }
+    double fraction = total_cap > 0.0 ? left_cap / total_cap : (double)left_parts / num_parts;
+
+    // Cut perpendicular to the longest extent
+    double lo[3] = { begin->coord[0], begin->coord[1], begin->coord[2] };
+    double hi[3] = { lo[0], lo[1], lo[2] };
+    double total = 0.0;
+    for ( auto it = begin; it != end; ++it ) {
+        for ( int d = 0; d < 3; d++ ) {
+            lo[d] = std::min(lo[d], it->coord[d]);
+            hi[d] = std::max(hi[d], it->coord[d]);
+        }
+        total += it->weight;
+    }
+    int dim = 0;
+    for ( int d = 1; d < 3; d++ ) {
+        if ( hi[d] - lo[d] > hi[dim] - lo[dim] ) dim = d;
+    }
+
+    std::sort(begin, end, [dim](const Item& a, const Item& b) {
+        if ( a.coord[dim] != b.coord[dim] ) return a.coord[dim] < b.coord[dim];
+        return a.index < b.index;
+    });
+
+    // Find the split point closest to the target weight
+    double target = fraction * total;
+    double sum    = 0.0;
+    auto   split  = begin;
+    while ( split != end && sum + split->weight / 2 <= target ) {
+        sum += split->weight;
+        ++split;
+    }
+
+    bisect(begin, split, first_part, left_parts, capacity, part);
+    bisect(split, end, first_part + left_parts, num_parts - left_parts, capacity, part);
+}
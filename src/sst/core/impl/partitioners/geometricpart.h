@@ -0,0 +1,97 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_GEOMETRICPART_H
+#define SST_CORE_IMPL_PARTITONERS_GEOMETRICPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a geometric partition of an SST simulation configuration
+using the coordinates set on the components with setCoordinates().
+The components are split by recursive coordinate bisection: at each
+step the set is cut perpendicular to its longest extent at the point
+where the component weight on each side matches the number of parts
+assigned to it.  This gives balanced parts with good locality for
+mesh, torus and other spatial models in O(n log^2 n) time.
+
+Components whose coordinates were never set are assigned linearly, in
+order of component id, before the geometric partition fills the
+remaining capacity of each part.  A component explicitly placed at
+(0,0,0) has coordinates.  Components joined by no_cut links are kept
+together and placed at the weighted center of the group.
+*/
+class SSTGeometricPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTGeometricPartition,
+        "sst",
+        "geometric",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Partitions components by recursive coordinate bisection of the component coordinates.  Components "
+        "without coordinates are partitioned linearly.")
+
+protected:
+    /** Number of ranks in the simulation */
+    RankInfo rankcount;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+
+public:
+    /**
+       Creates a new geometric partition scheme.
+       \param rankCount Number of MPI ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTGeometricPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+    ~SSTGeometricPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration.  The
+       coordinates are only available in the ConfigGraph, which is
+       collapsed here so that no_cut links are still honored.
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(ConfigGraph* graph) override;
+
+    bool requiresConfigGraph() override { return true; }
+    bool spawnOnAllRanks() override { return false; }
+
+private:
+    struct Item
+    {
+        double   coord[3];
+        double   weight;
+        uint32_t index;
+    };
+
+    void bisect(
+        std::vector<Item>::iterator begin, std::vector<Item>::iterator end, uint32_t first_part, uint32_t num_parts,
+        const std::vector<double>& capacity, std::vector<uint32_t>& part);
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_GEOMETRICPART_H
@@ -0,0 +1,757 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <unordered_map>
+
+using namespace std;
+
+namespace SST {
+namespace IMPL {
+namespace Partition {
+
+using Graph = MultilevelPartitioner::Graph;
+using Edge  = MultilevelPartitioner::Edge;
+
+using Options = MultilevelPartitioner::Options;
+
+MultilevelPartitioner::MultilevelPartitioner(RankInfo total_ranks, RankInfo UNUSED(my_rank), int verbosity) :
+    SSTPartitioner(),
+    world_size(total_ranks),
+    total_parts(world_size.rank * world_size.thread)
+{
+    partOutput = new Output("MultilevelPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+MultilevelPartitioner::~MultilevelPartitioner()
+{
+    delete partOutput;
+}
+
+void
+MultilevelPartitioner::readOptions(Params& params, Options& options, Output* output)
+{
+    options.imbalance      = params.find<double>("imbalance", options.imbalance);
+    options.coarsest_size  = params.find<uint32_t>("coarsest_size", options.coarsest_size);
+    options.coarsen_ratio  = params.find<double>("coarsen_ratio", options.coarsen_ratio);
+    options.initial_trials = params.find<int>("initial_trials", options.initial_trials);
+    options.refine_passes  = params.find<int>("refine_passes", options.refine_passes);
+
+    if ( options.imbalance < 0.0 ) {
+        output->fatal(CALL_INFO, 1, "Partitioner parameter imbalance must not be negative: %f\n", options.imbalance);
+    }
+    if ( options.coarsest_size < 2 ) {
+        output->fatal(
+            CALL_INFO, 1, "Partitioner parameter coarsest_size must be at least 2: %" PRIu32 "\n",
+            options.coarsest_size);
+    }
+    if ( options.coarsen_ratio <= 0.0 || options.coarsen_ratio > 1.0 ) {
+        output->fatal(
+            CALL_INFO, 1, "Partitioner parameter coarsen_ratio must be in (0, 1]: %f\n", options.coarsen_ratio);
+    }
+    if ( options.initial_trials < 1 ) {
+        output->fatal(
+            CALL_INFO, 1, "Partitioner parameter initial_trials must be at least 1: %d\n", options.initial_trials);
+    }
+    if ( options.refine_passes < 0 ) {
+        output->fatal(
+            CALL_INFO, 1, "Partitioner parameter refine_passes must not be negative: %d\n", options.refine_passes);
+    }
+}
+
+void
+MultilevelPartitioner::setParams(Params& params)
+{
+    readOptions(params, options, partOutput);
+}
+
+/**
+   Union-find over vertices that tracks the total vertex weight of each set
+*/
+class WeightedUnionFind
+{
+public:
+    WeightedUnionFind(const vector<int64_t>& vwgt) : parent(vwgt.size()), weight(vwgt)
+    {
+        iota(parent.begin(), parent.end(), 0);
+    }
+
+    uint32_t find(uint32_t v)
+    {
+        while ( parent[v] != v ) {
+            parent[v] = parent[parent[v]];
+            v         = parent[v];
+        }
+        return v;
+    }
+
+    /** Join the sets of a and b and return the root of the joined set */
+    uint32_t unite(uint32_t a, uint32_t b)
+    {
+        a = find(a);
+        b = find(b);
+        if ( a == b ) return a;
+        if ( weight[a] < weight[b] ) swap(a, b);
+        parent[b] = a;
+        weight[a] += weight[b];
+        return a;
+    }
+
+    int64_t getWeight(uint32_t root) const { return weight[root]; }
+
+private:
+    vector<uint32_t> parent;
+    vector<int64_t>  weight;
+};
+
+void
+MultilevelPartitioner::buildGraph(vector<int64_t>& vwgt, const vector<Edge>& edges, Graph& graph)
+{
+    uint32_t n = vwgt.size();
+
+    // Bucket the edges (both directions) by vertex
+    vector<uint64_t> count(n + 1, 0);
+    for ( auto& e : edges ) {
+        if ( e.a == e.b ) continue;
+        count[e.a + 1]++;
+        count[e.b + 1]++;
+    }
+    for ( uint32_t v = 0; v < n; v++ ) {
+        count[v + 1] += count[v];
+    }
+
+    vector<uint32_t> adj(count[n]);
+    vector<int64_t>  wgt(count[n]);
+    vector<uint64_t> fill(count.begin(), count.end() - 1);
+    for ( auto& e : edges ) {
+        if ( e.a == e.b ) continue;
+        adj[fill[e.a]]   = e.b;
+        wgt[fill[e.a]++] = e.weight;
+        adj[fill[e.b]]   = e.a;
+        wgt[fill[e.b]++] = e.weight;
+    }
+
+    // Combine parallel edges
+    graph.xadj.clear();
+    graph.adjncy.clear();
+    graph.adjwgt.clear();
+    graph.xadj.reserve(n + 1);
+    graph.adjncy.reserve(adj.size());
+    graph.adjwgt.reserve(adj.size());
+    graph.xadj.push_back(0);
+
+    vector<int64_t> slot(n, -1);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        uint64_t rowStart = graph.adjncy.size();
+        for ( uint64_t i = count[v]; i < count[v + 1]; i++ ) {
+            uint32_t u = adj[i];
+            if ( slot[u] < 0 ) {
+                slot[u] = graph.adjncy.size();
+                graph.adjncy.push_back(u);
+                graph.adjwgt.push_back(wgt[i]);
+            }
+            else {
+                graph.adjwgt[slot[u]] += wgt[i];
+            }
+        }
+        for ( uint64_t i = rowStart; i < graph.adjncy.size(); i++ ) {
+            slot[graph.adjncy[i]] = -1;
+        }
+        graph.xadj.push_back(graph.adjncy.size());
+    }
+
+    graph.vwgt.swap(vwgt);
+}
+
+// Coarsen a graph by heavy-edge matching.  Each vertex is matched with
+// the unmatched neighbor it shares the heaviest edge with, as long as
+// the combined weight stays below maxVertexWeight.  Returns false if
+// the graph kept more than coarsenRatio of its vertices, which is not
+// enough to be worth another level.
+static bool
+coarsenGraph(
+    const Graph& g, int64_t maxVertexWeight, double coarsenRatio, mt19937& rng, Graph& coarse, vector<uint32_t>& cmap)
+{
+    const uint32_t n         = g.size();
+    const uint32_t unmatched = UINT32_MAX;
+
+    vector<uint32_t> order(n);
+    iota(order.begin(), order.end(), 0);
+    shuffle(order.begin(), order.end(), rng);
+
+    vector<uint32_t> match(n, unmatched);
+    for ( uint32_t v : order ) {
+        if ( match[v] != unmatched ) continue;
+        uint32_t best       = v;
+        int64_t  bestWeight = -1;
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( match[u] == unmatched && g.adjwgt[e] > bestWeight && g.vwgt[v] + g.vwgt[u] <= maxVertexWeight ) {
+                best       = u;
+                bestWeight = g.adjwgt[e];
+            }
+        }
+        match[v]    = best;
+        match[best] = v;
+    }
+
+    cmap.assign(n, 0);
+    uint32_t nc = 0;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( v <= match[v] ) {
+            cmap[v]        = nc;
+            cmap[match[v]] = nc;
+            nc++;
+        }
+    }
+    if ( nc > coarsenRatio * n ) return false;
+
+    coarse.vwgt.assign(nc, 0);
+    coarse.xadj.clear();
+    coarse.adjncy.clear();
+    coarse.adjwgt.clear();
+    coarse.xadj.reserve(nc + 1);
+    coarse.xadj.push_back(0);
+
+    vector<int64_t> slot(nc, -1);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( v > match[v] ) continue;
+        uint32_t c        = cmap[v];
+        uint64_t rowStart = coarse.adjncy.size();
+
+        uint32_t members[2] = { v, match[v] };
+        int      num        = (match[v] == v) ? 1 : 2;
+        for ( int m = 0; m < num; m++ ) {
+            uint32_t w = members[m];
+            coarse.vwgt[c] += g.vwgt[w];
+            for ( uint64_t e = g.xadj[w]; e < g.xadj[w + 1]; e++ ) {
+                uint32_t cu = cmap[g.adjncy[e]];
+                if ( cu == c ) continue;
+                if ( slot[cu] < 0 ) {
+                    slot[cu] = coarse.adjncy.size();
+                    coarse.adjncy.push_back(cu);
+                    coarse.adjwgt.push_back(g.adjwgt[e]);
+                }
+                else {
+                    coarse.adjwgt[slot[cu]] += g.adjwgt[e];
+                }
+            }
+        }
+        for ( uint64_t i = rowStart; i < coarse.adjncy.size(); i++ ) {
+            slot[coarse.adjncy[i]] = -1;
+        }
+        coarse.xadj.push_back(coarse.adjncy.size());
+    }
+    return true;
+}
+
+// Weight by which the parts exceed their maximum weights
+static inline int64_t
+excessWeight(const int64_t pw[2], const int64_t maxw[2])
+{
+    return max<int64_t>(0, pw[0] - maxw[0]) + max<int64_t>(0, pw[1] - maxw[1]);
+}
+
+// Compute the part weights and cut of a bisection
+static int64_t
+evaluateBisection(const Graph& g, const vector<uint8_t>& side, int64_t pw[2])
+{
+    int64_t cut = 0;
+    pw[0] = pw[1] = 0;
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        pw[side[v]] += g.vwgt[v];
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            if ( side[g.adjncy[e]] != side[v] ) cut += g.adjwgt[e];
+        }
+    }
+    return cut / 2;
+}
+
+// Refine a bisection with Fiduccia-Mattheyses passes.  Each pass
+// moves boundary vertices from the relatively heavier side in order of
+// decreasing gain, locking each vertex once moved, and then rolls back
+// to the best state seen (lowest excess weight, then lowest cut).
+static void
+refineBisection(const Graph& g, vector<uint8_t>& side, const int64_t target[2], const int64_t maxw[2], int passes)
+{
+    const uint32_t n = g.size();
+    if ( n < 2 ) return;
+
+    // Internal and external edge weight of every vertex
+    vector<int64_t> id(n, 0);
+    vector<int64_t> ed(n, 0);
+    int64_t         pw[2] = { 0, 0 };
+    int64_t         cut   = 0;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        pw[side[v]] += g.vwgt[v];
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            if ( side[g.adjncy[e]] == side[v] )
+                id[v] += g.adjwgt[e];
+            else
+                ed[v] += g.adjwgt[e];
+        }
+        cut += ed[v];
+    }
+    cut /= 2;
+
+    const size_t     moveLimit = min<size_t>(max<size_t>(n / 100, 50), 1000);
+    vector<uint8_t>  locked(n, 0);
+    vector<uint32_t> moves;
+
+    auto moveVertex = [&](uint32_t v) {
+        uint8_t from = side[v];
+        uint8_t to   = from ^ 1;
+        side[v]      = to;
+        pw[from] -= g.vwgt[v];
+        pw[to] += g.vwgt[v];
+        cut -= ed[v] - id[v];
+        swap(id[v], ed[v]);
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( side[u] == to ) {
+                id[u] += g.adjwgt[e];
+                ed[u] -= g.adjwgt[e];
+            }
+            else {
+                id[u] -= g.adjwgt[e];
+                ed[u] += g.adjwgt[e];
+            }
+        }
+    };
+
+    for ( int pass = 0; pass < passes; pass++ ) {
+        typedef priority_queue<pair<int64_t, uint32_t>> GainQueue;
+        GainQueue queue[2];
+        for ( uint32_t v = 0; v < n; v++ ) {
+            if ( ed[v] > 0 ) queue[side[v]].emplace(ed[v] - id[v], v);
+        }
+
+        moves.clear();
+        size_t  bestMoves  = 0;
+        int64_t bestExcess = excessWeight(pw, maxw);
+        int64_t bestCut    = cut;
+
+        while ( moves.size() - bestMoves < moveLimit ) {
+            // Move from the side that is heavier relative to its target
+            int from = ((double)pw[0] * target[1] >= (double)pw[1] * target[0]) ? 0 : 1;
+            if ( queue[from].empty() ) from ^= 1;
+
+            // Find the best valid entry in the queue
+            uint32_t v     = UINT32_MAX;
+            bool     found = false;
+            while ( !queue[from].empty() ) {
+                auto top = queue[from].top();
+                queue[from].pop();
+                v = top.second;
+                if ( !locked[v] && side[v] == from && top.first == ed[v] - id[v] ) {
+                    found = true;
+                    break;
+                }
+            }
+            if ( !found ) {
+                if ( queue[from ^ 1].empty() ) break;
+                continue;
+            }
+
+            // Do not make the balance worse
+            int64_t after[2]  = { pw[0], pw[1] };
+            after[from] -= g.vwgt[v];
+            after[from ^ 1] += g.vwgt[v];
+            locked[v] = 1;
+            if ( excessWeight(after, maxw) > excessWeight(pw, maxw) ) continue;
+
+            moveVertex(v);
+            moves.push_back(v);
+            for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+                uint32_t u = g.adjncy[e];
+                if ( !locked[u] ) queue[side[u]].emplace(ed[u] - id[u], u);
+            }
+
+            int64_t excess = excessWeight(pw, maxw);
+            if ( excess < bestExcess || (excess == bestExcess && cut < bestCut) ) {
+                bestMoves  = moves.size();
+                bestExcess = excess;
+                bestCut    = cut;
+            }
+        }
+
+        // Roll back to the best state
+        for ( size_t i = moves.size(); i > bestMoves; i-- ) {
+            moveVertex(moves[i - 1]);
+        }
+        fill(locked.begin(), locked.end(), 0);
+
+        if ( 0 == bestMoves ) break;
+    }
+}
+
+// Initial bisection by greedy graph growing: part 0 is grown from a
+// random seed by repeatedly adding the vertex most connected to it until
+// it reaches its target weight.
+static void
+growBisection(const Graph& g, const int64_t target[2], mt19937& rng, vector<uint8_t>& side)
+{
+    const uint32_t n = g.size();
+    side.assign(n, 1);
+
+    vector<int64_t> degree(n, 0);
+    vector<int64_t> conn(n, 0);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            degree[v] += g.adjwgt[e];
+        }
+    }
+
+    priority_queue<pair<int64_t, uint32_t>> frontier;
+    int64_t                                 pw0  = 0;
+    uint32_t                                next = uniform_int_distribution<uint32_t>(0, n - 1)(rng);
+    uint32_t                                seen = 0;
+
+    while ( pw0 < target[0] ) {
+        uint32_t v = UINT32_MAX;
+        while ( !frontier.empty() ) {
+            auto top = frontier.top();
+            frontier.pop();
+            if ( side[top.second] == 1 && top.first == 2 * conn[top.second] - degree[top.second] ) {
+                v = top.second;
+                break;
+            }
+        }
+        if ( v == UINT32_MAX ) {
+            // Disconnected from part 0, start from another vertex
+            while ( seen < n && side[next] == 0 ) {
+                next = (next + 1) % n;
+                seen++;
+            }
+            if ( seen >= n ) break;
+            v = next;
+        }
+
+        // Stop if adding the vertex would move further from the target
+        if ( pw0 + g.vwgt[v] - target[0] > target[0] - pw0 ) break;
+
+        side[v] = 0;
+        pw0 += g.vwgt[v];
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( side[u] == 1 ) {
+                conn[u] += g.adjwgt[e];
+                frontier.emplace(2 * conn[u] - degree[u], u);
+            }
+        }
+    }
+}
+
+// Bisect a graph so that part 0 has weight close to target[0]
+static void
+multilevelBisect(
+    const Graph& g, const int64_t target[2], const int64_t maxw[2], const Options& options, mt19937& rng,
+    vector<uint8_t>& side)
+{
+    // Coarsen
+    vector<unique_ptr<Graph>> levels;
+    vector<vector<uint32_t>>  cmaps;
+    const Graph*              current = &g;
+    int64_t maxVertexWeight = max<int64_t>(1, 3 * (target[0] + target[1]) / (2 * (int64_t)options.coarsest_size));
+    while ( current->size() > options.coarsest_size ) {
+        unique_ptr<Graph> coarse(new Graph());
+        vector<uint32_t>  cmap;
+        if ( !coarsenGraph(*current, maxVertexWeight, options.coarsen_ratio, rng, *coarse, cmap) ) break;
+        levels.push_back(std::move(coarse));
+        cmaps.push_back(std::move(cmap));
+        current = levels.back().get();
+    }
+
+    // Initial bisection of the coarsest graph, best of several trials
+    int64_t bestExcess = INT64_MAX;
+    int64_t bestCut    = INT64_MAX;
+    for ( int trial = 0; trial < options.initial_trials; trial++ ) {
+        vector<uint8_t> trialSide;
+        growBisection(*current, target, rng, trialSide);
+        refineBisection(*current, trialSide, target, maxw, 2 * options.refine_passes);
+
+        int64_t pw[2];
+        int64_t cut    = evaluateBisection(*current, trialSide, pw);
+        int64_t excess = excessWeight(pw, maxw);
+        if ( excess < bestExcess || (excess == bestExcess && cut < bestCut) ) {
+            bestExcess = excess;
+            bestCut    = cut;
+            side.swap(trialSide);
+        }
+    }
+
+    // Project back to the finer graphs and refine
+    for ( size_t level = levels.size(); level > 0; level-- ) {
+        const Graph&            fine = (level == 1) ? g : *levels[level - 2];
+        const vector<uint32_t>& cmap = cmaps[level - 1];
+        vector<uint8_t>         fineSide(fine.size());
+        for ( uint32_t v = 0; v < fine.size(); v++ ) {
+            fineSide[v] = side[cmap[v]];
+        }
+        side.swap(fineSide);
+        levels[level - 1].reset();
+        refineBisection(fine, side, target, maxw, options.refine_passes);
+    }
+}
+
+// Recursively bisect a graph into nparts parts.  ids maps the vertices
+// of g to the vertices of the original graph.  g and ids are released
+// before recursing to bound memory use.
+static void
+recursiveBisect(
+    Graph& g, vector<uint32_t>& ids, uint32_t firstPart, uint32_t nparts, double imbalance, const Options& options,
+    mt19937& rng, vector<uint32_t>& part)
+{
+    if ( 1 == nparts || g.size() <= 1 ) {
+        for ( uint32_t id : ids ) {
+            part[id] = firstPart;
+        }
+        return;
+    }
+
+    uint32_t parts[2] = { nparts / 2, nparts - nparts / 2 };
+    int64_t  total    = accumulate(g.vwgt.begin(), g.vwgt.end(), (int64_t)0);
+    int64_t  target[2];
+    target[0] = (int64_t)((double)total * parts[0] / nparts);
+    target[1] = total - target[0];
+    int64_t maxw[2];
+    for ( int s = 0; s < 2; s++ ) {
+        maxw[s] = (int64_t)(target[s] * (1.0 + imbalance)) + 1;
+    }
+
+    vector<uint8_t> side;
+    multilevelBisect(g, target, maxw, options, rng, side);
+
+    // Build the two induced subgraphs
+    vector<uint32_t> local(g.size());
+    uint32_t         count[2] = { 0, 0 };
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        local[v] = count[side[v]]++;
+    }
+
+    Graph            sub[2];
+    vector<uint32_t> subIds[2];
+    for ( int s = 0; s < 2; s++ ) {
+        sub[s].xadj.reserve(count[s] + 1);
+        sub[s].xadj.push_back(0);
+        sub[s].vwgt.reserve(count[s]);
+        subIds[s].reserve(count[s]);
+    }
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        Graph& sg = sub[side[v]];
+        for ( uint64_t e = g.xadj[v]; e < g.xadj[v + 1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( side[u] != side[v] ) continue;
+            sg.adjncy.push_back(local[u]);
+            sg.adjwgt.push_back(g.adjwgt[e]);
+        }
+        sg.xadj.push_back(sg.adjncy.size());
+        sg.vwgt.push_back(g.vwgt[v]);
+        subIds[side[v]].push_back(ids[v]);
+    }
+
+    g = Graph();
+    vector<uint32_t>().swap(ids);
+
+    recursiveBisect(sub[0], subIds[0], firstPart, parts[0], imbalance, options, rng, part);
+    recursiveBisect(sub[1], subIds[1], firstPart + parts[0], parts[1], imbalance, options, rng, part);
+}
+
+void
+MultilevelPartitioner::partitionGraph(
+    const Graph& graph, uint32_t nparts, const Options& options, vector<uint32_t>& part)
+{
+    part.assign(graph.size(), 0);
+    if ( nparts <= 1 || graph.size() == 0 ) return;
+
+    // Spread the allowed imbalance over the levels of bisection
+    double levels         = ceil(log2((double)nparts));
+    double levelImbalance = pow(1.0 + options.imbalance, 1.0 / levels) - 1.0;
+
+    mt19937          rng(0x5eed);
+    Graph            g = graph;
+    vector<uint32_t> ids(graph.size());
+    iota(ids.begin(), ids.end(), 0);
+    recursiveBisect(g, ids, 0, nparts, levelImbalance, options, rng, part);
+}
+
+void
+MultilevelPartitioner::evaluatePartition(
+    const Graph& graph, uint32_t nparts, const vector<uint32_t>& part, int64_t& cut, double& imbalance)
+{
+    vector<int64_t> load(nparts, 0);
+    int64_t         total = 0;
+    cut                   = 0;
+    for ( uint32_t v = 0; v < graph.size(); v++ ) {
+        load[part[v]] += graph.vwgt[v];
+        total += graph.vwgt[v];
+        for ( uint64_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ ) {
+            if ( part[graph.adjncy[e]] != part[v] ) cut += graph.adjwgt[e];
+        }
+    }
+    cut /= 2;
+    imbalance = total > 0 ? (double)*max_element(load.begin(), load.end()) * nparts / total - 1.0 : 0.0;
+}
+
+void
+MultilevelPartitioner::performPartition(PartitionGraph* graph)
+{
+    PartitionComponentMap_t& component_map = graph->getComponentMap();
+    PartitionLinkMap_t&      link_map      = graph->getLinkMap();
+
+    if ( total_parts == 1 ) {
+        for ( auto* comp : component_map ) {
+            comp->rank = RankInfo(0, 0);
+        }
+        return;
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a multilevel partition into %" PRIu32 " parts.\n", total_parts);
+
+    // Vertex weights.  Component weights are floating point, so scale
+    // them to integers while keeping every vertex at least weight 1.
+    vector<PartitionComponent*> comps;
+    vector<int64_t>             vwgt;
+    comps.reserve(graph->getNumComponents());
+    vwgt.reserve(graph->getNumComponents());
+    for ( auto* comp : component_map ) {
+        comps.push_back(comp);
+        vwgt.push_back(max<int64_t>(1, llround(comp->weight * 1000.0)));
+    }
+    const uint32_t n = comps.size();
+
+    struct LatencyEdge
+    {
+        uint32_t  a;
+        uint32_t  b;
+        SimTime_t latency;
+    };
+    vector<LatencyEdge> edges;
+    edges.reserve(link_map.size());
+
+    // Pair up the endpoints of each link through the link lists of the
+    // components.  The component fields of the links are not used since
+    // they may still hold the ids of subcomponents.
+    unordered_map<LinkId_t, uint32_t> firstEnd;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        for ( LinkId_t id : comps[v]->links ) {
+            auto found = firstEnd.find(id);
+            if ( found == firstEnd.end() ) {
+                firstEnd.emplace(id, v);
+                continue;
+            }
+            if ( found->second != v ) edges.push_back({ found->second, v, link_map[id].getMinLatency() });
+            firstEnd.erase(found);
+        }
+    }
+    unordered_map<LinkId_t, uint32_t>().swap(firstEnd);
+
+    sort(edges.begin(), edges.end(),
+        [](const LatencyEdge& x, const LatencyEdge& y) { return x.latency < y.latency; });
+
+    // Find the smallest latency that has to be cut: contract links in
+    // order of increasing latency until a contracted group no longer fits
+    // in a part.  All links with lower latency can be kept uncut.
+    int64_t   total     = accumulate(vwgt.begin(), vwgt.end(), (int64_t)0);
+    int64_t   maxVwgt   = *max_element(vwgt.begin(), vwgt.end());
+    int64_t   maxGroup  = max<int64_t>(maxVwgt, (int64_t)(total * (1.0 + options.imbalance) / total_parts));
+    SimTime_t minCutLat = MAX_SIMTIME_T;
+    {
+        WeightedUnionFind uf(vwgt);
+        for ( auto& e : edges ) {
+            if ( uf.getWeight(uf.unite(e.a, e.b)) > maxGroup ) {
+                minCutLat = e.latency;
+                break;
+            }
+        }
+    }
+
+    // Contract every link below that latency
+    WeightedUnionFind uf(vwgt);
+    for ( auto& e : edges ) {
+        if ( e.latency >= minCutLat ) break;
+        uf.unite(e.a, e.b);
+    }
+    vector<uint32_t> group(n);
+    vector<int64_t>  groupWgt;
+    {
+        vector<uint32_t> rootGroup(n, UINT32_MAX);
+        for ( uint32_t v = 0; v < n; v++ ) {
+            uint32_t root = uf.find(v);
+            if ( rootGroup[root] == UINT32_MAX ) {
+                rootGroup[root] = groupWgt.size();
+                groupWgt.push_back(0);
+            }
+            group[v] = rootGroup[root];
+            groupWgt[group[v]] += vwgt[v];
+        }
+    }
+
+    // Remaining links are weighted inversely to their latency, relative
+    // to the lowest latency that may be cut
+    vector<Edge> groupEdges;
+    for ( auto& e : edges ) {
+        if ( e.latency < minCutLat || group[e.a] == group[e.b] ) continue;
+        SimTime_t base   = (minCutLat == MAX_SIMTIME_T) ? e.latency : minCutLat;
+        int64_t   weight = max<int64_t>(1, llround(1000.0 * (base + 1) / (e.latency + 1)));
+        groupEdges.push_back({ group[e.a], group[e.b], weight });
+    }
+
+    partOutput->verbose(
+        CALL_INFO, 1, 0, "- Components: %" PRIu32 ", contracted groups: %zu, min cut latency: %" PRIu64 "\n", n,
+        groupWgt.size(), minCutLat);
+
+    Graph groupGraph;
+    buildGraph(groupWgt, groupEdges, groupGraph);
+    vector<Edge>().swap(groupEdges);
+
+    vector<uint32_t> part;
+    partitionGraph(groupGraph, total_parts, options, part);
+
+    for ( uint32_t v = 0; v < n; v++ ) {
+        comps[v]->rank = convertPartNum(part[group[v]]);
+    }
+
+    // Report the cut in links and the balance of the component weights
+    int64_t   cutWeight;
+    double    imbalance;
+    uint64_t  cutLinks  = 0;
+    SimTime_t cutMinLat = MAX_SIMTIME_T;
+    evaluatePartition(groupGraph, total_parts, part, cutWeight, imbalance);
+    for ( auto& e : edges ) {
+        if ( part[group[e.a]] == part[group[e.b]] ) continue;
+        cutLinks++;
+        cutMinLat = min(cutMinLat, e.latency);
+    }
+    partOutput->verbose(
+        CALL_INFO, 1, 0,
+        "- Edge cut: %" PRIu64 " links (weight %" PRId64 "), min cut latency: %" PRIu64 ", imbalance: %.4f\n",
+        cutLinks, cutWeight, cutMinLat, imbalance);
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Multilevel partition scheme completed.\n");
+}
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
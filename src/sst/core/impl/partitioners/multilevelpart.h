@@ -0,0 +1,154 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+#define SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+
+#include "sst/core/configGraph.h"
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sstpart.h"
+
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Multilevel graph partitioner.  The partition is computed in two steps:
+
+1. The sync period of a parallel simulation is set by the smallest
+   latency of any link that crosses a partition boundary.  Links are
+   contracted in order of increasing latency for as long as no
+   contracted group becomes too heavy to fit in a balanced part.  The
+   links that were contracted are never cut, which maximizes the
+   minimum cut latency.
+
+2. The contracted graph is partitioned by recursive multilevel
+   bisection: the graph is coarsened by heavy-edge matching, the
+   coarsest graph is bisected by greedy graph growing and the
+   bisection is refined with Fiduccia-Mattheyses passes as it is
+   projected back to the finer graphs.  Edge weights are inversely
+   proportional to link latency, so the refinement prefers to cut
+   high latency links.
+
+Component weights are balanced across parts and no_cut links are
+honored through the collapsed PartitionGraph.  The balance and the
+coarsening can be tuned with --partitioner-params (see Options).
+*/
+class MultilevelPartitioner : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        MultilevelPartitioner,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioner that keeps the lowest latency links uncut, then minimizes the latency weighted "
+        "cut while balancing component weights.")
+
+    /** Compressed sparse row graph used by the partitioning algorithms */
+    struct Graph
+    {
+        std::vector<uint64_t> xadj;   /*!< Start of each vertex's adjacency, size is number of vertices + 1 */
+        std::vector<uint32_t> adjncy; /*!< Neighbor vertices */
+        std::vector<int64_t>  adjwgt; /*!< Edge weights */
+        std::vector<int64_t>  vwgt;   /*!< Vertex weights */
+
+        uint32_t size() const { return vwgt.size(); }
+    };
+
+    /** An undirected weighted edge used to build a Graph */
+    struct Edge
+    {
+        uint32_t a;
+        uint32_t b;
+        int64_t  weight;
+    };
+
+    /** Tuning options for partitionGraph().  Each can be set with
+     * --partitioner-params using the name of the field. */
+    struct Options
+    {
+        double   imbalance      = 0.03; /*!< Allowed relative excess weight of any part */
+        uint32_t coarsest_size  = 100;  /*!< Coarsening stops once a graph has this many vertices */
+        double   coarsen_ratio  = 0.95; /*!< Coarsening stops when a level keeps more than this fraction of vertices */
+        int      initial_trials = 8;    /*!< Number of greedy growing trials for the initial bisection */
+        int      refine_passes  = 4;    /*!< Number of FM passes at each level of the uncoarsening */
+    };
+
+    /** Read Options from partitioner parameters.  Invalid values are fatal.
+     * @param params - Parameters given with --partitioner-params
+     * @param options - Updated with the parameters that are set
+     * @param output - Output used to report invalid values
+     */
+    static void readOptions(Params& params, Options& options, Output* output);
+
+    /** Build a Graph from a list of edges.  Self edges are dropped and
+     * parallel edges are combined by adding their weights.
+     * @param vwgt - Vertex weights; moved into the graph
+     * @param edges - Edges of the graph
+     * @param graph - The graph that is built
+     */
+    static void buildGraph(std::vector<int64_t>& vwgt, const std::vector<Edge>& edges, Graph& graph);
+
+    /** Partition a graph into nparts parts with balanced vertex weights
+     * while minimizing the weight of cut edges.
+     * @param graph - The graph to partition
+     * @param nparts - The number of parts
+     * @param options - Balance and coarsening options
+     * @param part - Set to the part of each vertex
+     */
+    static void
+    partitionGraph(const Graph& graph, uint32_t nparts, const Options& options, std::vector<uint32_t>& part);
+
+    /** Measure the quality of a partition.
+     * @param graph - The partitioned graph
+     * @param nparts - The number of parts
+     * @param part - The part of each vertex
+     * @param cut - Set to the total weight of the cut edges
+     * @param imbalance - Set to the relative excess weight of the heaviest part
+     */
+    static void evaluatePartition(
+        const Graph& graph, uint32_t nparts, const std::vector<uint32_t>& part, int64_t& cut, double& imbalance);
+
+private:
+    RankInfo world_size;
+    uint32_t total_parts;
+    Options  options;
+    Output*  partOutput;
+
+    RankInfo convertPartNum(uint32_t partNum)
+    {
+        return RankInfo(partNum / world_size.thread, partNum % world_size.thread);
+    }
+
+public:
+    MultilevelPartitioner(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~MultilevelPartitioner();
+
+    void setParams(Params& params) override;
+
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+#endif // SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
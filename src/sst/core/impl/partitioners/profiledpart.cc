@@ -0,0 +1,238 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/profiledpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+SSTProfiledPartition::SSTProfiledPartition(RankInfo mpiranks, RankInfo UNUSED(my_rank), int verbosity)
+{
+    rankcount  = mpiranks;
+    partOutput = new Output("ProfiledPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTProfiledPartition::~SSTProfiledPartition()
+{
+    delete partOutput;
+}
+
+bool
+SSTProfiledPartition::readCostFile(const std::string& file)
+{
+    ifstream in(file);
+    if ( !in.is_open() ) return false;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Reading cost file:                %s\n", file.c_str());
+
+    // Only the event_cost and clock_cost lines are used, the file may
+    // hold the output of other profiling tools as well
+    string line;
+    while ( getline(in, line) ) {
+        bool event = line.compare(0, 11, "event_cost,") == 0;
+        bool clock = line.compare(0, 11, "clock_cost,") == 0;
+        if ( !event && !clock ) continue;
+
+        vector<string> fields;
+        stringstream   ss(line);
+        string         field;
+        while ( getline(ss, field, ',') ) {
+            field.erase(0, field.find_first_not_of(' '));
+            fields.push_back(field);
+        }
+
+        // Skip the header lines
+        if ( fields.size() < 2 || fields[1].empty() || !isdigit(fields[1][0]) ) continue;
+
+        if ( event && fields.size() == 6 ) {
+            ComponentId_t id         = stoull(fields[1]);
+            uint64_t      recv_count = stoull(fields[3]);
+            uint64_t      send_count = stoull(fields[5]);
+            comp_time[COMPONENT_ID_MASK(id)] += stoull(fields[4]);
+
+            PortCost& port = port_cost[make_pair(id, fields[2])];
+            port.recv_count += recv_count;
+            port.send_count += send_count;
+
+            PortCost& comp_port = comp_port_cost[make_pair(COMPONENT_ID_MASK(id), fields[2])];
+            comp_port.recv_count += recv_count;
+            comp_port.send_count += send_count;
+        }
+        else if ( clock && fields.size() == 4 ) {
+            comp_time[COMPONENT_ID_MASK(stoull(fields[1]))] += stoull(fields[3]);
+        }
+        else {
+            partOutput->fatal(
+                CALL_INFO, 1, "Malformed line in partitioner cost file %s: %s\n", file.c_str(), line.c_str());
+        }
+    }
+    return true;
+}
+
+SSTProfiledPartition::PortCost
+SSTProfiledPartition::getPortCost(ComponentId_t id, const std::string& port)
+{
+    // Ports on anonymous subcomponents are reported with the id of the
+    // subcomponent, which is not in the ConfigGraph, so fall back to
+    // all ports with the same name on the component
+    auto found = port_cost.find(make_pair(id, port));
+    if ( found == port_cost.end() ) {
+        found = comp_port_cost.find(make_pair(COMPONENT_ID_MASK(id), port));
+        if ( found == comp_port_cost.end() ) return PortCost();
+    }
+    return found->second;
+}
+
+void
+SSTProfiledPartition::setParams(Params& params)
+{
+    MultilevelPartitioner::readOptions(params, options, partOutput);
+}
+
+void
+SSTProfiledPartition::performPartition(ConfigGraph* graph)
+{
+    // Only the rank that built the graph has components to partition
+    if ( graph->getNumComponents() == 0 ) return;
+
+    uint32_t tot_parts = rankcount.rank * rankcount.thread;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a profiled partition scheme for simulation model.\n");
+
+    if ( cost_file.empty() ) {
+        partOutput->fatal(CALL_INFO, 1, "The profiled partitioner requires --partitioner-cost-file\n");
+    }
+
+    // Read the file as given, or the per rank files written by a
+    // parallel run
+    if ( !readCostFile(cost_file) ) {
+        auto   index = cost_file.find_last_of(".");
+        string base  = index == string::npos ? cost_file : cost_file.substr(0, index);
+        string ext   = index == string::npos ? "" : cost_file.substr(index);
+        int    rank  = 0;
+        while ( readCostFile(base + to_string(rank) + ext) ) {
+            rank++;
+        }
+        if ( rank == 0 ) {
+            partOutput->fatal(CALL_INFO, 1, "Unable to open partitioner cost file %s\n", cost_file.c_str());
+        }
+    }
+
+    PartitionGraph*          pgraph  = graph->getCollapsedPartitionGraph();
+    PartitionComponentMap_t& compMap = pgraph->getComponentMap();
+    ConfigComponentMap_t&    ccomps  = graph->getComponentMap();
+    ConfigLinkMap_t&         clinks  = graph->getLinkMap();
+
+    // Components without measurements are given the average measured
+    // time per unit of configured weight
+    double   measured_time   = 0.0;
+    double   measured_weight = 0.0;
+    uint64_t unmeasured      = 0;
+    for ( auto* ccomp : ccomps ) {
+        auto found = comp_time.find(ccomp->id);
+        if ( found == comp_time.end() ) {
+            unmeasured++;
+            continue;
+        }
+        measured_time += found->second;
+        measured_weight += ccomp->weight;
+    }
+    if ( measured_time == 0.0 ) {
+        partOutput->fatal(
+            CALL_INFO, 1, "Partitioner cost file %s has no measurements for this simulation\n", cost_file.c_str());
+    }
+    double time_per_weight = measured_weight > 0.0 ? measured_time / measured_weight : 0.0;
+
+    vector<PartitionComponent*> comps;
+    vector<int64_t>             vwgt;
+    comps.reserve(pgraph->getNumComponents());
+    vwgt.reserve(pgraph->getNumComponents());
+    for ( auto* pcomp : compMap ) {
+        double cost = 0.0;
+        for ( ComponentId_t id : pcomp->group ) {
+            auto found = comp_time.find(id);
+            cost += found == comp_time.end() ? time_per_weight * ccomps[id]->weight : found->second;
+        }
+        comps.push_back(pcomp);
+        vwgt.push_back(std::max<int64_t>(1, llround(cost)));
+    }
+
+    // Pair up the ends of each link through the link lists of the
+    // partition components and weight it by the events sent across it.
+    // Unmeasured links get a weight of one.
+    vector<MultilevelPartitioner::Edge> edges;
+    unordered_map<LinkId_t, uint32_t>   first_end;
+    uint64_t                            total_events = 0;
+    for ( uint32_t i = 0; i < comps.size(); i++ ) {
+        for ( LinkId_t id : comps[i]->links ) {
+            auto found = first_end.find(id);
+            if ( found == first_end.end() ) {
+                first_end.emplace(id, i);
+                continue;
+            }
+            // Events sent by one end are received by the other, use
+            // whichever side was measured
+            const ConfigLink* link   = clinks[id];
+            PortCost          end0   = getPortCost(link->component[0], link->port[0]);
+            PortCost          end1   = getPortCost(link->component[1], link->port[1]);
+            uint64_t          events =
+                std::max(end0.send_count + end1.send_count, end0.recv_count + end1.recv_count);
+            total_events += events;
+            if ( found->second != i ) edges.push_back({ found->second, i, (int64_t)events + 1 });
+            first_end.erase(found);
+        }
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Partition Count:                  %10" PRIu32 "\n", tot_parts);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Measured handler time (s):        %10.3f\n", measured_time / 1.0e9);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Measured link events:             %10" PRIu64 "\n", total_events);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Components without measurements:  %10" PRIu64 "\n", unmeasured);
+
+    MultilevelPartitioner::Graph pg;
+    MultilevelPartitioner::buildGraph(vwgt, edges, pg);
+
+    vector<uint32_t> part;
+    MultilevelPartitioner::partitionGraph(pg, tot_parts, options, part);
+
+    for ( uint32_t i = 0; i < comps.size(); i++ ) {
+        comps[i]->rank = RankInfo(part[i] / rankcount.thread, part[i] % rankcount.thread);
+    }
+
+    // Report the expected load balance and communication
+    int64_t cut_weight;
+    double  imbalance;
+    MultilevelPartitioner::evaluatePartition(pg, tot_parts, part, cut_weight, imbalance);
+    int64_t cut_events = 0;
+    for ( auto& e : edges ) {
+        if ( part[e.a] != part[e.b] ) cut_events += e.weight - 1;
+    }
+    partOutput->verbose(CALL_INFO, 1, 0, "- Expected max/avg load:            %10.3f\n", 1.0 + imbalance);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Expected cross partition events:  %10" PRId64 "\n", cut_events);
+
+    graph->annotateRanks(pgraph);
+    delete pgraph;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Profiled partition scheme completed.\n");
+}
@@ -0,0 +1,111 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_PROFILEDPART_H
+#define SST_CORE_IMPL_PARTITONERS_PROFILEDPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevelpart.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sstpart.h"
+
+#include <map>
+#include <string>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Partitions a simulation using the costs measured in an earlier run.
+The earlier run is made with the sst.profile.handler.event.cost and
+sst.profile.handler.clock.cost profiling tools enabled and the
+profiling output written to a file.  That file is passed to this
+partitioner with --partitioner-cost-file.  If the earlier run used
+more than one rank, the per rank files (name0.ext, name1.ext, ...) are
+read when the file itself does not exist.
+
+Each component is weighted by the handler time measured for it and
+its subcomponents, and each link by the number of events sent across
+it.  Components without measurements get the average measured time per
+unit of their configured weight.  The weighted graph is then
+partitioned to balance measured work while minimizing the events that
+cross partitions.
+*/
+class SSTProfiledPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTProfiledPartition,
+        "sst",
+        "profiled",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Partitions components using handler time and link traffic measured by the cost profiling tools in an "
+        "earlier run (see --partitioner-cost-file).")
+
+    SSTProfiledPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+    ~SSTProfiledPartition();
+
+    void setCostFile(const std::string& file) override { cost_file = file; }
+
+    /** Accepts the same balance and coarsening parameters as sst.multilevel */
+    void setParams(Params& params) override;
+
+    /**
+       Performs a partition of an SST simulation configuration.  Port
+       names are only available in the ConfigGraph, which is collapsed
+       here so that no_cut links are still honored.
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(ConfigGraph* graph) override;
+
+    bool requiresConfigGraph() override { return true; }
+    bool spawnOnAllRanks() override { return false; }
+
+private:
+    typedef std::pair<ComponentId_t, std::string> PortKey_t;
+
+    struct PortCost
+    {
+        uint64_t recv_count;
+        uint64_t send_count;
+
+        PortCost() : recv_count(0), send_count(0) {}
+    };
+
+    /** Number of ranks in the simulation */
+    RankInfo    rankcount;
+    /** Output object to print partitioning information */
+    Output*     partOutput;
+    std::string cost_file;
+    /** Options for the multilevel partition of the weighted graph */
+    MultilevelPartitioner::Options options;
+
+    /** Measured handler time (ns), by top level component id */
+    std::map<ComponentId_t, uint64_t> comp_time;
+    /** Measured events, by (sub)component id and port */
+    std::map<PortKey_t, PortCost>     port_cost;
+    /** Measured events, by top level component id and port */
+    std::map<PortKey_t, PortCost>     comp_port_cost;
+
+    bool     readCostFile(const std::string& file);
+    PortCost getPortCost(ComponentId_t id, const std::string& port);
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_PROFILEDPART_H
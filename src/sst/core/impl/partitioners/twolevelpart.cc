@@ -0,0 +1,207 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/twolevelpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/factory.h"
+#include "sst/core/output.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+TwoLevelPartition::TwoLevelPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity) :
+    rank_partitioner(nullptr),
+    thread_partitioner(nullptr),
+    world_size(total_ranks),
+    my_rank(my_rank),
+    verbosity(verbosity)
+{
+    partOutput = new Output("TwoLevelPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+TwoLevelPartition::~TwoLevelPartition()
+{
+    delete rank_partitioner;
+    delete thread_partitioner;
+    delete partOutput;
+}
+
+void
+TwoLevelPartition::setLevelPartitioners(const std::string& rank_name, const std::string& thread_name)
+{
+    Factory* factory   = Factory::getFactory();
+    rank_partitioner   = factory->CreatePartitioner(rank_name, RankInfo(world_size.rank, 1), my_rank, verbosity);
+    thread_partitioner = factory->CreatePartitioner(thread_name, RankInfo(1, world_size.thread), my_rank, verbosity);
+    if ( thread_partitioner->requiresConfigGraph() ) {
+        partOutput->fatal(
+            CALL_INFO, 1,
+            "Thread level partitioner %s requires the ConfigGraph, but the thread level is partitioned on a "
+            "PartitionGraph of each rank\n",
+            thread_name.c_str());
+    }
+}
+
+void
+TwoLevelPartition::setCostFile(const std::string& file)
+{
+    if ( rank_partitioner ) rank_partitioner->setCostFile(file);
+    if ( thread_partitioner ) thread_partitioner->setCostFile(file);
+}
+
+void
+TwoLevelPartition::setParams(Params& params)
+{
+    if ( rank_partitioner ) rank_partitioner->setParams(params);
+    if ( thread_partitioner ) thread_partitioner->setParams(params);
+}
+
+void
+TwoLevelPartition::performPartition(ConfigGraph* graph)
+{
+    // Only the rank that built the graph has components to partition
+    if ( graph->getNumComponents() == 0 ) return;
+
+    if ( rank_partitioner == nullptr ) {
+        partOutput->fatal(
+            CALL_INFO, 1, "sst.twolevel needs --thread-partitioner to name the partitioner for the thread level\n");
+    }
+
+    partOutput->verbose(
+        CALL_INFO, 1, 0, "Performing a two-level partition across %" PRIu32 " ranks of %" PRIu32 " threads.\n",
+        world_size.rank, world_size.thread);
+
+    // Rank level.  ConfigGraph partitioners annotate the graph
+    // directly, so copy their result into the collapsed graph.
+    PartitionGraph* pgraph;
+    if ( rank_partitioner->requiresConfigGraph() ) {
+        rank_partitioner->performPartition(graph);
+        pgraph                       = graph->getCollapsedPartitionGraph();
+        ConfigComponentMap_t& ccomps = graph->getComponentMap();
+        for ( auto* pcomp : pgraph->getComponentMap() ) {
+            pcomp->rank = ccomps[*pcomp->group.begin()]->rank;
+        }
+    }
+    else {
+        pgraph = graph->getCollapsedPartitionGraph();
+        rank_partitioner->performPartition(pgraph);
+    }
+
+    PartitionComponentMap_t& compMap = pgraph->getComponentMap();
+    PartitionLinkMap_t&      linkMap = pgraph->getLinkMap();
+
+    vector<PartitionComponent*> comps;
+    vector<vector<uint32_t>>    rank_comps(world_size.rank);
+    for ( auto* pcomp : compMap ) {
+        if ( pcomp->rank.rank >= world_size.rank ) {
+            partOutput->fatal(
+                CALL_INFO, 1, "Rank level partitioner assigned component %" PRIu64 " to invalid rank %" PRIu32 "\n",
+                pcomp->id, pcomp->rank.rank);
+        }
+        rank_comps[pcomp->rank.rank].push_back(comps.size());
+        comps.push_back(pcomp);
+    }
+
+    // Find both ends of every link through the link lists of the
+    // components, since the component fields of the links may still
+    // hold subcomponent ids.  Links are kept in id order.
+    struct LinkEnds
+    {
+        LinkId_t id;
+        uint32_t end[2];
+    };
+    vector<LinkEnds>                  links;
+    unordered_map<LinkId_t, uint32_t> first_end;
+    for ( uint32_t i = 0; i < comps.size(); i++ ) {
+        for ( LinkId_t id : comps[i]->links ) {
+            auto found = first_end.find(id);
+            if ( found == first_end.end() ) {
+                first_end.emplace(id, i);
+                continue;
+            }
+            links.push_back({ id, { found->second, i } });
+            first_end.erase(found);
+        }
+    }
+    unordered_map<LinkId_t, uint32_t>().swap(first_end);
+    sort(links.begin(), links.end(), [](const LinkEnds& a, const LinkEnds& b) { return a.id < b.id; });
+
+    vector<vector<uint32_t>> rank_links(world_size.rank);
+    uint64_t                 rank_cut = 0;
+    for ( uint32_t l = 0; l < links.size(); l++ ) {
+        uint32_t rank0 = comps[links[l].end[0]]->rank.rank;
+        if ( rank0 == comps[links[l].end[1]]->rank.rank )
+            rank_links[rank0].push_back(l);
+        else
+            rank_cut++;
+    }
+
+    // Thread level.  Partition each rank's components on a graph of
+    // just that rank.
+    vector<uint32_t> local(comps.size());
+    uint64_t         thread_cut = 0;
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        if ( rank_comps[r].empty() ) continue;
+
+        PartitionGraph           sub;
+        PartitionComponentMap_t& sub_comps = sub.getComponentMap();
+        PartitionLinkMap_t&      sub_links = sub.getLinkMap();
+
+        for ( uint32_t i = 0; i < rank_comps[r].size(); i++ ) {
+            PartitionComponent* pcomp = comps[rank_comps[r][i]];
+            PartitionComponent* scomp = sub_comps.insert(new PartitionComponent((ComponentId_t)i));
+            scomp->weight             = pcomp->weight;
+            local[rank_comps[r][i]]   = i;
+        }
+        for ( uint32_t l : rank_links[r] ) {
+            uint32_t       a     = local[links[l].end[0]];
+            uint32_t       b     = local[links[l].end[1]];
+            PartitionLink& plink = sub_links.insert(linkMap[links[l].id]);
+            plink.component[0]   = a;
+            plink.component[1]   = b;
+            sub_comps[a]->links.push_back(plink.id);
+            sub_comps[b]->links.push_back(plink.id);
+        }
+
+        thread_partitioner->performPartition(&sub);
+
+        for ( uint32_t i = 0; i < rank_comps[r].size(); i++ ) {
+            uint32_t thread = sub_comps[i]->rank.thread;
+            if ( sub_comps[i]->rank.rank != 0 || thread >= world_size.thread ) {
+                partOutput->fatal(
+                    CALL_INFO, 1, "Thread level partitioner assigned component to invalid thread %" PRIu32 "\n",
+                    thread);
+            }
+            comps[rank_comps[r][i]]->rank = RankInfo(r, thread);
+        }
+        for ( uint32_t l : rank_links[r] ) {
+            if ( sub_comps[local[links[l].end[0]]]->rank != sub_comps[local[links[l].end[1]]]->rank ) thread_cut++;
+        }
+
+        for ( auto* scomp : sub_comps ) {
+            delete scomp;
+        }
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Links cut between ranks:          %10" PRIu64 "\n", rank_cut);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Links cut between threads:        %10" PRIu64 "\n", thread_cut);
+
+    graph->annotateRanks(pgraph);
+    delete pgraph;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Two-level partition scheme completed.\n");
+}
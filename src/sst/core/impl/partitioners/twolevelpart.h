@@ -0,0 +1,88 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_TWOLEVELPART_H
+#define SST_CORE_IMPL_PARTITONERS_TWOLEVELPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+#include <string>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Two-level partition of an SST simulation configuration.  Cuts between
+MPI ranks are much more expensive than cuts between threads in the
+same rank, so the graph is first partitioned across ranks only, then
+the components of each rank are partitioned across that rank's
+threads.
+
+Any partitioner can be used for the rank level.  It is created with
+one thread per rank.  The thread level partitioner is created with a
+single rank and is run once for each rank on a PartitionGraph holding
+only that rank's components and the links between them, so it must
+not require the ConfigGraph.
+
+The partitioners for the two levels are named with
+setLevelPartitioners(), which is called with --partitioner and
+--thread-partitioner when --thread-partitioner is given.
+*/
+class TwoLevelPartition : public SST::Partition::SSTPartitioner
+{
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        TwoLevelPartition,
+        "sst",
+        "twolevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Partitions across ranks with --partitioner, then across the threads of each rank with "
+        "--thread-partitioner.  Selected automatically when --thread-partitioner is given.")
+
+    /**
+       Creates a new two-level partition scheme.
+       \param total_ranks Number of ranks and threads in the simulation
+       \param my_rank The rank of this process
+       \param verbosity The level of information to output
+    */
+    TwoLevelPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~TwoLevelPartition();
+
+    void setLevelPartitioners(const std::string& rank_partitioner, const std::string& thread_partitioner) override;
+
+    void setCostFile(const std::string& file) override;
+
+    void setParams(Params& params) override;
+
+    void performPartition(ConfigGraph* graph) override;
+
+    bool requiresConfigGraph() override { return true; }
+    bool spawnOnAllRanks() override { return false; }
+
+private:
+    SST::Partition::SSTPartitioner* rank_partitioner;
+    SST::Partition::SSTPartitioner* thread_partitioner;
+    RankInfo                        world_size;
+    RankInfo                        my_rank;
+    int                             verbosity;
+    Output*                         partOutput;
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_TWOLEVELPART_H
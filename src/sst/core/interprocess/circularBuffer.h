@@ -47,6 +47,10 @@ public:
         int loop_counter = 0;
 
         while ( true ) {
+            // Spin for a while, then sleep until a writer notifies us
+            const bool sleep = loop_counter >= SSTEventCount::spinLimit;
+            uint32_t   key   = sleep ? dataReady.prepareWait() : 0;
+
             bufferMutex.lock();
 
             if ( readIndex != writeIndex ) {
@@ -54,11 +58,15 @@ public:
                 readIndex      = (readIndex + 1) % buffSize;
 
                 bufferMutex.unlock();
+                if ( sleep ) dataReady.cancelWait();
+                spaceReady.notify();
                 return result;
             }
 
             bufferMutex.unlock();
-            bufferMutex.processorPause(loop_counter++);
+            if ( sleep ) dataReady.wait(key);
+            else
+                bufferMutex.processorPause(loop_counter++);
         }
     }
 
@@ -70,6 +78,7 @@ public:
                 readIndex = (readIndex + 1) % buffSize;
 
                 bufferMutex.unlock();
+                spaceReady.notify();
                 return true;
             }
 
@@ -84,6 +93,10 @@ public:
         int loop_counter = 0;
 
         while ( true ) {
+            // Spin for a while, then sleep until a reader notifies us
+            const bool sleep = loop_counter >= SSTEventCount::spinLimit;
+            uint32_t   key   = sleep ? spaceReady.prepareWait() : 0;
+
             bufferMutex.lock();
 
             if ( ((writeIndex + 1) % buffSize) != readIndex ) {
@@ -92,14 +105,50 @@ public:
 
                 __sync_synchronize();
                 bufferMutex.unlock();
+                if ( sleep ) spaceReady.cancelWait();
+                dataReady.notify();
                 return;
             }
 
             bufferMutex.unlock();
-            bufferMutex.processorPause(loop_counter++);
+            if ( sleep ) spaceReady.wait(key);
+            else
+                bufferMutex.processorPause(loop_counter++);
         }
     }
 
+    /** Reads up to max messages, blocking until at least one is available */
+    size_t readBatch(T* result, size_t max)
+    {
+        if ( max == 0 ) return 0;
+        result[0] = read();
+        return 1 + readBatchNB(result + 1, max - 1);
+    }
+
+    /** Reads up to max messages without blocking, returns the number read */
+    size_t readBatchNB(T* result, size_t max)
+    {
+        size_t count = 0;
+        if ( bufferMutex.try_lock() ) {
+            while ( count < max && readIndex != writeIndex ) {
+                result[count++] = buffer[readIndex];
+                readIndex       = (readIndex + 1) % buffSize;
+            }
+
+            bufferMutex.unlock();
+            if ( count != 0 ) spaceReady.notify();
+        }
+
+        return count;
+    }
+
+    /** Writes all count messages, blocking until there is space */
+    void writeBatch(const T* v, size_t count)
+    {
+        for ( size_t i = 0; i < count; ++i )
+            write(v[i]);
+    }
+
     ~CircularBuffer() {}
 
     void clearBuffer()
@@ -108,14 +157,17 @@ public:
         readIndex = writeIndex;
         __sync_synchronize();
         bufferMutex.unlock();
+        spaceReady.notify();
     }
 
 private:
-    SSTMutex bufferMutex;
-    size_t   buffSize;
-    size_t   readIndex;
-    size_t   writeIndex;
-    T        buffer[0];
+    SSTMutex      bufferMutex;
+    SSTEventCount dataReady;
+    SSTEventCount spaceReady;
+    size_t        buffSize;
+    size_t        readIndex;
+    size_t        writeIndex;
+    T             buffer[0];
 };
 
 } // namespace Interprocess
@@ -13,6 +13,8 @@
 #define SST_CORE_INTERPROCESS_IPCTUNNEL_H
 
 #include "sst/core/interprocess/circularBuffer.h"
+#include "sst/core/interprocess/payloadSlab.h"
+#include "sst/core/interprocess/spscCircularBuffer.h"
 
 #include <cstdio>
 #include <cstring>
@@ -36,19 +38,22 @@ extern uint32_t globalIPCTunnelCount;
  *
  * @tparam ShareDataType  Type to put in the shared data region
  * @tparam MsgType Type of messages being sent in the circular buffers
+ * @tparam CircBuff_t Type of the circular buffers.  SPSCCircularBuffer
+ *         is faster, but each buffer must have only one writer and one
+ *         reader, and its size must be a power of two.
  */
-template <typename ShareDataType, typename MsgType>
+template <typename ShareDataType, typename MsgType, typename CircBuff_t = CircularBuffer<MsgType>>
 class IPCTunnel
 {
 
-    typedef SST::Core::Interprocess::CircularBuffer<MsgType> CircBuff_t;
-
     struct InternalSharedData
     {
         volatile uint32_t expectedChildren;
         size_t            shmSegSize;
         size_t            numBuffers;
-        size_t            offsets[0]; // Actual size:  numBuffers + 2
+        // Actual size:  numBuffers + 2.  The last one points to the
+        // payload slab, or is 0 if there is none
+        size_t            offsets[0];
     };
 
 public:
@@ -57,11 +62,14 @@ public:
      * @param comp_id Component ID of owner
      * @param numBuffers Number of buffers for which we should tunnel
      * @param bufferSize How large each core's buffer should be
+     * @param slabSize Bytes of payload data the payload slab can hold, 0 for no slab
      */
-    IPCTunnel(uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1) :
+    IPCTunnel(
+        uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1, size_t slabSize = 0) :
         master(true),
         shmPtr(nullptr),
-        fd(-1)
+        fd(-1),
+        slab(nullptr)
     {
         char key[256];
         memset(key, '\0', sizeof(key));
@@ -84,7 +92,7 @@ public:
             exit(1);
         }
 
-        shmSize = calculateShmemSize(numBuffers, bufferSize);
+        shmSize = calculateShmemSize(numBuffers, bufferSize, slabSize);
         if ( ftruncate(fd, shmSize) ) {
             // Not using Output because IPC means Output might not be available
             fprintf(stderr, "Resizing shared file '%s' failed: %s\n", filename.c_str(), strerror(errno));
@@ -101,7 +109,7 @@ public:
         memset(shmPtr, '\0', shmSize);
 
         /* Construct our private buffer first.  Used for our communications */
-        auto resResult        = reserveSpace<InternalSharedData>((1 + numBuffers) * sizeof(size_t));
+        auto resResult        = reserveSpace<InternalSharedData>((2 + numBuffers) * sizeof(size_t));
         isd                   = resResult.second;
         isd->expectedChildren = expectedChildren;
         isd->shmSegSize       = shmSize;
@@ -123,13 +131,22 @@ public:
             if ( !cPtr->setBufferSize(bufferSize) ) exit(1);
             circBuffs.push_back(cPtr);
         }
+
+        /* Construct the payload slab */
+        isd->offsets[1 + numBuffers] = 0;
+        if ( slabSize != 0 ) {
+            auto slabResult = reserveSpace<PayloadSlab>(PayloadSlab::regionSize(slabSize) - sizeof(PayloadSlab));
+            isd->offsets[1 + numBuffers] = slabResult.first;
+            slab                         = slabResult.second;
+            if ( !slab->setCapacity(slabSize) ) exit(1);
+        }
     }
 
     /**
      * Access an existing Tunnel
      * @param region_name Name of the shared-memory region to access
      */
-    IPCTunnel(const std::string& region_name) : master(false), shmPtr(nullptr), fd(-1)
+    IPCTunnel(const std::string& region_name) : master(false), shmPtr(nullptr), fd(-1), slab(nullptr)
     {
         fd       = shm_open(region_name.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
         filename = region_name;
@@ -163,6 +180,9 @@ public:
         for ( size_t c = 0; c < isd->numBuffers; c++ ) {
             circBuffs.push_back((CircBuff_t*)((uint8_t*)shmPtr + isd->offsets[c + 1]));
         }
+        if ( isd->offsets[isd->numBuffers + 1] != 0 ) {
+            slab = (PayloadSlab*)((uint8_t*)shmPtr + isd->offsets[isd->numBuffers + 1]);
+        }
 
         /* Clean up if we're the last to attach */
         if ( --isd->expectedChildren == 0 ) { shm_unlink(filename.c_str()); }
@@ -182,11 +202,13 @@ public:
             for ( CircBuff_t* cb : circBuffs ) {
                 cb->~CircBuff_t();
             }
+            if ( slab ) slab->~PayloadSlab();
         }
         if ( shmPtr ) {
             munmap(shmPtr, shmSize);
             shmPtr  = nullptr;
             shmSize = 0;
+            slab    = nullptr;
         }
         if ( fd >= 0 ) {
             close(fd);
@@ -199,6 +221,9 @@ public:
     /** return a pointer to the ShareDataType region */
     ShareDataType* getSharedData() { return sharedData; }
 
+    /** return a pointer to the payload slab, or nullptr if the tunnel has none */
+    PayloadSlab* getPayloadSlab() { return slab; }
+
     /** Blocks until space is available **/
     void writeMessage(size_t core, const MsgType& command) { circBuffs[core]->write(command); }
 
@@ -208,6 +233,24 @@ public:
     /** Non-blocking version of readMessage **/
     bool readMessageNB(size_t buffer, MsgType* result) { return circBuffs[buffer]->readNB(result); }
 
+    /** Blocks until all messages are written **/
+    void writeMessages(size_t core, const MsgType* commands, size_t count)
+    {
+        circBuffs[core]->writeBatch(commands, count);
+    }
+
+    /** Blocks until at least one of up to max messages is read **/
+    size_t readMessages(size_t buffer, MsgType* result, size_t max)
+    {
+        return circBuffs[buffer]->readBatch(result, max);
+    }
+
+    /** Non-blocking read of up to max messages **/
+    size_t readMessagesNB(size_t buffer, MsgType* result, size_t max)
+    {
+        return circBuffs[buffer]->readBatchNB(result, max);
+    }
+
     /** Empty the messages in the buffer **/
     void clearBuffer(size_t core) { circBuffs[core]->clearBuffer(); }
 
@@ -215,25 +258,43 @@ private:
     template <typename T>
     std::pair<size_t, T*> reserveSpace(size_t extraSpace = 0)
     {
-        size_t space = sizeof(T) + extraSpace;
-        if ( ((nextAllocPtr + space) - (uint8_t*)shmPtr) > shmSize ) return std::make_pair<size_t, T*>(0, nullptr);
-        T* ptr = (T*)nextAllocPtr;
-        nextAllocPtr += space;
+        // Align by offset: the region is page aligned in every process
+        size_t offset = alignOffset((size_t)(nextAllocPtr - (uint8_t*)shmPtr), allocAlignment<T>());
+        size_t space  = sizeof(T) + extraSpace;
+        if ( offset + space > shmSize ) return std::make_pair<size_t, T*>(0, nullptr);
+        T* ptr       = (T*)((uint8_t*)shmPtr + offset);
+        nextAllocPtr = (uint8_t*)ptr + space;
         new (ptr) T(); // Call constructor if need be
-        return std::make_pair((uint8_t*)ptr - (uint8_t*)shmPtr, ptr);
+        return std::make_pair(offset, ptr);
+    }
+
+    /* Allocations are at least cache line aligned, so structures used by
+     * different processes do not share a line */
+    template <typename T>
+    static constexpr size_t allocAlignment()
+    {
+        return alignof(T) > cacheLineSize ? alignof(T) : cacheLineSize;
     }
 
-    size_t static calculateShmemSize(size_t numBuffers, size_t bufferSize)
+    static size_t alignOffset(size_t offset, size_t align) { return (offset + align - 1) & ~(align - 1); }
+
+    size_t static calculateShmemSize(size_t numBuffers, size_t bufferSize, size_t slabSize)
     {
         long page_size = sysconf(_SC_PAGESIZE);
 
-        /* Count how many pages are needed, at minimum */
-        size_t isd    = 1 + ((sizeof(InternalSharedData) + (1 + numBuffers) * sizeof(size_t)) / page_size);
-        size_t buffer = 1 + ((sizeof(CircBuff_t) + bufferSize * sizeof(MsgType)) / page_size);
-        size_t shdata = 1 + ((sizeof(ShareDataType) + sizeof(InternalSharedData)) / page_size);
+        /* Count how many pages are needed, at minimum, including the
+         * padding reserveSpace() may add to align each allocation */
+        size_t isdBytes = sizeof(InternalSharedData) + (2 + numBuffers) * sizeof(size_t);
+        size_t bufBytes = sizeof(CircBuff_t) + bufferSize * sizeof(MsgType);
+        size_t shdBytes = sizeof(ShareDataType) + sizeof(InternalSharedData);
+        size_t isd      = 1 + (allocAlignment<InternalSharedData>() + isdBytes) / page_size;
+        size_t buffer   = 1 + (allocAlignment<CircBuff_t>() + bufBytes) / page_size;
+        size_t shdata   = 1 + (allocAlignment<ShareDataType>() + shdBytes) / page_size;
+        size_t payload  =
+            slabSize == 0 ? 0 : 1 + (allocAlignment<PayloadSlab>() + PayloadSlab::regionSize(slabSize)) / page_size;
 
         /* Alloc 2 extra pages, just in case */
-        return (2 + isd + shdata + numBuffers * buffer) * page_size;
+        return (2 + isd + shdata + numBuffers * buffer + payload) * page_size;
     }
 
 protected:
@@ -241,6 +302,8 @@ protected:
     ShareDataType* sharedData;
 
 private:
+    static constexpr size_t cacheLineSize = 64;
+
     bool  master;
     void* shmPtr;
     int   fd;
@@ -250,6 +313,7 @@ private:
     size_t                   shmSize;
     InternalSharedData*      isd;
     std::vector<CircBuff_t*> circBuffs;
+    PayloadSlab*             slab;
 };
 
 } // namespace Interprocess
@@ -45,8 +45,10 @@ public:
      * @param numBuffers Number of buffers for which we should tunnel
      * @param bufferSize How large each core's buffer should be
      * @expectedChildren How many child processes will connect to the tunnel
+     * @param slabSize Bytes of payload data the tunnel's payload slab can hold, 0 for no slab
      */
-    MMAPParent(uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1) :
+    MMAPParent(
+        uint32_t comp_id, size_t numBuffers, size_t bufferSize, uint32_t expectedChildren = 1, size_t slabSize = 0) :
         shmPtr(nullptr),
         fd(-1)
     {
@@ -72,7 +74,8 @@ public:
             exit(1);
         }
 
-        tunnel  = new TunnelType(numBuffers, bufferSize, expectedChildren);
+        tunnel = new TunnelType(numBuffers, bufferSize, expectedChildren);
+        if ( slabSize != 0 ) tunnel->setPayloadSlabSize(slabSize);
         shmSize = tunnel->getTunnelSize();
 
         if ( ftruncate(fd, shmSize) ) {
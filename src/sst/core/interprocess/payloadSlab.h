@@ -0,0 +1,251 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_INTERPROCESS_PAYLOADSLAB_H
+#define SST_CORE_INTERPROCESS_PAYLOADSLAB_H
+
+/*
+ * Like tunneldef.h, this may be compiled into an Intel Pin3 tool, so
+ * it avoids c++11 and runtime type info
+ */
+
+#include "sstmutex.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+namespace SST {
+namespace Core {
+namespace Interprocess {
+
+/**
+ * Refers to a payload in a PayloadSlab.  This is what is sent
+ * through the circular buffers, as part of a message, in place of the
+ * payload itself.
+ */
+struct PayloadHandle
+{
+    /** Offset of the payload from the start of the slab's data.  0 if
+     * the handle does not refer to a payload */
+    size_t offset;
+    /** Length of the payload in bytes */
+    size_t length;
+};
+
+/**
+ * Allocator for large, variable sized payloads in the shared region
+ * of a tunnel, so they can be passed between processes without being
+ * copied through a circular buffer.  The writer allocates a payload,
+ * fills it in place and sends its PayloadHandle through a buffer.
+ * The reader gets a pointer to the payload from the handle and
+ * releases the payload when it is done with it.
+ *
+ * The slab is split into chunks, and each payload takes a run of
+ * chunks found first-fit, starting after the last allocation.  Each
+ * payload has a reference count, set when it is allocated, so a
+ * payload can be sent to several readers and is freed when the last
+ * one releases it.  A writer that runs out of space sleeps until a
+ * payload is released.
+ *
+ * The slab lives in shared memory and is followed by a map of the
+ * chunks and then the data.  Its size must be given by regionSize().
+ */
+class PayloadSlab
+{
+
+public:
+    /** Size of the chunks payloads are made of */
+    static const size_t chunkSize = 4096;
+
+    /** Bytes of the shared region needed for a slab with capacity bytes
+     * of data */
+    static size_t regionSize(size_t capacity)
+    {
+        // Extra chunk to align the data
+        return sizeof(PayloadSlab) + chunksFor(capacity) + chunkSize + chunksFor(capacity) * chunkSize;
+    }
+
+    PayloadSlab()
+    {
+        numChunks = 0;
+        nextChunk = 0;
+    }
+
+    /** Sets the capacity once the slab has been placed in a region of
+     * regionSize(capacity) bytes */
+    bool setCapacity(size_t capacity)
+    {
+        if ( numChunks != 0 ) {
+            fprintf(stderr, "Already specified size for payload slab\n");
+            return false;
+        }
+
+        numChunks = chunksFor(capacity);
+        memset(chunkMap(), 0, numChunks);
+        __sync_synchronize();
+        return true;
+    }
+
+    /** Returns the number of bytes of data the slab can hold */
+    size_t getCapacity() { return numChunks * chunkSize; }
+
+    /** Returns the size of the largest payload that fits in the slab */
+    size_t getMaxPayloadSize() { return numChunks == 0 ? 0 : numChunks * chunkSize - headerSize; }
+
+    /**
+     * Allocates a payload, blocking until there is space
+     *
+     * @param length size of the payload in bytes
+     * @param refs number of release() calls that free the payload
+     * @return handle to the payload, with an offset of 0 if it can never fit
+     */
+    PayloadHandle allocate(size_t length, uint32_t refs = 1)
+    {
+        PayloadHandle handle;
+        if ( length > getMaxPayloadSize() ) {
+            fprintf(
+                stderr, "Payload of %zu bytes does not fit in a slab of %zu bytes\n", length, numChunks * chunkSize);
+            handle.offset = 0;
+            handle.length = 0;
+            return handle;
+        }
+
+        int loop_counter = 0;
+        while ( !allocateNB(length, &handle, refs) ) {
+            if ( loop_counter < SSTEventCount::spinLimit ) {
+                SSTMutex::processorPause(loop_counter++);
+                continue;
+            }
+
+            uint32_t key = spaceFreed.prepareWait();
+            if ( allocateNB(length, &handle, refs) ) {
+                spaceFreed.cancelWait();
+                break;
+            }
+            spaceFreed.wait(key);
+        }
+        return handle;
+    }
+
+    /**
+     * Allocates a payload if there is space
+     *
+     * @param length size of the payload in bytes
+     * @param handle set to the allocated payload
+     * @param refs number of release() calls that free the payload
+     * @return whether the payload was allocated
+     */
+    bool allocateNB(size_t length, PayloadHandle* handle, uint32_t refs = 1)
+    {
+        const size_t needed = chunksFor(length + headerSize);
+        if ( needed > numChunks ) return false;
+
+        slabMutex.lock();
+        uint8_t* map   = chunkMap();
+        size_t   start = nextChunk + needed <= numChunks ? nextChunk : 0;
+        size_t   found = numChunks;
+        // Two passes at most: from the last allocation, then from the start
+        for ( size_t pass = 0; pass < 2 && found == numChunks; ++pass ) {
+            size_t end = pass == 0 ? numChunks : std::min(nextChunk + needed, numChunks);
+            size_t run = 0;
+            for ( size_t c = start; c < end; ++c ) {
+                if ( map[c] ) { run = 0; }
+                else if ( ++run == needed ) {
+                    found = c + 1 - needed;
+                    break;
+                }
+            }
+            start = 0;
+        }
+
+        if ( found == numChunks ) {
+            slabMutex.unlock();
+            return false;
+        }
+
+        memset(map + found, 1, needed);
+        nextChunk = found + needed == numChunks ? 0 : found + needed;
+        slabMutex.unlock();
+
+        BlockHeader* block = (BlockHeader*)(data() + found * chunkSize);
+        block->chunks      = needed;
+        __atomic_store_n(&block->refs, refs, __ATOMIC_RELEASE);
+
+        handle->offset = found * chunkSize + headerSize;
+        handle->length = length;
+        return true;
+    }
+
+    /** Returns a pointer to the payload in this process */
+    void* getPayload(const PayloadHandle& handle) { return data() + handle.offset; }
+
+    /**
+     * Drops one reference to the payload and frees it if it was the last.
+     *
+     * Each reference must be released exactly once.  Releasing a freed
+     * payload is detected and aborts until its chunks are allocated
+     * again; after that it is undefined, as it drops a reference to the
+     * new payload.
+     */
+    void release(const PayloadHandle& handle)
+    {
+        BlockHeader* block = (BlockHeader*)(data() + handle.offset - headerSize);
+        uint32_t     refs  = __atomic_fetch_sub(&block->refs, 1, __ATOMIC_ACQ_REL);
+        if ( refs == 0 ) {
+            fprintf(
+                stderr, "Payload at offset %zu of the payload slab was released after it was freed\n", handle.offset);
+            abort();
+        }
+        if ( refs != 1 ) return;
+
+        slabMutex.lock();
+        memset(chunkMap() + (handle.offset - headerSize) / chunkSize, 0, block->chunks);
+        slabMutex.unlock();
+        spaceFreed.notify();
+    }
+
+private:
+    // Start of each payload's first chunk.  Padded so payloads are
+    // cache line aligned
+    struct BlockHeader
+    {
+        uint32_t refs;
+        uint32_t chunks;
+    };
+    static const size_t headerSize = 64;
+
+    static size_t chunksFor(size_t bytes) { return (bytes + chunkSize - 1) / chunkSize; }
+
+    // One byte per chunk, non-zero if the chunk is in use
+    uint8_t* chunkMap() { return (uint8_t*)(this + 1); }
+
+    // The region is mapped at a page boundary in every process, so
+    // aligning by address gives every process the same layout
+    uint8_t* data()
+    {
+        uintptr_t start = (uintptr_t)(chunkMap() + numChunks);
+        return (uint8_t*)((start + chunkSize - 1) & ~(uintptr_t)(chunkSize - 1));
+    }
+
+    SSTMutex      slabMutex;
+    SSTEventCount spaceFreed;
+    size_t        numChunks;
+    size_t        nextChunk;
+};
+
+} // namespace Interprocess
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_INTERPROCESS_PAYLOADSLAB_H
@@ -22,3 +22,9 @@ typedef SST::Core::Interprocess::TunnelDef<int, int> testtunnel;
 
 template class SST::Core::Interprocess::SHMParent<testtunnel>;
 template class SST::Core::Interprocess::SHMChild<testtunnel>;
+
+typedef SST::Core::Interprocess::TunnelDef<int, int, SST::Core::Interprocess::SPSCCircularBuffer<int>> testspsctunnel;
+
+template class SST::Core::Interprocess::TunnelDef<int, int, SST::Core::Interprocess::SPSCCircularBuffer<int>>;
+template class SST::Core::Interprocess::SHMParent<testspsctunnel>;
+template class SST::Core::Interprocess::SHMChild<testspsctunnel>;
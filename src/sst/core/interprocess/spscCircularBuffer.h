@@ -0,0 +1,277 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_INTERPROCESS_SPSCCIRCULARBUFFER_H
+#define SST_CORE_INTERPROCESS_SPSCCIRCULARBUFFER_H
+
+/*
+ * Like tunneldef.h, this may be compiled into an Intel Pin3 tool, so
+ * it uses the compiler's __atomic builtins rather than <atomic>
+ */
+
+#include "sstmutex.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace SST {
+namespace Core {
+namespace Interprocess {
+
+#define SST_CORE_INTERPROCESS_CACHE_LINE 64
+
+/**
+ * Lock-free circular buffer for exactly one writer and one reader,
+ * which are usually in different processes.  It has the interface of
+ * CircularBuffer, plus non-blocking writes and batch reads and
+ * writes, and can replace it in TunnelDef and IPCTunnel.
+ *
+ * The read and write indices count every message ever read or
+ * written and are wrapped with a mask, so the buffer size must be a
+ * power of two, and all of its entries can be in use at once.  The
+ * indices are on separate cache lines.  Each side also keeps its
+ * own copy of the other side's index and only reloads it when the
+ * buffer looks full (writer) or empty (reader).
+ *
+ * A blocked reader or writer spins briefly and then sleeps on an
+ * SSTEventCount until the other side makes progress.
+ */
+template <typename T>
+class SPSCCircularBuffer
+{
+
+public:
+    SPSCCircularBuffer(size_t mSize = 0)
+    {
+        buffSize   = 0;
+        mask       = 0;
+        writeIndex = 0;
+        readCache  = 0;
+        readIndex  = 0;
+        writeCache = 0;
+        if ( mSize != 0 ) setBufferSize(mSize);
+    }
+
+    bool setBufferSize(const size_t bufferSize)
+    {
+        if ( buffSize != 0 ) {
+            fprintf(stderr, "Already specified size for buffer\n");
+            return false;
+        }
+        if ( bufferSize == 0 || (bufferSize & (bufferSize - 1)) != 0 ) {
+            fprintf(stderr, "Size of a lock-free buffer must be a power of two, not %zu\n", bufferSize);
+            return false;
+        }
+
+        buffSize = bufferSize;
+        mask     = bufferSize - 1;
+        __sync_synchronize();
+        return true;
+    }
+
+    /** Blocks until a message is available.  Reader only. */
+    T read()
+    {
+        const size_t r = __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
+        waitReadable(r);
+
+        const T result = buffer[r & mask];
+        __atomic_store_n(&readIndex, r + 1, __ATOMIC_RELEASE);
+        spaceReady.notify();
+        return result;
+    }
+
+    /** Reads a message if one is available.  Reader only. */
+    bool readNB(T* result) { return readBatchNB(result, 1) == 1; }
+
+    /**
+     * Reads up to max messages, blocking until at least one is
+     * available.  Reader only.
+     *
+     * @return number of messages read
+     */
+    size_t readBatch(T* result, size_t max)
+    {
+        if ( max == 0 ) return 0;
+        waitReadable(__atomic_load_n(&readIndex, __ATOMIC_RELAXED));
+        return readBatchNB(result, max);
+    }
+
+    /**
+     * Reads up to max messages without blocking.  Reader only.
+     *
+     * @return number of messages read
+     */
+    size_t readBatchNB(T* result, size_t max)
+    {
+        const size_t r     = __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
+        const size_t count = std::min(max, readable(r, max));
+        if ( count == 0 ) return 0;
+
+        // Copy in at most two pieces, before and after the wrap
+        const size_t start = r & mask;
+        const size_t first = std::min(count, buffSize - start);
+        std::copy(buffer + start, buffer + start + first, result);
+        std::copy(buffer, buffer + (count - first), result + first);
+
+        __atomic_store_n(&readIndex, r + count, __ATOMIC_RELEASE);
+        spaceReady.notify();
+        return count;
+    }
+
+    /** Blocks until there is space for the message.  Writer only. */
+    void write(const T& v)
+    {
+        while ( !writeNB(v) ) {
+            waitWritable(__atomic_load_n(&writeIndex, __ATOMIC_RELAXED));
+        }
+    }
+
+    /** Writes the message if there is space.  Writer only. */
+    bool writeNB(const T& v)
+    {
+        const size_t w = __atomic_load_n(&writeIndex, __ATOMIC_RELAXED);
+        if ( writable(w, 1) == 0 ) return false;
+
+        buffer[w & mask] = v;
+        __atomic_store_n(&writeIndex, w + 1, __ATOMIC_RELEASE);
+        dataReady.notify();
+        return true;
+    }
+
+    /**
+     * Writes all count messages, publishing them as space becomes
+     * available.  Writer only.
+     */
+    void writeBatch(const T* v, size_t count)
+    {
+        while ( count != 0 ) {
+            size_t written = writeBatchNB(v, count);
+            if ( written == 0 ) { waitWritable(__atomic_load_n(&writeIndex, __ATOMIC_RELAXED)); }
+            else {
+                v += written;
+                count -= written;
+            }
+        }
+    }
+
+    /**
+     * Writes as many of the count messages as there is space for,
+     * without blocking.  Writer only.
+     *
+     * @return number of messages written
+     */
+    size_t writeBatchNB(const T* v, size_t count)
+    {
+        const size_t w = __atomic_load_n(&writeIndex, __ATOMIC_RELAXED);
+        count          = std::min(count, writable(w, count));
+        if ( count == 0 ) return 0;
+
+        const size_t start = w & mask;
+        const size_t first = std::min(count, buffSize - start);
+        std::copy(v, v + first, buffer + start);
+        std::copy(v + first, v + count, buffer);
+
+        __atomic_store_n(&writeIndex, w + count, __ATOMIC_RELEASE);
+        dataReady.notify();
+        return count;
+    }
+
+    ~SPSCCircularBuffer() {}
+
+    /** Drops all messages that have been written.  Reader only. */
+    void clearBuffer()
+    {
+        writeCache = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+        __atomic_store_n(&readIndex, writeCache, __ATOMIC_RELEASE);
+        spaceReady.notify();
+    }
+
+private:
+    // Number of messages the reader can read, reloading the writer's
+    // index only if the cached copy shows fewer than wanted
+    size_t readable(size_t r, size_t wanted)
+    {
+        if ( writeCache - r < wanted ) writeCache = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+        return writeCache - r;
+    }
+
+    // Number of messages the writer can write, reloading the reader's
+    // index only if the cached copy shows less space than wanted
+    size_t writable(size_t w, size_t wanted)
+    {
+        if ( buffSize - (w - readCache) < wanted ) readCache = __atomic_load_n(&readIndex, __ATOMIC_ACQUIRE);
+        return buffSize - (w - readCache);
+    }
+
+    // Spins, then sleeps, until the reader can read a message
+    void waitReadable(size_t r)
+    {
+        int loop_counter = 0;
+        while ( readable(r, 1) == 0 ) {
+            if ( loop_counter < SSTEventCount::spinLimit ) {
+                SSTMutex::processorPause(loop_counter++);
+                continue;
+            }
+
+            uint32_t key = dataReady.prepareWait();
+            if ( readable(r, 1) != 0 ) {
+                dataReady.cancelWait();
+                return;
+            }
+            dataReady.wait(key);
+        }
+    }
+
+    // Spins, then sleeps, until the writer can write a message
+    void waitWritable(size_t w)
+    {
+        int loop_counter = 0;
+        while ( writable(w, 1) == 0 ) {
+            if ( loop_counter < SSTEventCount::spinLimit ) {
+                SSTMutex::processorPause(loop_counter++);
+                continue;
+            }
+
+            uint32_t key = spaceReady.prepareWait();
+            if ( writable(w, 1) != 0 ) {
+                spaceReady.cancelWait();
+                return;
+            }
+            spaceReady.wait(key);
+        }
+    }
+
+    // Set up once by setBufferSize()
+    size_t buffSize;
+    size_t mask;
+    char   pad0[SST_CORE_INTERPROCESS_CACHE_LINE - 2 * sizeof(size_t)];
+
+    // Written by the writer, and by the reader only when it sleeps
+    size_t        writeIndex;
+    size_t        readCache;
+    SSTEventCount dataReady;
+    char          pad1[SST_CORE_INTERPROCESS_CACHE_LINE - 2 * sizeof(size_t) - sizeof(SSTEventCount)];
+
+    // Written by the reader, and by the writer only when it sleeps
+    size_t        readIndex;
+    size_t        writeCache;
+    SSTEventCount spaceReady;
+    char          pad2[SST_CORE_INTERPROCESS_CACHE_LINE - 2 * sizeof(size_t) - sizeof(SSTEventCount)];
+
+    T buffer[0];
+};
+
+} // namespace Interprocess
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_INTERPROCESS_SPSCCIRCULARBUFFER_H
@@ -13,8 +13,16 @@
 #define SST_CORE_INTERPROCESS_MUTEX_H
 
 #include <sched.h>
+#include <stdint.h>
 #include <time.h>
 
+#if defined(__linux__)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace SST {
 namespace Core {
 namespace Interprocess {
@@ -28,7 +36,7 @@ class SSTMutex
 public:
     SSTMutex() { lockVal = SST_CORE_INTERPROCESS_UNLOCKED; }
 
-    void processorPause(int currentCount)
+    static void processorPause(int currentCount)
     {
         if ( currentCount < 64 ) {
 #if defined(__x86_64__)
@@ -78,6 +86,76 @@ private:
     volatile int lockVal;
 };
 
+/**
+ * Lets one process sleep until another one makes progress on a data
+ * structure they share, such as a circular buffer.  It lives in the
+ * shared region next to the data it guards.
+ *
+ * A waiter calls prepareWait(), checks its condition again, and then
+ * either calls cancelWait() if the condition now holds or wait() with
+ * the value prepareWait() returned.  The other side calls notify()
+ * after every change that could make the condition true.  notify()
+ * only makes a system call if somebody is waiting.
+ *
+ * On Linux, waiting uses a futex, so sleeping processes use no CPU.
+ * Elsewhere wait() just sleeps briefly.
+ */
+class SSTEventCount
+{
+
+public:
+    /** Number of times to spin with processorPause() before sleeping */
+    static const int spinLimit = 256;
+
+    SSTEventCount()
+    {
+        seq     = 0;
+        waiters = 0;
+    }
+
+    uint32_t prepareWait()
+    {
+        uint32_t key = __atomic_load_n(&seq, __ATOMIC_ACQUIRE);
+        __atomic_fetch_add(&waiters, 1, __ATOMIC_RELAXED);
+        // Pairs with the fence in notify(), so either notify() sees
+        // the waiter or the waiter's second check sees the change
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        return key;
+    }
+
+    void cancelWait() { __atomic_fetch_sub(&waiters, 1, __ATOMIC_RELAXED); }
+
+    /** Sleeps until notify() is called after prepareWait() returned key */
+    void wait(uint32_t key)
+    {
+#if defined(__linux__)
+        // Wake up now and then in case the other process went away
+        struct timespec timeout;
+        timeout.tv_sec  = 0;
+        timeout.tv_nsec = 10000000;
+        syscall(SYS_futex, &seq, FUTEX_WAIT, key, &timeout, NULL, 0);
+#else
+        if ( __atomic_load_n(&seq, __ATOMIC_ACQUIRE) == key ) SSTMutex::processorPause(spinLimit);
+#endif
+        cancelWait();
+    }
+
+    void notify()
+    {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(&waiters, __ATOMIC_RELAXED) != 0 ) {
+            __atomic_fetch_add(&seq, 1, __ATOMIC_RELEASE);
+#if defined(__linux__)
+            syscall(SYS_futex, &seq, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+        }
+    }
+
+private:
+    uint32_t seq;
+    uint32_t waiters;
+};
+
 } // namespace Interprocess
 } // namespace Core
 } // namespace SST
@@ -21,6 +21,8 @@
  */
 
 #include "sst/core/interprocess/circularBuffer.h"
+#include "sst/core/interprocess/payloadSlab.h"
+#include "sst/core/interprocess/spscCircularBuffer.h"
 
 #include <inttypes.h>
 #include <unistd.h>
@@ -38,26 +40,32 @@ struct InternalSharedData
     volatile uint32_t expectedChildren;
     size_t            shmSegSize;
     size_t            numBuffers;
-    size_t            offsets[0]; // offset[0] points to user region, offset[1]... points to circular buffers
+    // offset[0] points to user region, offset[1]... points to circular buffers,
+    // offset[numBuffers + 1] points to the payload slab, or is 0 if there is none
+    size_t            offsets[0];
 };
 
 /**
  * This class defines a shared-memory region between a master process and
  * one or more child processes
- * Region has three data structures:
+ * Region has four data structures:
  *  - internal bookkeeping (InternalSharedData),
  *  - user defined shared data (ShareDataType)
  *  - multiple circular-buffer queues with entries of type MsgType
+ *  - optionally, a PayloadSlab for large payloads that are passed
+ *    through the queues by PayloadHandle
  *
  * @tparam ShareDataType  Type to put in the shared data region
  * @tparam MsgType Type of messages being sent in the circular buffers
+ * @tparam CircBuff_t Type of the circular buffers.  SPSCCircularBuffer
+ *         is faster, but each buffer must have only one writer and one
+ *         reader, and its size must be a power of two.  The master and
+ *         the children must use the same type.
  */
-template <typename ShareDataType, typename MsgType>
+template <typename ShareDataType, typename MsgType, typename CircBuff_t = CircularBuffer<MsgType>>
 class TunnelDef
 {
 
-    typedef SST::Core::Interprocess::CircularBuffer<MsgType> CircBuff_t;
-
 public:
     /** Create a new tunnel
      *
@@ -65,25 +73,39 @@ public:
      * @param bufferSize How large each buffer should be
      * @param expectedChildren Number of child processes that will connect to this tunnel
      */
-    TunnelDef(size_t numBuffers, size_t bufferSize, uint32_t expectedChildren) : master(true), shmPtr(NULL)
+    TunnelDef(size_t numBuffers, size_t bufferSize, uint32_t expectedChildren) :
+        master(true),
+        shmPtr(NULL),
+        slab(NULL)
     {
         // Locally buffer info
         numBuffs = numBuffers;
         buffSize = bufferSize;
         children = expectedChildren;
-        shmSize  = calculateShmemSize(numBuffers, bufferSize);
+        slabCap  = 0;
+        shmSize  = calculateShmemSize(numBuffers, bufferSize, 0);
     }
 
     /** Access an existing tunnel
      * Child creates the TunnelDef, reads the shmSize, and then resizes its map accordingly
      * @param sPtr Location of shared memory region
      */
-    TunnelDef(void* sPtr) : master(false), shmPtr(sPtr)
+    TunnelDef(void* sPtr) : master(false), shmPtr(sPtr), slab(NULL)
     {
         isd     = (InternalSharedData*)shmPtr;
         shmSize = isd->shmSegSize;
     }
 
+    /** Add a payload slab to a new tunnel.  Must be called before the
+     * tunnel size is read and the tunnel is initialized
+     * @param slabSize Bytes of payload data the slab should hold
+     */
+    void setPayloadSlabSize(size_t slabSize)
+    {
+        slabCap = slabSize;
+        shmSize = calculateShmemSize(numBuffs, buffSize, slabSize);
+    }
+
     /** Finish setting up a tunnel once the manager knows the correct size of the tunnel
      * and has mmap'd a large enough region for it
      * @param sPtr Location of shared memory region
@@ -99,7 +121,7 @@ public:
             // Reserve space for InternalSharedData
             // Including an offset array entry for each buffer & sharedData structure
             std::pair<size_t, InternalSharedData*> aResult =
-                reserveSpace<InternalSharedData>((1 + numBuffs) * sizeof(size_t));
+                reserveSpace<InternalSharedData>((2 + numBuffs) * sizeof(size_t));
             isd                   = aResult.second;
             isd->expectedChildren = children;
             isd->shmSegSize       = shmSize;
@@ -121,6 +143,16 @@ public:
                 if ( !cPtr->setBufferSize(buffSize) ) exit(1); // function prints error message
                 circBuffs.push_back(cPtr);
             }
+
+            // Reserve space for the payload slab
+            isd->offsets[1 + numBuffs] = 0;
+            if ( slabCap != 0 ) {
+                std::pair<size_t, PayloadSlab*> dResult =
+                    reserveSpace<PayloadSlab>(PayloadSlab::regionSize(slabCap) - sizeof(PayloadSlab));
+                isd->offsets[1 + numBuffs] = dResult.first;
+                slab                       = dResult.second;
+                if ( !slab->setCapacity(slabCap) ) exit(1); // function prints error message
+            }
             return isd->expectedChildren;
         }
         else {
@@ -134,6 +166,10 @@ public:
             }
             numBuffs = isd->numBuffers;
 
+            if ( isd->offsets[numBuffs + 1] != 0 ) {
+                slab = (PayloadSlab*)((uint8_t*)shmPtr + isd->offsets[numBuffs + 1]);
+            }
+
             return --(isd->expectedChildren);
         }
     }
@@ -148,12 +184,14 @@ public:
             for ( size_t i = 0; i < circBuffs.size(); i++ ) {
                 circBuffs[i]->~CircBuff_t();
             }
+            if ( slab ) slab->~PayloadSlab();
         }
 
         if ( shmPtr ) {
             shmPtr     = NULL;
             isd        = NULL;
             sharedData = NULL;
+            slab       = NULL;
             shmSize    = 0;
         }
     }
@@ -164,6 +202,9 @@ public:
     /** return a pointer to the ShareDataType region */
     ShareDataType* getSharedData() { return sharedData; }
 
+    /** return a pointer to the payload slab, or NULL if the tunnel has none */
+    PayloadSlab* getPayloadSlab() { return slab; }
+
     /** Write data to buffer, blocks until space is available
      * @param buffer which buffer index to write to
      * @param command message to write to buffer
@@ -183,6 +224,38 @@ public:
      */
     bool readMessageNB(size_t buffer, MsgType* result) { return circBuffs[buffer]->readNB(result); }
 
+    /** Write several messages to buffer, blocks until all are written.
+     * @param buffer which buffer index to write to
+     * @param commands messages to write to buffer
+     * @param count number of messages
+     */
+    void writeMessages(size_t buffer, const MsgType* commands, size_t count)
+    {
+        circBuffs[buffer]->writeBatch(commands, count);
+    }
+
+    /** Read several messages from buffer, blocks until at least one is received
+     * @param buffer which buffer to read from
+     * @param result array to return read messages in
+     * @param max size of result
+     * return number of messages read
+     */
+    size_t readMessages(size_t buffer, MsgType* result, size_t max)
+    {
+        return circBuffs[buffer]->readBatch(result, max);
+    }
+
+    /** Read several messages from buffer, non-blocking.
+     * @param buffer which buffer to read from
+     * @param result array to return read messages in
+     * @param max size of result
+     * return number of messages read
+     */
+    size_t readMessagesNB(size_t buffer, MsgType* result, size_t max)
+    {
+        return circBuffs[buffer]->readBatchNB(result, max);
+    }
+
     /** Empty the messages in a buffer
      * @param buffer which buffer to empty
      */
@@ -200,25 +273,44 @@ private:
     template <typename T>
     std::pair<size_t, T*> reserveSpace(size_t extraSpace = 0)
     {
-        size_t space = sizeof(T) + extraSpace;
-        if ( (size_t)((nextAllocPtr + space) - (uint8_t*)shmPtr) > shmSize ) return std::make_pair<size_t, T*>(0, NULL);
-        T* ptr = (T*)nextAllocPtr;
-        nextAllocPtr += space;
+        // Align by offset: the region is page aligned in every process
+        size_t offset = alignOffset((size_t)(nextAllocPtr - (uint8_t*)shmPtr), allocAlignment<T>());
+        size_t space  = sizeof(T) + extraSpace;
+        if ( offset + space > shmSize ) return std::make_pair<size_t, T*>(0, NULL);
+        T* ptr       = (T*)((uint8_t*)shmPtr + offset);
+        nextAllocPtr = (uint8_t*)ptr + space;
         new (ptr) T(); // Call constructor if need be
-        return std::make_pair((uint8_t*)ptr - (uint8_t*)shmPtr, ptr);
+        return std::make_pair(offset, ptr);
     }
 
+    /** Alignment of an allocation of type T: at least a cache line, so
+     * structures used by different processes do not share one */
+    template <typename T>
+    static size_t allocAlignment()
+    {
+        return __alignof__(T) > cacheLineSize ? __alignof__(T) : cacheLineSize;
+    }
+
+    /** Round offset up to a multiple of align (a power of two) */
+    static size_t alignOffset(size_t offset, size_t align) { return (offset + align - 1) & ~(align - 1); }
+
     /** Calculate the size of the tunnel */
-    static size_t calculateShmemSize(size_t numBuffers, size_t bufferSize)
+    static size_t calculateShmemSize(size_t numBuffers, size_t bufferSize, size_t slabSize)
     {
         long   pagesize = sysconf(_SC_PAGESIZE);
-        /* Count how many pages are needed, at minimum */
-        size_t isd      = 1 + ((sizeof(InternalSharedData) + (1 + numBuffers) * sizeof(size_t)) / pagesize);
-        size_t buffer   = 1 + ((sizeof(CircularBuffer<MsgType>) + bufferSize * sizeof(MsgType)) / pagesize);
-        size_t shdata   = 1 + ((sizeof(ShareDataType) + sizeof(InternalSharedData)) / pagesize);
+        /* Count how many pages are needed, at minimum, including the
+         * padding reserveSpace() may add to align each allocation */
+        size_t isdBytes = sizeof(InternalSharedData) + (2 + numBuffers) * sizeof(size_t);
+        size_t bufBytes = sizeof(CircBuff_t) + bufferSize * sizeof(MsgType);
+        size_t shdBytes = sizeof(ShareDataType) + sizeof(InternalSharedData);
+        size_t isd      = 1 + (allocAlignment<InternalSharedData>() + isdBytes) / pagesize;
+        size_t buffer   = 1 + (allocAlignment<CircBuff_t>() + bufBytes) / pagesize;
+        size_t shdata   = 1 + (allocAlignment<ShareDataType>() + shdBytes) / pagesize;
+        size_t payload  =
+            slabSize == 0 ? 0 : 1 + (allocAlignment<PayloadSlab>() + PayloadSlab::regionSize(slabSize)) / pagesize;
 
         /* Alloc 2 extra pages just in case */
-        return (2 + isd + shdata + numBuffers * buffer) * pagesize;
+        return (2 + isd + shdata + numBuffers * buffer + payload) * pagesize;
     }
 
 protected:
@@ -229,6 +321,8 @@ protected:
     size_t getNumBuffers() { return numBuffs; }
 
 private:
+    static const size_t cacheLineSize = 64;
+
     bool  master;
     void* shmPtr;
 
@@ -238,11 +332,13 @@ private:
     // Local data
     size_t   numBuffs;
     size_t   buffSize;
+    size_t   slabCap;
     uint32_t children;
 
     // Shared objects
     InternalSharedData*      isd;
     std::vector<CircBuff_t*> circBuffs;
+    PayloadSlab*             slab;
 };
 
 } // namespace Interprocess
@@ -50,10 +50,12 @@ REENABLE_WARNING
 #include <iomanip>
 #include <iostream>
 #include <signal.h>
+#include <sstream>
 #include <sys/resource.h>
 #include <time.h>
 
 // Configuration Graph Generation Options
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
 #include "sst/core/cfgoutput/dotConfigOutput.h"
 #include "sst/core/cfgoutput/jsonConfigOutput.h"
 #include "sst/core/cfgoutput/pythonConfigOutput.h"
@@ -154,6 +156,20 @@ setupSignals(uint32_t threadRank)
     }
 }
 
+// Parse a comma separated list of key=value pairs
+static bool
+parse_partitioner_params(const std::string& list, Params& params)
+{
+    std::stringstream ss(list);
+    std::string       item;
+    while ( std::getline(ss, item, ',') ) {
+        size_t eq = item.find('=');
+        if ( eq == std::string::npos || eq == 0 ) return false;
+        params.insert(item.substr(0, eq), item.substr(eq + 1));
+    }
+    return true;
+}
+
 static void
 dump_partition(Config& cfg, ConfigGraph* graph, const RankInfo& size)
 {
@@ -270,6 +286,17 @@ doSerialOnlyGraphOutput(SST::Config* cfg, ConfigGraph* graph)
         DotConfigGraphOutput out(cfg->output_dot().c_str());
         out.generate(cfg, graph);
     }
+
+    // See if user asked us to dump the partitioned graph in binary
+    // format.  This needs the whole graph, which a parallel load
+    // never builds on one rank.
+    if ( cfg->output_graph() != "" ) {
+        if ( cfg->parallel_load() ) {
+            g_output.fatal(CALL_INFO, 1, "--output-graph is not supported with --parallel-load\n");
+        }
+        BinaryConfigGraphOutput out(cfg->output_graph().c_str());
+        out.generate(cfg, graph);
+    }
 }
 
 // This should only be called once in main().  Either before or after
@@ -308,6 +335,110 @@ doParallelCapableGraphOutput(SST::Config* cfg, ConfigGraph* graph, const RankInf
     }
 }
 
+#ifdef SST_CONFIG_HAVE_MPI
+// Number of links or components serialized into each message when
+// streaming a subgraph to another rank
+static const size_t graph_send_batch = 10000;
+
+static void
+deleteConfigComponent(ConfigComponent* comp)
+{
+    for ( ConfigComponent* sub : comp->subComponents ) {
+        deleteConfigComponent(sub);
+    }
+    delete comp;
+}
+
+// Sends a subgraph split off of this rank's graph to dest.  The links
+// and components are serialized and sent a batch at a time, and each
+// batch is freed once sent, so the sender never holds the whole
+// serialized subgraph and its memory use shrinks as the graph is
+// distributed.  The receiver unpacks a batch while the next one is
+// being serialized.  The graph is deleted.
+static void
+sendGraph(int dest, ConfigGraph* graph)
+{
+    ConfigLinkMap_t&                       links      = graph->getLinkMap();
+    ConfigComponentMap_t&                  comps      = graph->getComponentMap();
+    uint8_t                                load_level = graph->getStatLoadLevel();
+    std::map<std::string, ConfigStatGroup> stat_groups(graph->getStatGroups());
+    std::pair<uint64_t, uint64_t>          counts(links.size(), comps.size());
+
+    Comms::send(dest, 0, graph->getStatOutputs());
+    Comms::send(dest, 0, load_level);
+    Comms::send(dest, 0, stat_groups);
+    Comms::send(dest, 0, counts);
+
+    std::vector<ConfigLink*> link_batch;
+    for ( auto it = links.begin(); it != links.end(); ) {
+        for ( ; it != links.end() && link_batch.size() < graph_send_batch; ++it ) {
+            link_batch.push_back(*it);
+        }
+        Comms::send(dest, 0, link_batch);
+        for ( ConfigLink* link : link_batch ) {
+            delete link;
+        }
+        link_batch.clear();
+    }
+
+    std::vector<ConfigComponent*> comp_batch;
+    for ( auto it = comps.begin(); it != comps.end(); ) {
+        for ( ; it != comps.end() && comp_batch.size() < graph_send_batch; ++it ) {
+            comp_batch.push_back(*it);
+        }
+        Comms::send(dest, 0, comp_batch);
+        for ( ConfigComponent* comp : comp_batch ) {
+            deleteConfigComponent(comp);
+        }
+        comp_batch.clear();
+    }
+
+    delete graph;
+}
+
+// Receives a subgraph sent with sendGraph() from src into graph
+static void
+recvGraph(int src, ConfigGraph* graph)
+{
+    ConfigLinkMap_t&                       links = graph->getLinkMap();
+    ConfigComponentMap_t&                  comps = graph->getComponentMap();
+    uint8_t                                load_level;
+    std::map<std::string, ConfigStatGroup> stat_groups;
+    std::pair<uint64_t, uint64_t>          counts;
+
+    Comms::recv(src, 0, graph->getStatOutputs());
+    Comms::recv(src, 0, load_level);
+    Comms::recv(src, 0, stat_groups);
+    Comms::recv(src, 0, counts);
+
+    graph->setStatisticLoadLevel(load_level);
+    for ( auto& kv : stat_groups ) {
+        *graph->getStatGroup(kv.first) = kv.second;
+    }
+
+    // Batches arrive in id order, so each insert is an append
+    std::vector<ConfigLink*> link_batch;
+    while ( links.size() < counts.first ) {
+        Comms::recv(src, 0, link_batch);
+        for ( ConfigLink* link : link_batch ) {
+            links.insert(link);
+        }
+        link_batch.clear();
+    }
+
+    std::vector<ConfigComponent*> comp_batch;
+    while ( comps.size() < counts.second ) {
+        Comms::recv(src, 0, comp_batch);
+        for ( ConfigComponent* comp : comp_batch ) {
+            comps.insert(comp);
+        }
+        comp_batch.clear();
+    }
+
+    graph->setComponentConfigGraphPointers();
+}
+#endif
+
 typedef struct
 {
     RankInfo     myRank;
@@ -696,7 +827,8 @@ main(int argc, char* argv[])
         graph->postCreationCleanup();
 
         // Check config graph to see if there are structural errors.
-        if ( graph->checkForStructuralErrors() ) {
+        // With a parallel load, each rank checks its own components.
+        if ( graph->checkForStructuralErrors(cfg.parallel_load() ? myRank.rank : UINT32_MAX) ) {
             g_output.fatal(CALL_INFO, 1, "Structure errors found in the ConfigGraph.\n");
         }
     }
@@ -751,7 +883,27 @@ main(int argc, char* argv[])
         if ( world_size.rank == 1 && world_size.thread == 1 ) cfg.partitioner_ = "sst.single";
 
         // Get the partitioner.  Built in partitioners are in the "sst" library.
-        SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
+        SSTPartitioner* partitioner;
+        if ( !cfg.threadPartitioner().empty() && world_size.thread > 1 ) {
+            // Two-level partitioning: the partitioner only splits the
+            // graph across ranks and the thread partitioner splits each
+            // rank across its threads
+            partitioner = factory->CreatePartitioner("sst.twolevel", world_size, myRank, cfg.verbose());
+            partitioner->setLevelPartitioners(cfg.partitioner(), cfg.threadPartitioner());
+        }
+        else {
+            partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
+        }
+        if ( !cfg.partitionerCostFile().empty() ) partitioner->setCostFile(cfg.partitionerCostFile());
+        if ( !cfg.partitionerParams().empty() ) {
+            Params params;
+            if ( !parse_partitioner_params(cfg.partitionerParams(), params) ) {
+                g_output.fatal(
+                    CALL_INFO, 1, "Invalid --partitioner-params \"%s\", expected key=value[,key=value...]\n",
+                    cfg.partitionerParams().c_str());
+            }
+            partitioner->setParams(params);
+        }
 
         try {
             if ( partitioner->requiresConfigGraph() ) { partitioner->performPartition(graph); }
@@ -861,6 +1013,8 @@ main(int argc, char* argv[])
             Comms::broadcast(Params::keyMapReverse, 0);
             Comms::broadcast(Params::nextKeyID, 0);
             Comms::broadcast(Params::global_params, 0);
+            Comms::broadcast(Params::param_templates, 0);
+            Params::rebuildParamTemplateIndex();
 
             std::set<uint32_t> my_ranks;
             std::set<uint32_t> your_ranks;
@@ -881,13 +1035,16 @@ main(int argc, char* argv[])
                 ConfigGraph* your_graph = graph->splitGraph(my_ranks, your_ranks);
                 int          dest       = *your_ranks.begin();
                 Comms::send(dest, 0, your_ranks);
-                Comms::send(dest, 0, *your_graph);
+                sendGraph(dest, your_graph);
                 your_ranks.clear();
-                delete your_graph;
             }
             else {
-                Comms::recv(MPI_ANY_SOURCE, 0, my_ranks);
-                Comms::recv(MPI_ANY_SOURCE, 0, *graph);
+                // The whole subgraph comes from the rank that sends
+                // the rank set
+                MPI_Status status;
+                MPI_Probe(MPI_ANY_SOURCE, 0, MPI_COMM_WORLD, &status);
+                Comms::recv(status.MPI_SOURCE, 0, my_ranks);
+                recvGraph(status.MPI_SOURCE, graph);
             }
 
             while ( my_ranks.size() != 1 ) {
@@ -906,9 +1063,8 @@ main(int argc, char* argv[])
                 uint32_t dest = *your_ranks.begin();
 
                 Comms::send(dest, 0, your_ranks);
-                Comms::send(dest, 0, *your_graph);
+                sendGraph(dest, your_graph);
                 your_ranks.clear();
-                delete your_graph;
             }
         }
         catch ( std::exception& e ) {
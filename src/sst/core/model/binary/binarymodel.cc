@@ -0,0 +1,220 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/model/binary/binarymodel.h"
+
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+#include "sst/core/warnmacros.h"
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+using namespace SST;
+using namespace SST::Core;
+
+SSTBinaryModelDefinition::SSTBinaryModelDefinition(
+    const std::string& script_file, int verbosity, Config* configObj, double UNUSED(start_time)) :
+    SSTModelDescription(configObj),
+    scriptName(script_file),
+    output(nullptr),
+    config(configObj),
+    myRank(0),
+    numRanks(1),
+    next(nullptr),
+    end(nullptr)
+{
+    output = new Output("SSTBinaryModel: ", verbosity, 0, SST::Output::STDOUT);
+
+    output->verbose(CALL_INFO, 2, 0, "SST loading a binary graph from file: %s\n", script_file.c_str());
+
+#ifdef SST_CONFIG_HAVE_MPI
+    int rank  = 0;
+    int ranks = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+    myRank   = rank;
+    numRanks = ranks;
+#endif
+
+    // Every rank needs to read its own section of the file
+    if ( numRanks > 1 && (!config->parallel_load() || config->parallel_load_mode_multi()) ) {
+        output->fatal(
+            CALL_INFO, 1, "Binary graph files must be loaded with --parallel-load=SINGLE when using more than one rank\n");
+    }
+}
+
+SSTBinaryModelDefinition::~SSTBinaryModelDefinition()
+{
+    delete output;
+}
+
+void
+SSTBinaryModelDefinition::startRecord(SST::Core::Serialization::serializer& ser)
+{
+    uint64_t size;
+    if ( (size_t)(end - next) < sizeof(size) ) {
+        output->fatal(CALL_INFO, 1, "Error, binary graph file is truncated: %s\n", scriptName.c_str());
+    }
+    memcpy(&size, next, sizeof(size));
+    next += sizeof(size);
+
+    if ( (uint64_t)(end - next) < size ) {
+        output->fatal(CALL_INFO, 1, "Error, binary graph file is truncated: %s\n", scriptName.c_str());
+    }
+    ser.start_unpacking(const_cast<char*>(next), size);
+    next += size;
+}
+
+ConfigGraph*
+SSTBinaryModelDefinition::createConfigGraph()
+{
+    typedef BinaryConfigGraphOutput::Header  Header;
+    typedef BinaryConfigGraphOutput::Section Section;
+
+    // map the file, so only the pages of the sections that are read
+    // get loaded
+    int fd = open(scriptName.c_str(), O_RDONLY);
+    if ( fd < 0 ) {
+        output->fatal(CALL_INFO, 1, "Error opening binary graph file: %s\n", scriptName.c_str());
+        return nullptr;
+    }
+
+    struct stat file_stat;
+    fstat(fd, &file_stat);
+    size_t file_size = file_stat.st_size;
+    if ( file_size < sizeof(Header) ) {
+        output->fatal(CALL_INFO, 1, "Error, %s is not a binary graph file\n", scriptName.c_str());
+    }
+
+    void* map = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if ( map == MAP_FAILED ) {
+        output->fatal(CALL_INFO, 1, "Error mapping binary graph file: %s\n", scriptName.c_str());
+        return nullptr;
+    }
+    const char* base = static_cast<const char*>(map);
+
+    // check the header
+    Header header;
+    memcpy(&header, base, sizeof(header));
+    if ( memcmp(header.magic, BinaryConfigGraphOutput::magic, sizeof(header.magic)) != 0 ) {
+        output->fatal(CALL_INFO, 1, "Error, %s is not a binary graph file\n", scriptName.c_str());
+    }
+    if ( header.version != BinaryConfigGraphOutput::version ) {
+        output->fatal(
+            CALL_INFO, 1, "Error, %s uses version %" PRIu32 " of the binary graph format, but only version %" PRIu32
+            " is supported\n", scriptName.c_str(), header.version, BinaryConfigGraphOutput::version);
+    }
+    if ( header.num_ranks != numRanks ) {
+        output->fatal(
+            CALL_INFO, 1, "Error, %s was partitioned for %" PRIu32 " ranks, but the job has %" PRIu32 " ranks\n",
+            scriptName.c_str(), header.num_ranks, numRanks);
+    }
+
+    std::vector<Section> index(header.num_ranks + 1);
+    if ( file_size < sizeof(Header) + index.size() * sizeof(Section) ) {
+        output->fatal(CALL_INFO, 1, "Error, binary graph file is truncated: %s\n", scriptName.c_str());
+    }
+    memcpy(index.data(), base + sizeof(Header), index.size() * sizeof(Section));
+    for ( auto& section : index ) {
+        if ( section.offset > file_size || section.size > file_size - section.offset ) {
+            output->fatal(CALL_INFO, 1, "Error, binary graph file is truncated: %s\n", scriptName.c_str());
+        }
+    }
+
+    // Section 0: program options and parameter globals
+    next = base + index[0].offset;
+    end  = next + index[0].size;
+    {
+        SST::Core::Serialization::serializer             ser;
+        std::vector<std::pair<std::string, std::string>> options;
+        startRecord(ser);
+        ser& options;
+        for ( auto& option : options ) {
+            setOptionFromModel(option.first, option.second);
+        }
+    }
+    {
+        SST::Core::Serialization::serializer ser;
+        startRecord(ser);
+        serializeParamsGlobals(ser);
+    }
+
+    // The section for this rank
+    next = base + index[myRank + 1].offset;
+    end  = next + index[myRank + 1].size;
+
+    ConfigGraph*                           graph = new ConfigGraph();
+    ConfigLinkMap_t&                       links = graph->getLinkMap();
+    ConfigComponentMap_t&                  comps = graph->getComponentMap();
+    uint8_t                                load_level;
+    std::map<std::string, ConfigStatGroup> stat_groups;
+    std::pair<uint64_t, uint64_t>          counts;
+    {
+        SST::Core::Serialization::serializer ser;
+        startRecord(ser);
+        ser& graph->getStatOutputs();
+        ser& load_level;
+        ser& stat_groups;
+        ser& counts;
+    }
+
+    graph->setStatisticLoadLevel(load_level);
+    for ( auto& kv : stat_groups ) {
+        *graph->getStatGroup(kv.first) = kv.second;
+    }
+
+    // Records are in id order, so each insert is an append
+    std::vector<ConfigLink*> link_batch;
+    while ( links.size() < counts.first ) {
+        SST::Core::Serialization::serializer ser;
+        startRecord(ser);
+        ser& link_batch;
+        for ( ConfigLink* link : link_batch ) {
+            links.insert(link);
+        }
+        link_batch.clear();
+    }
+
+    std::vector<ConfigComponent*> comp_batch;
+    while ( comps.size() < counts.second ) {
+        SST::Core::Serialization::serializer ser;
+        startRecord(ser);
+        ser& comp_batch;
+        for ( ConfigComponent* comp : comp_batch ) {
+            comps.insert(comp);
+        }
+        comp_batch.clear();
+    }
+
+    graph->setComponentConfigGraphPointers();
+
+    munmap(map, file_size);
+    next = end = nullptr;
+
+    return graph;
+}
@@ -0,0 +1,70 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_BINARY_BINARYMODEL_H
+#define SST_CORE_MODEL_BINARY_BINARYMODEL_H
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/model/sstmodel.h"
+#include "sst/core/output.h"
+
+#include <string>
+
+namespace SST {
+namespace Core {
+
+/**
+   Loads a graph written with --output-graph.  The file is mapped into
+   memory and each rank only unpacks its own section, so the graph is
+   neither rebuilt nor partitioned again.  The job must have the same
+   number of ranks as the one that wrote the file, and jobs with more
+   than one rank must use --parallel-load=SINGLE.
+ */
+class SSTBinaryModelDefinition : public SSTModelDescription
+{
+public:
+    SST_ELI_REGISTER_MODEL_DESCRIPTION(
+          SST::Core::SSTBinaryModelDefinition,
+          "sst",
+          "model.binary",
+          SST_ELI_ELEMENT_VERSION(1,0,0),
+          "Binary model for reloading partitioned SST simulation graphs",
+          true)
+
+    SST_ELI_DOCUMENT_MODEL_SUPPORTED_EXTENSIONS(".sstgraph")
+
+    SSTBinaryModelDefinition(const std::string& script_file, int verbosity, Config* config, double start_time);
+    virtual ~SSTBinaryModelDefinition();
+
+    ConfigGraph* createConfigGraph() override;
+
+private:
+    std::string scriptName;
+    Output*     output;
+    Config*     config;
+    uint32_t    myRank;
+    uint32_t    numRanks;
+
+    // Position of the next record in the mapped file
+    const char* next;
+    const char* end;
+
+    // Sets up ser to unpack the next record
+    void startRecord(SST::Core::Serialization::serializer& ser);
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_MODEL_BINARY_BINARYMODEL_H
@@ -15,6 +15,12 @@
 
 #include "sst/core/model/json/jsonmodel.h"
 
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
 #include <string>
 
 DISABLE_WARN_STRICT_ALIASING
@@ -22,6 +28,191 @@ DISABLE_WARN_STRICT_ALIASING
 using namespace SST;
 using namespace SST::Core;
 
+/*
+  Builds one top level element of the model at a time and passes it to
+  the model.  The "components" and "links" arrays are not built as a
+  whole: each component or link is passed on as soon as it is complete,
+  so only one of them is in memory at a time.  Links that come before
+  the end of the "components" array are held until it is done.
+
+  Components are built as they are read, so the "program_options" and
+  "param_templates" sections, which they depend on, must come before
+  the "components" section.  The JSON config output writes them in
+  that order.
+ */
+class SSTJSONModelDefinition::StreamHandler : public nlohmann::json_sax<json>
+{
+public:
+    explicit StreamHandler(SSTJSONModelDefinition* model) : model(model) {}
+
+    bool null() override { return value(json()); }
+    bool boolean(bool val) override { return value(json(val)); }
+    bool number_integer(number_integer_t val) override { return value(json(val)); }
+    bool number_unsigned(number_unsigned_t val) override { return value(json(val)); }
+    bool number_float(number_float_t val, const string_t& UNUSED(s)) override { return value(json(val)); }
+    bool string(string_t& val) override { return value(json(std::move(val))); }
+    bool binary(binary_t& UNUSED(val)) override { return false; }
+
+    bool key(string_t& val) override
+    {
+        if ( !stack.empty() ) {
+            key_name = val;
+            return true;
+        }
+        section = val;
+        if ( section == "components" ) components_found = true;
+        if ( components_found && (section == "program_options" || section == "param_templates") ) {
+            model->output->fatal(
+                CALL_INFO, 1, "Error, \"%s\" section must come before the \"components\" section in json file: %s\n",
+                section.c_str(), model->scriptName.c_str());
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t UNUSED(elements)) override { return start(json::value_t::object); }
+    bool end_object() override { return end(); }
+    bool start_array(std::size_t UNUSED(elements)) override { return start(json::value_t::array); }
+    bool end_array() override { return end(); }
+
+    bool parse_error(std::size_t position, const std::string& UNUSED(last_token), const nlohmann::detail::exception& ex)
+        override
+    {
+        model->output->fatal(
+            CALL_INFO, 1, "Error parsing json file %s at byte %zu: %s\n", model->scriptName.c_str(), position,
+            ex.what());
+        return false;
+    }
+
+    bool foundComponents() const { return components_done; }
+    bool foundLinks() const { return links_found; }
+
+private:
+    SSTJSONModelDefinition* model;
+
+    // 0 outside the file, 1 inside the top level object and 2 inside
+    // the "components" or "links" array
+    int                depth = 0;
+    std::string        section;
+    std::string        key_name;
+    json               element;
+    std::vector<json*> stack;
+    bool               components_found = false;
+    bool               components_done  = false;
+    bool               links_found      = false;
+    std::vector<json>  pending_links;
+
+    bool start(json::value_t type)
+    {
+        if ( !stack.empty() ) {
+            stack.push_back(add(json(type)));
+            return true;
+        }
+        if ( depth == 0 ) {
+            if ( type != json::value_t::object ) {
+                model->output->fatal(
+                    CALL_INFO, 1, "Error, top level of json file is not an object: %s\n", model->scriptName.c_str());
+            }
+            depth = 1;
+            return true;
+        }
+        if ( depth == 1 && type == json::value_t::array && (section == "components" || section == "links") ) {
+            if ( section == "links" ) links_found = true;
+            depth = 2;
+            return true;
+        }
+        element = json(type);
+        stack.push_back(&element);
+        return true;
+    }
+
+    bool end()
+    {
+        if ( !stack.empty() ) {
+            stack.pop_back();
+            if ( stack.empty() ) dispatch();
+            return true;
+        }
+        if ( depth == 2 && section == "components" ) finishComponents();
+        depth--;
+        return true;
+    }
+
+    bool value(json&& val)
+    {
+        if ( !stack.empty() ) {
+            add(std::move(val));
+            return true;
+        }
+        if ( depth == 0 ) {
+            model->output->fatal(
+                CALL_INFO, 1, "Error, top level of json file is not an object: %s\n", model->scriptName.c_str());
+        }
+        element = std::move(val);
+        dispatch();
+        return true;
+    }
+
+    // Adds val to the container being built and returns the copy
+    json* add(json&& val)
+    {
+        json* top = stack.back();
+        if ( top->is_object() ) return &((*top)[key_name] = std::move(val));
+        top->push_back(std::move(val));
+        return &top->back();
+    }
+
+    void link(json& val)
+    {
+        if ( components_done )
+            model->discoverLink(val);
+        else
+            pending_links.push_back(std::move(val));
+    }
+
+    void finishComponents()
+    {
+        components_done = true;
+        for ( auto& val : pending_links ) {
+            model->discoverLink(val);
+        }
+        std::vector<json>().swap(pending_links);
+    }
+
+    // Passes a complete element to the model
+    void dispatch()
+    {
+        if ( depth == 2 ) {
+            if ( section == "components" )
+                model->discoverComponent(element);
+            else
+                link(element);
+        }
+        else if ( section == "program_options" ) {
+            model->discoverProgramOptions(element);
+        }
+        else if ( section == "global_params" ) {
+            model->discoverGlobalParams(element);
+        }
+        else if ( section == "param_templates" ) {
+            model->discoverParamTemplates(element);
+        }
+        else if ( section == "components" ) {
+            // Not an array, e.g. null for a graph with no components
+            for ( auto& val : element ) {
+                model->discoverComponent(val);
+            }
+            finishComponents();
+        }
+        else if ( section == "links" ) {
+            links_found = true;
+            for ( auto& val : element ) {
+                link(val);
+            }
+        }
+        element = json();
+    }
+};
+
 SSTJSONModelDefinition::SSTJSONModelDefinition(
     const std::string& script_file, int verbosity, Config* configObj, double start_time) :
     SSTModelDescription(configObj),
@@ -30,7 +221,9 @@ SSTJSONModelDefinition::SSTJSONModelDefinition(
     config(configObj),
     graph(nullptr),
     nextComponentId(0),
-    start_time(start_time)
+    start_time(start_time),
+    skipRemote(false),
+    myRank(0)
 {
     output = new Output("SSTJSONModel: ", verbosity, 0, SST::Output::STDOUT);
 
@@ -38,6 +231,19 @@ SSTJSONModelDefinition::SSTJSONModelDefinition(
     if ( !graph ) { output->fatal(CALL_INFO, 1, "Could not create graph object in JSON loader.\n"); }
 
     output->verbose(CALL_INFO, 2, 0, "SST loading a JSON model from script: %s\n", script_file.c_str());
+
+    // When every rank reads the same file, each one only builds its
+    // own components
+#ifdef SST_CONFIG_HAVE_MPI
+    int ranks = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+    if ( configObj->parallel_load() && !configObj->parallel_load_mode_multi() && ranks > 1 ) {
+        int rank = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        skipRemote = true;
+        myRank     = rank;
+    }
+#endif
 }
 
 SSTJSONModelDefinition::~SSTJSONModelDefinition()
@@ -112,6 +318,13 @@ SSTJSONModelDefinition::recursiveSubcomponent(ConfigComponent* Parent, const nlo
             }
         }
 
+        // read all the parameter templates
+        if ( subArray.contains("param_templates") ) {
+            for ( auto& id : subArray["param_templates"] ) {
+                Comp->addParamTemplate(findParamTemplate(id.get<uint32_t>()));
+            }
+        }
+
         // read all the global parameters
         if ( subArray.contains("params_global_sets") ) {
             for ( auto& globalArray : subArray["params_global_sets"].items() ) {
@@ -128,7 +341,7 @@ SSTJSONModelDefinition::recursiveSubcomponent(ConfigComponent* Parent, const nlo
 }
 
 void
-SSTJSONModelDefinition::discoverComponents(const json& jFile)
+SSTJSONModelDefinition::discoverComponent(const json& compArray)
 {
     std::string      Name;
     std::string      Type;
@@ -137,163 +350,224 @@ SSTJSONModelDefinition::discoverComponents(const json& jFile)
     uint32_t         rank   = 0;
     uint32_t         thread = 0;
 
-    if ( !jFile.contains("components") ) {
-        output->fatal(CALL_INFO, 1, "Error, no \"components\" section in json file: %s\n", scriptName.c_str());
+    // -- Name
+    auto x = compArray.find("name");
+    if ( x != compArray.end() ) { Name = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering component name from script: %s\n", scriptName.c_str());
     }
 
-    for ( auto& compArray : jFile["components"] ) {
-        // -- Name
-        auto x = compArray.find("name");
-        if ( x != compArray.end() ) { Name = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering component name from script: %s\n", scriptName.c_str());
+    // -- Type
+    x = compArray.find("type");
+    if ( x != compArray.end() ) { Type = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering component type from script: %s\n", scriptName.c_str());
+    }
+
+    // read the partition info
+    if ( compArray.contains("partition") ) {
+        for ( auto& partArray : compArray["partition"].items() ) {
+            if ( partArray.key() == "rank" ) { rank = partArray.value(); }
+            else if ( partArray.key() == "thread" ) {
+                thread = partArray.value();
+            }
         }
+    }
 
-        // -- Type
-        x = compArray.find("type");
-        if ( x != compArray.end() ) { Type = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering component type from script: %s\n", scriptName.c_str());
+    // Components built by other ranks only keep their id, so the ids
+    // match a full load
+    if ( skipRemote && rank != myRank ) {
+        RemoteComp remote = { graph->reserveComponentId(), Type, RankInfo(rank, thread), false };
+        if ( graph->findComponentByName(Name) != nullptr || !remoteComps.emplace(Name, remote).second ) {
+            output->fatal(
+                CALL_INFO, 1, "ERROR: trying to add Component with name that already exists: %s\n", Name.c_str());
         }
+        return;
+    }
+    if ( remoteComps.count(Name) != 0 ) {
+        output->fatal(CALL_INFO, 1, "ERROR: trying to add Component with name that already exists: %s\n", Name.c_str());
+    }
 
-        // Add the component so we have the ComponentID
-        Id = graph->addComponent(Name, Type);
+    // Add the component so we have the ComponentID
+    Id = graph->addComponent(Name, Type);
 
-        Comp = graph->findComponent(Id);
+    Comp = graph->findComponent(Id);
 
-        // read all the parameters
-        if ( compArray.contains("params") ) {
-            for ( auto& paramArray : compArray["params"].items() ) {
-                Comp->addParameter(paramArray.key(), paramArray.value(), false);
-            }
+    // read all the parameters
+    if ( compArray.contains("params") ) {
+        for ( auto& paramArray : compArray["params"].items() ) {
+            Comp->addParameter(paramArray.key(), paramArray.value(), false);
         }
+    }
 
-        // read all the global parameters
-        if ( compArray.contains("params_global_sets") ) {
-            for ( auto& globalArray : compArray["params_global_sets"].items() ) {
-                Comp->addGlobalParamSet(globalArray.value().get<std::string>());
-            }
+    // read all the parameter templates
+    if ( compArray.contains("param_templates") ) {
+        for ( auto& id : compArray["param_templates"] ) {
+            Comp->addParamTemplate(findParamTemplate(id.get<uint32_t>()));
         }
+    }
 
-        // read the partition info
-        if ( compArray.contains("partition") ) {
-            for ( auto& partArray : compArray["partition"].items() ) {
-                if ( partArray.key() == "rank" ) { rank = partArray.value(); }
-                else if ( partArray.key() == "thread" ) {
-                    thread = partArray.value();
-                }
-            }
+    // read all the global parameters
+    if ( compArray.contains("params_global_sets") ) {
+        for ( auto& globalArray : compArray["params_global_sets"].items() ) {
+            Comp->addGlobalParamSet(globalArray.value().get<std::string>());
         }
+    }
 
-        // set the rank information
-        RankInfo Rank(rank, thread);
-        Comp->setRank(Rank);
-
-        // recursively read the subcomponents
-        recursiveSubcomponent(Comp, compArray);
+    // set the rank information
+    RankInfo Rank(rank, thread);
+    Comp->setRank(Rank);
 
-        // reset the variables
-        Id   = -1;
-        Comp = nullptr;
-    }
+    // recursively read the subcomponents
+    recursiveSubcomponent(Comp, compArray);
 }
 
 void
-SSTJSONModelDefinition::discoverLinks(const json& jFile)
+SSTJSONModelDefinition::discoverLink(const json& linkArray)
 {
     std::string   Name;
     std::string   Comp[2];
     std::string   Port[2];
     std::string   Latency[2];
     bool          NoCut = false;
+    RemoteComp*   Remote[2];
     ComponentId_t LinkID;
 
-    if ( !jFile.contains("links") ) {
-        output->fatal(CALL_INFO, 1, "Error, no \"links\" section in json file: %s\n", scriptName.c_str());
+    // -- Name
+    auto x = linkArray.find("name");
+    if ( x != linkArray.end() ) { Name = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering link name from script: %s\n", scriptName.c_str());
     }
 
-    for ( auto& linkArray : jFile["links"] ) {
-        // -- Name
-        auto x = linkArray.find("name");
-        if ( x != linkArray.end() ) { Name = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering link name from script: %s\n", scriptName.c_str());
+    // -- NoCut
+    x = linkArray.find("noCut");
+    if ( x != linkArray.end() ) { NoCut = x.value(); }
+    else {
+        NoCut = false;
+    }
+
+    // -- Components
+    std::string sides[2] = { "left", "right" };
+    for ( int i = 0; i < 2; ++i ) {
+        auto side = linkArray.find(sides[i]);
+        if ( side == linkArray.end() ) {
+            output->fatal(
+                CALL_INFO, 1, "Error discovering %s link component for Link=%s from script: %s\n", sides[i].c_str(),
+                Name.c_str(), scriptName.c_str());
         }
 
-        // -- NoCut
-        x = linkArray.find("noCut");
-        if ( x != linkArray.end() ) { NoCut = x.value(); }
+        auto item = side->find("component");
+        if ( item != side->end() ) { Comp[i] = item.value(); }
         else {
-            NoCut = false;
+            output->fatal(
+                CALL_INFO, 1, "Error finding component field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
         }
 
-        // -- Components
-        std::string sides[2] = { "left", "right" };
-        for ( int i = 0; i < 2; ++i ) {
-            auto side = linkArray.find(sides[i]);
-            if ( side == linkArray.end() ) {
-                output->fatal(
-                    CALL_INFO, 1, "Error discovering %s link component for Link=%s from script: %s\n", sides[i].c_str(),
-                    Name.c_str(), scriptName.c_str());
-            }
+        // -- Port
+        item = side->find("port");
+        if ( item != side->end() ) { Port[i] = item.value(); }
+        else {
+            output->fatal(
+                CALL_INFO, 1, "Error finding port field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
+        }
 
-            auto item = side->find("component");
-            if ( item != side->end() ) { Comp[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding component field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
+        // -- Latency
+        item = side->find("latency");
+        if ( item != side->end() ) { Latency[i] = item.value(); }
+        else {
+            output->fatal(
+                CALL_INFO, 1, "Error finding latency field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
+        }
 
-            // -- Port
-            item = side->find("port");
-            if ( item != side->end() ) { Port[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding port field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
+        // -- Remote component, which is found by the name of the
+        // top level component
+        Remote[i] = nullptr;
+        if ( skipRemote ) {
+            auto remote = remoteComps.find(Comp[i].substr(0, Comp[i].find(':')));
+            if ( remote != remoteComps.end() ) Remote[i] = &remote->second;
+        }
+    }
 
-            // -- Latency
-            item = side->find("latency");
-            if ( item != side->end() ) { Latency[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding latency field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
+    // Links between two other ranks are not needed on this one
+    if ( Remote[0] && Remote[1] ) return;
 
-            LinkID = findComponentIdByName(Comp[i]);
-            graph->addLink(LinkID, Name, Port[i], Latency[i], NoCut);
+    for ( int i = 0; i < 2; ++i ) {
+        if ( Remote[i] ) {
+            // Added once the remote components are in the graph
+            Remote[i]->linked = true;
+            remoteLinkEnds.push_back({ Remote[i]->id, Name, Port[i], Latency[i], NoCut });
+            continue;
         }
+        LinkID = findComponentIdByName(Comp[i]);
+        graph->addLink(LinkID, Name, Port[i], Latency[i], NoCut);
     }
 }
 
 void
-SSTJSONModelDefinition::discoverProgramOptions(const json& jFile)
+SSTJSONModelDefinition::addRemoteComponents()
 {
-    if ( jFile.contains("program_options") ) {
-        for ( auto& option : jFile["program_options"].items() ) {
-            setOptionFromModel(option.key(), option.value());
+    // Only the remote components with a link to this rank are added
+    std::vector<ConfigGraph::RemoteComponent> linked;
+    for ( auto& remote : remoteComps ) {
+        if ( remote.second.linked ) {
+            linked.push_back({ remote.second.id, remote.first, remote.second.type, remote.second.rank });
         }
     }
+    decltype(remoteComps)().swap(remoteComps);
+    graph->addRemoteComponents(linked);
+
+    for ( auto& end : remoteLinkEnds ) {
+        graph->addLink(end.id, end.name, end.port, end.latency, end.no_cut);
+    }
+    decltype(remoteLinkEnds)().swap(remoteLinkEnds);
+}
+
+void
+SSTJSONModelDefinition::discoverProgramOptions(const json& jOptions)
+{
+    for ( auto& option : jOptions.items() ) {
+        setOptionFromModel(option.key(), option.value());
+    }
 }
 
 void
-SSTJSONModelDefinition::discoverGlobalParams(const json& jFile)
+SSTJSONModelDefinition::discoverGlobalParams(const json& jGlobals)
 {
     std::string GlobalName;
 
-    if ( jFile.contains("global_params") ) {
-        for ( auto& gp : jFile["global_params"].items() ) {
-            GlobalName = gp.key();
-            for ( auto& param : jFile["global_params"].at(GlobalName).items() ) {
-                graph->addGlobalParam(GlobalName, param.key(), param.value().get<std::string>());
-            }
+    for ( auto& gp : jGlobals.items() ) {
+        GlobalName = gp.key();
+        for ( auto& param : gp.value().items() ) {
+            graph->addGlobalParam(GlobalName, param.key(), param.value().get<std::string>());
         }
     }
 }
 
+void
+SSTJSONModelDefinition::discoverParamTemplates(const json& jTemplates)
+{
+    for ( auto& tmpl : jTemplates ) {
+        std::vector<std::pair<std::string, std::string>> values;
+        for ( auto& param : tmpl.items() ) {
+            values.emplace_back(param.key(), param.value().get<std::string>());
+        }
+        paramTemplates.push_back(insertParamTemplate(values));
+    }
+}
+
+uint32_t
+SSTJSONModelDefinition::findParamTemplate(uint32_t index)
+{
+    if ( index >= paramTemplates.size() ) {
+        output->fatal(CALL_INFO, 1, "Error: unknown parameter template %" PRIu32 " in %s\n", index, scriptName.c_str());
+    }
+    return paramTemplates[index];
+}
+
 ConfigGraph*
 SSTJSONModelDefinition::createConfigGraph()
 {
@@ -304,23 +578,22 @@ SSTJSONModelDefinition::createConfigGraph()
         return nullptr;
     }
 
-    // create parsed json object
-    json jFile = json::parse(ifs);
+    // parse the file one component or link at a time
+    StreamHandler handler(this);
+    json::sax_parse(ifs, &handler);
 
     // close the file
     ifs.close();
 
-    // discover all the globals
-    discoverProgramOptions(jFile);
-
-    // discover the global parameters
-    discoverGlobalParams(jFile);
-
-    // discover the components
-    discoverComponents(jFile);
+    if ( !handler.foundComponents() ) {
+        output->fatal(CALL_INFO, 1, "Error, no \"components\" section in json file: %s\n", scriptName.c_str());
+    }
+    if ( !handler.foundLinks() ) {
+        output->fatal(CALL_INFO, 1, "Error, no \"links\" section in json file: %s\n", scriptName.c_str());
+    }
 
-    // discover the links
-    discoverLinks(jFile);
+    // add the components of other ranks that links connect to
+    addRemoteComponents();
 
     // TODO: discover statistics
 
@@ -31,6 +31,7 @@
 #include <fstream>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 using namespace SST;
@@ -66,12 +67,50 @@ protected:
     double        start_time;
 
 private:
+    // SAX handler that hands the model one component or link at a
+    // time, so the whole file is never held in memory
+    class StreamHandler;
+
+    // Component that another rank builds during a parallel load.  It
+    // is only added to the graph if a link on this rank references it.
+    struct RemoteComp
+    {
+        ComponentId_t  id;
+        InternedString type;
+        RankInfo       rank;
+        bool           linked;
+    };
+
+    // End of a link on a component that another rank builds
+    struct RemoteLinkEnd
+    {
+        ComponentId_t  id;
+        std::string    name;
+        InternedString port;
+        InternedString latency;
+        bool           no_cut;
+    };
+
     void          recursiveSubcomponent(ConfigComponent* Parent, const nlohmann::basic_json<>& compArray);
-    void          discoverProgramOptions(const json& jFile);
-    void          discoverComponents(const json& jFile);
-    void          discoverLinks(const json& jFile);
-    void          discoverGlobalParams(const json& jFile);
+    void          discoverProgramOptions(const json& jOptions);
+    void          discoverComponent(const json& compArray);
+    void          discoverLink(const json& linkArray);
+    void          discoverGlobalParams(const json& jGlobals);
+    void          discoverParamTemplates(const json& jTemplates);
+    uint32_t      findParamTemplate(uint32_t index);
+    void          addRemoteComponents();
     ComponentId_t findComponentIdByName(const std::string& Name);
+
+    // Set when loading in parallel from a single file.  Components
+    // for other ranks are only recorded by name and links between them
+    // are skipped.
+    bool                                        skipRemote;
+    uint32_t                                    myRank;
+    std::unordered_map<std::string, RemoteComp> remoteComps;
+    std::vector<RemoteLinkEnd>                  remoteLinkEnds;
+
+    // Ids of the parameter templates, by their index in the file
+    std::vector<uint32_t> paramTemplates;
 };
 
 } // namespace Core
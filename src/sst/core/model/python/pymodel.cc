@@ -263,6 +263,214 @@ findComponentByName(PyObject* UNUSED(self), PyObject* args)
     return Py_None;
 }
 
+// Converts obj to a string by calling str() on it.  Returns false,
+// with the Python error set, on failure.
+static bool
+pyObjectToString(PyObject* obj, std::string& out)
+{
+    PyObject* pstr = PyObject_Str(obj);
+    if ( nullptr == pstr ) return false;
+    const char* cstr = SST_ConvertToCppString(pstr);
+    if ( nullptr != cstr ) out = cstr;
+    Py_DECREF(pstr);
+    return nullptr != cstr;
+}
+
+// Converts the keys and values of dict to strings.  Returns false,
+// with the Python error set, on failure.
+static bool
+pyDictToParams(PyObject* dict, std::vector<std::pair<std::string, std::string>>& out)
+{
+    Py_ssize_t  pos = 0;
+    PyObject *  key, *val;
+    std::string kstr, vstr;
+    while ( PyDict_Next(dict, &pos, &key, &val) ) {
+        if ( !pyObjectToString(key, kstr) || !pyObjectToString(val, vstr) ) return false;
+        out.emplace_back(kstr, vstr);
+    }
+    return true;
+}
+
+// Finds a component or subcomponent given either its id or its name
+static ConfigComponent*
+findComponentByIdOrName(PyObject* obj)
+{
+    ConfigComponent* cc = nullptr;
+    if ( PyIndex_Check(obj) ) {
+        PyObject* index = PyNumber_Index(obj);
+        if ( nullptr == index ) return nullptr;
+        ComponentId_t id = PyLong_AsUnsignedLongLong(index);
+        Py_DECREF(index);
+        if ( PyErr_Occurred() ) return nullptr;
+        if ( gModel->getGraph()->containsComponent(COMPONENT_ID_MASK(id)) ) {
+            cc = gModel->getGraph()->findComponent(id);
+        }
+    }
+    else {
+        std::string name;
+        if ( !pyObjectToString(obj, name) ) return nullptr;
+        cc = gModel->findComponentByName(name.c_str());
+    }
+
+    if ( nullptr == cc ) {
+        std::string desc;
+        pyObjectToString(obj, desc);
+        PyErr_SetString(PyExc_ValueError, ("Unknown component: " + desc).c_str());
+    }
+    return cc;
+}
+
+static PyObject*
+addComponents(PyObject* UNUSED(self), PyObject* arg)
+{
+    PyObject* seq = PySequence_Fast(arg, "addComponents() expects a sequence of (name, type[, params]) entries");
+    if ( nullptr == seq ) return nullptr;
+
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+    PyObject*  ids  = PyList_New(size);
+
+    // Each params dict is converted once into a shared parameter
+    // template, however many components use it
+    std::map<PyObject*, uint32_t> converted;
+
+    bool        ok = true;
+    std::string name, type;
+    for ( Py_ssize_t i = 0; ok && i < size; i++ ) {
+        PyObject* entry = PySequence_Fast(
+            PySequence_Fast_GET_ITEM(seq, i), "addComponents() expects (name, type[, params]) entries");
+        if ( nullptr == entry ) {
+            ok = false;
+            break;
+        }
+
+        Py_ssize_t fields = PySequence_Fast_GET_SIZE(entry);
+        PyObject** item   = PySequence_Fast_ITEMS(entry);
+        if ( fields < 2 || fields > 3 ) {
+            PyErr_SetString(PyExc_ValueError, "addComponents() expects (name, type[, params]) entries");
+            ok = false;
+        }
+        else if ( !pyObjectToString(item[0], name) || !pyObjectToString(item[1], type) ) {
+            ok = false;
+        }
+
+        const uint32_t* params = nullptr;
+        if ( ok && fields == 3 && item[2] != Py_None ) {
+            auto found = converted.find(item[2]);
+            if ( found != converted.end() ) { params = &found->second; }
+            else if ( PyDict_Check(item[2]) ) {
+                std::vector<std::pair<std::string, std::string>> values;
+                ok = pyDictToParams(item[2], values);
+                if ( ok ) params = &converted.emplace(item[2], gModel->addParamTemplate(values)).first->second;
+            }
+            else if ( PyLong_Check(item[2]) ) {
+                uint32_t id;
+                ok = pyObjectToParamTemplate(item[2], id);
+                if ( ok ) params = &converted.emplace(item[2], id).first->second;
+            }
+            else {
+                PyErr_SetString(PyExc_TypeError, "addComponents() expects params to be a dict or parameter template");
+                ok = false;
+            }
+        }
+
+        if ( ok ) {
+            char*         prefixed_name = gModel->addNamePrefix(name.c_str());
+            ComponentId_t id            = gModel->addComponent(prefixed_name, type.c_str());
+            gModel->getOutput()->verbose(
+                CALL_INFO, 3, 0, "Creating component [%s] of type [%s]: id [%" PRIu64 "]\n", prefixed_name,
+                type.c_str(), id);
+            free(prefixed_name);
+
+            if ( nullptr != params ) { gModel->getGraph()->findComponent(id)->addParamTemplate(*params); }
+            PyList_SET_ITEM(ids, i, PyLong_FromUnsignedLongLong(id));
+        }
+        Py_DECREF(entry);
+    }
+
+    Py_DECREF(seq);
+    if ( !ok ) {
+        Py_DECREF(ids);
+        return nullptr;
+    }
+    return ids;
+}
+
+static PyObject*
+createParamTemplate(PyObject* UNUSED(self), PyObject* arg)
+{
+    if ( !PyDict_Check(arg) ) {
+        PyErr_SetString(PyExc_TypeError, "createParamTemplate() expects a dict");
+        return nullptr;
+    }
+
+    std::vector<std::pair<std::string, std::string>> values;
+    if ( !pyDictToParams(arg, values) ) return nullptr;
+    return SST_ConvertToPythonLong(gModel->addParamTemplate(values));
+}
+
+static PyObject*
+addLinks(PyObject* UNUSED(self), PyObject* arg)
+{
+    PyObject* seq = PySequence_Fast(
+        arg, "addLinks() expects a sequence of (comp_a, port_a, comp_b, port_b, latency[, no_cut]) entries");
+    if ( nullptr == seq ) return nullptr;
+
+    Py_ssize_t  size = PySequence_Fast_GET_SIZE(seq);
+    bool        ok   = true;
+    std::string port_a, port_b, latency;
+    for ( Py_ssize_t i = 0; ok && i < size; i++ ) {
+        PyObject* entry = PySequence_Fast(
+            PySequence_Fast_GET_ITEM(seq, i),
+            "addLinks() expects (comp_a, port_a, comp_b, port_b, latency[, no_cut]) entries");
+        if ( nullptr == entry ) {
+            ok = false;
+            break;
+        }
+
+        Py_ssize_t       fields = PySequence_Fast_GET_SIZE(entry);
+        PyObject**       item   = PySequence_Fast_ITEMS(entry);
+        ConfigComponent* comp_a = nullptr;
+        ConfigComponent* comp_b = nullptr;
+        if ( fields < 5 || fields > 6 ) {
+            PyErr_SetString(
+                PyExc_ValueError, "addLinks() expects (comp_a, port_a, comp_b, port_b, latency[, no_cut]) entries");
+            ok = false;
+        }
+        else {
+            ok = (comp_a = findComponentByIdOrName(item[0])) && pyObjectToString(item[1], port_a) &&
+                 (comp_b = findComponentByIdOrName(item[2])) && pyObjectToString(item[3], port_b) &&
+                 pyObjectToString(item[4], latency);
+        }
+
+        if ( ok ) {
+            int no_cut = fields == 6 ? PyObject_IsTrue(item[5]) : 0;
+            ok         = no_cut != -1;
+
+            // A port can only be connected to one link, so the first
+            // end makes the link name unique among the bulk links.  The
+            // prefix keeps it apart from the names users give links,
+            // and a name that is taken anyway is an error.
+            std::string link_name = ok ? "bulk." + comp_a->getFullName() + "." + port_a : "";
+            if ( ok && gModel->containsLink(link_name) ) {
+                PyErr_Format(PyExc_ValueError, "addLinks() link name %s is already in use", link_name.c_str());
+                ok = false;
+            }
+            if ( ok ) {
+                gModel->getOutput()->verbose(
+                    CALL_INFO, 4, 0, "Connecting components %" PRIu64 " and %" PRIu64 " with Link %s (lat: %s)\n",
+                    comp_a->id, comp_b->id, link_name.c_str(), latency.c_str());
+                gModel->addLink(comp_a->id, link_name.c_str(), port_a.c_str(), latency.c_str(), no_cut);
+                gModel->addLink(comp_b->id, link_name.c_str(), port_b.c_str(), latency.c_str(), no_cut);
+            }
+        }
+        Py_DECREF(entry);
+    }
+
+    Py_DECREF(seq);
+    if ( !ok ) return nullptr;
+    return SST_ConvertToPythonLong(size);
+}
+
 static PyObject*
 setProgramOption(PyObject* UNUSED(self), PyObject* args)
 {
@@ -943,6 +1151,16 @@ static PyMethodDef sstModuleMethods[] = {
     { "findComponentByName", findComponentByName, METH_O,
       "Looks up to find a previously created component/subcomponent, based off of its name.  Returns None if none "
       "are to be found." },
+    { "addComponents", addComponents, METH_O,
+      "Creates components in bulk from a sequence of (name, type[, params]) entries, where params is a dict or "
+      "parameter template.  Each distinct dict is stored once as a parameter template shared by the components "
+      "using it.  Returns a list of the new component ids." },
+    { "createParamTemplate", createParamTemplate, METH_O,
+      "Creates a shared parameter template from a dict.  Returns the template id, which can be passed to "
+      "Component.addParamTemplate() or as the params of addComponents()." },
+    { "addLinks", addLinks, METH_O,
+      "Creates links in bulk from a sequence of (comp_a, port_a, comp_b, port_b, latency[, no_cut]) entries, where "
+      "components are given by id or name.  Returns the number of links created." },
     { "addGlobalParam", globalAddParam, METH_VARARGS, "Add a parameter to the specified global set." },
     { "addGlobalParams", globalAddParams, METH_VARARGS, "Add parameters in dictionary to the specified global set." },
     { "getElapsedExecutionTime", getElapsedExecutionTime, METH_NOARGS,
@@ -1312,6 +1530,23 @@ SST::Core::pythonToCppParams(PyObject* statParamDict)
     return p;
 }
 
+bool
+SST::Core::pyObjectToParamTemplate(PyObject* obj, uint32_t& id)
+{
+    // PyLong_AsUnsignedLongLong() raises OverflowError for negative
+    // values, so only ids above 32 bits need checking here
+    unsigned long long value = PyLong_AsUnsignedLongLong(obj);
+    if ( PyErr_Occurred() ) return false;
+    if ( value > UINT32_MAX ) {
+        PyErr_Format(PyExc_OverflowError, "Parameter template id out of range: %llu", value);
+        return false;
+    }
+    id = (uint32_t)value;
+    if ( gModel->hasParamTemplate(id) ) return true;
+    PyErr_Format(PyExc_ValueError, "Unknown parameter template: %" PRIu32, id);
+    return false;
+}
+
 PyObject*
 SST::Core::buildStatisticObject(StatisticId_t id)
 {
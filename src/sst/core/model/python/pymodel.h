@@ -105,6 +105,7 @@ public: /* Public, but private.  Called only from Python functions */
         graph->addLink(id, link_name, port, latency, no_cut);
     }
     void setLinkNoCut(const char* link_name) const { graph->setLinkNoCut(link_name); }
+    bool containsLink(const std::string& link_name) const { return graph->containsLink(link_name); }
 
     void  pushNamePrefix(const char* name);
     void  popNamePrefix(void);
@@ -122,6 +123,12 @@ public: /* Public, but private.  Called only from Python functions */
         insertGlobalParameter(set, key, value, overwrite);
     }
 
+    uint32_t addParamTemplate(const std::vector<std::pair<std::string, std::string>>& values)
+    {
+        return insertParamTemplate(values);
+    }
+    bool hasParamTemplate(uint32_t id) const { return id < getNumParamTemplates(); }
+
     UnitAlgebra getElapsedExecutionTime() const;
     UnitAlgebra getLocalMemoryUsage() const;
 
@@ -167,6 +174,9 @@ private:
 
 std::map<std::string, std::string> generateStatisticParameters(PyObject* statParamDict);
 SST::Params                        pythonToCppParams(PyObject* statParamDict);
+// Converts obj to the id of an existing parameter template, setting the
+// Python error and returning false if it is not one
+bool                               pyObjectToParamTemplate(PyObject* obj, uint32_t& id);
 PyObject*                          buildStatisticObject(StatisticId_t id);
 PyObject*
 buildEnabledStatistic(ConfigComponent* cc, const char* statName, PyObject* statParamDict, bool apply_to_children);
@@ -533,6 +533,18 @@ compAddGlobalParamSet(PyObject* self, PyObject* arg)
     return SST_ConvertToPythonLong(0);
 }
 
+static PyObject*
+compAddParamTemplate(PyObject* self, PyObject* arg)
+{
+    PyErr_Clear();
+    uint32_t id;
+    if ( !pyObjectToParamTemplate(arg, id) ) return nullptr;
+
+    ConfigComponent* c = getComp(self);
+    c->addParamTemplate(id);
+    return SST_ConvertToPythonLong(0);
+}
+
 static PyMethodDef componentMethods[] = {
     { "addParam", compAddParam, METH_VARARGS, "Adds a parameter(name, value)" },
     { "addParams", compAddParams, METH_O, "Adds Multiple Parameters from a dict" },
@@ -556,6 +568,8 @@ static PyMethodDef componentMethods[] = {
     { "setCoordinates", compSetCoords, METH_VARARGS,
       "Set (X,Y,Z) coordinates of this component, for use with visualization" },
     { "addGlobalParamSet", compAddGlobalParamSet, METH_O, "Add global parameter set to the component" },
+    { "addParamTemplate", compAddParamTemplate, METH_O,
+      "Add a parameter template from sst.createParamTemplate() to the component" },
     { nullptr, nullptr, 0, nullptr }
 };
 
@@ -666,6 +680,8 @@ static PyMethodDef subComponentMethods[] = {
     { "setStatistic", compSetStatistic, METH_VARARGS, "Reuse a statistic for the binding" },
     { "setSubComponent", compSetSubComponent, METH_VARARGS, "Bind a subcomponent to slot <name>, with type <type>" },
     { "addGlobalParamSet", compAddGlobalParamSet, METH_O, "Add global parameter set to the component" },
+    { "addParamTemplate", compAddParamTemplate, METH_O,
+      "Add a parameter template from sst.createParamTemplate() to the component" },
     { "setCoordinates", compSetCoords, METH_VARARGS,
       "Set (X,Y,Z) coordinates of this component, for use with visualization" },
     { nullptr, nullptr, 0, nullptr }
@@ -42,6 +42,24 @@ SSTModelDescription::insertGlobalParameter(
     Params::insert_global(set, key, value, overwrite);
 }
 
+uint32_t
+SSTModelDescription::insertParamTemplate(const std::vector<std::pair<Params::key_type, Params::key_type>>& values)
+{
+    return Params::insertParamTemplate(values);
+}
+
+uint32_t
+SSTModelDescription::getNumParamTemplates()
+{
+    return Params::getNumParamTemplates();
+}
+
+void
+SSTModelDescription::serializeParamsGlobals(SST::Core::Serialization::serializer& ser)
+{
+    Params::serializeGlobals(ser);
+}
+
 
 bool
 SSTModelDescription::isElementParallelCapable(const std::string& type)
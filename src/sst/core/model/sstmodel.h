@@ -79,6 +79,32 @@ protected:
     void insertGlobalParameter(
         const std::string& set, const Params::key_type& key, const Params::key_type& value, bool overwrite = true);
 
+    /**
+     * Allows ModelDefinition to create shared parameter templates,
+     * which components reference by id instead of holding their own
+     * copy of the parameters.
+     *
+     * @param values Key/value pairs of the template
+     *
+     * @return Id of the template, which is the same for identical sets of values
+     */
+    uint32_t insertParamTemplate(const std::vector<std::pair<Params::key_type, Params::key_type>>& values);
+
+    /**
+     * @return Number of parameter templates.  Template ids run from 0
+     * to one less than this.
+     */
+    static uint32_t getNumParamTemplates();
+
+    /**
+     * Allows ModelDefinition to restore the parameter key map and
+     * global parameter sets of a serialized graph.  This replaces any
+     * that already exist.
+     *
+     * @param ser serializer to unpack the data from
+     */
+    void serializeParamsGlobals(SST::Core::Serialization::serializer& ser);
+
 
 private:
     Config* config;
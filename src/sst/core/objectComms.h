@@ -146,6 +146,44 @@ all_gather(dataType& data, std::vector<dataType>& out_data)
     }
 }
 
+template <typename dataType>
+void
+gather(dataType& data, std::vector<dataType>& out_data, int root)
+{
+    int rank = 0, world = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &world);
+
+    // Serialize the data
+    std::vector<char> buffer = Comms::serialize(data);
+
+    // Only the root needs the sizes and the received data
+    int              sendSize = buffer.size();
+    std::vector<int> allSizes(rank == root ? world : 0);
+    std::vector<int> displ(rank == root ? world : 0);
+
+    MPI_Gather(&sendSize, 1, MPI_INT, allSizes.data(), 1, MPI_INT, root, MPI_COMM_WORLD);
+
+    int totalBuf = 0;
+    for ( size_t i = 0; i < allSizes.size(); i++ ) {
+        displ[i] = totalBuf;
+        totalBuf += allSizes[i];
+    }
+
+    std::vector<char> bigBuff(totalBuf);
+
+    MPI_Gatherv(
+        buffer.data(), sendSize, MPI_BYTE, bigBuff.data(), allSizes.data(), displ.data(), MPI_BYTE, root,
+        MPI_COMM_WORLD);
+
+    if ( rank != root ) return;
+
+    out_data.resize(world);
+    for ( int i = 0; i < world; i++ ) {
+        Comms::deserialize(bigBuff.data() + displ[i], allSizes[i], out_data[i]);
+    }
+}
+
 #endif
 
 } // namespace Comms
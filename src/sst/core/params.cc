@@ -16,6 +16,7 @@
 
 #include "sst/core/unitAlgebra.h"
 
+#include <algorithm>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -27,16 +28,32 @@ namespace SST {
 
 const std::string&
 Params::getString(const std::string& name, bool& found) const
+{
+    return getString(getKey(name), found);
+}
+
+const std::string&
+Params::getString(uint32_t id, bool& found) const
+{
+    bool global;
+    return getString(id, found, global);
+}
+
+const std::string&
+Params::getString(uint32_t id, bool& found, bool& global) const
 {
     static std::string empty;
-    for ( auto map : data ) {
-        auto value = map->find(getKey(name));
-        if ( value != map->end() ) {
-            found = true;
+    for ( size_t i = 0; i < data.size(); i++ ) {
+        auto value = data[i]->find(id);
+        if ( value != data[i]->end() ) {
+            found  = true;
+            // data[0] holds the local values and the templates follow it
+            global = i > templates.size();
             return value->second;
         }
     }
-    found = false;
+    found  = false;
+    global = false;
     return empty;
 }
 
@@ -60,6 +77,7 @@ Params::Params() : my_data(), verify_enabled(true)
 Params::Params(const Params& old) :
     my_data(old.my_data),
     data(old.data),
+    templates(old.templates),
     allowedKeys(old.allowedKeys),
     verify_enabled(old.verify_enabled)
 {
@@ -72,8 +90,10 @@ Params::operator=(const Params& old)
     my_data        = old.my_data;
     data           = old.data;
     data[0]        = &my_data;
+    templates      = old.templates;
     verify_enabled = old.verify_enabled;
     allowedKeys    = old.allowedKeys;
+    value_cache.reset();
     return *this;
 }
 
@@ -83,12 +103,14 @@ Params::clear()
     my_data.clear();
     data.clear();
     data.push_back(&my_data);
+    templates.clear();
+    value_cache.reset();
 }
 
 size_t
 Params::count(const key_type& k) const
 {
-    int key = getKey(k);
+    uint32_t key = getKey(k);
     for ( auto map : data ) {
         size_t count = map->count(key);
         if ( count > 0 ) return count;
@@ -144,19 +166,27 @@ Params::insert(const std::string& key, const std::string& value, bool overwrite)
         uint32_t id = getKey(key);
         my_data.insert(std::make_pair(id, value));
     }
+    value_cache.reset();
 }
 
 void
 Params::insert(const Params& params)
 {
     my_data.insert(params.my_data.begin(), params.my_data.end());
-    for ( size_t i = 1; i < params.data.size(); ++i ) {
+    // The templates of params are searched after this object's own
+    for ( uint32_t id : params.templates ) {
+        if ( std::find(templates.begin(), templates.end(), id) != templates.end() ) continue;
+        data.insert(data.begin() + 1 + templates.size(), &param_templates[id]);
+        templates.push_back(id);
+    }
+    for ( size_t i = 1 + params.templates.size(); i < params.data.size(); ++i ) {
         bool already_there = false;
         for ( auto x : data ) {
             if ( params.data[i] == x ) already_there = true;
         }
         if ( !already_there ) data.push_back(params.data[i]);
     }
+    value_cache.reset();
 }
 
 std::set<std::string>
@@ -193,8 +223,9 @@ Params::get_scoped_params(const std::string& scope) const
 bool
 Params::contains(const key_type& k) const
 {
+    uint32_t key = getKey(k);
     for ( auto map : data ) {
-        if ( map->find(getKey(k)) != map->end() ) return true;
+        if ( map->find(key) != map->end() ) return true;
     }
     return false;
 }
@@ -246,17 +277,20 @@ void
 Params::serialize_order(SST::Core::Serialization::serializer& ser)
 {
     ser&                     my_data;
-    // Serialize global params
+    // Templates and global params are serialized by id and name
+    ser&                     templates;
     std::vector<std::string> globals;
     switch ( ser.mode() ) {
     case SST::Core::Serialization::serializer::PACK:
     case SST::Core::Serialization::serializer::SIZER:
-        for ( size_t i = 1; i < data.size(); ++i ) {
+        for ( size_t i = 1 + templates.size(); i < data.size(); ++i ) {
             globals.push_back((*data[i])[0]);
         }
         ser& globals;
         break;
     case SST::Core::Serialization::serializer::UNPACK:
+        for ( auto x : templates )
+            data.push_back(&param_templates[x]);
         ser& globals;
         for ( auto x : globals )
             data.push_back(&global_params[x]);
@@ -287,6 +321,63 @@ Params::addGlobalParamSet(const std::string& set)
     if ( global_params.count(set) == 0 ) { global_params[set][0] = set; }
 
     data.push_back(&global_params[set]);
+    value_cache.reset();
+}
+
+void
+Params::addParamTemplate(uint32_t id)
+{
+    std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(globalLock);
+    if ( id >= param_templates.size() ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1, "Unknown parameter template %" PRIu32 "\n", id);
+    }
+    if ( std::find(templates.begin(), templates.end(), id) != templates.end() ) return;
+
+    data.insert(data.begin() + 1, &param_templates[id]);
+    templates.insert(templates.begin(), id);
+    value_cache.reset();
+}
+
+// Hash of the contents of a parameter template
+static size_t
+hashParamTemplate(const std::map<uint32_t, std::string>& contents)
+{
+    size_t hash = contents.size();
+    for ( auto& x : contents ) {
+        hash ^= x.first + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<std::string>()(x.second) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+uint32_t
+Params::insertParamTemplate(const std::vector<std::pair<key_type, key_type>>& values)
+{
+    std::map<uint32_t, std::string> contents;
+    for ( auto& x : values ) {
+        contents[getKey(x.first)] = x.second;
+    }
+
+    std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(globalLock);
+    size_t                                           hash  = hashParamTemplate(contents);
+    auto                                             range = param_template_index.equal_range(hash);
+    for ( auto it = range.first; it != range.second; ++it ) {
+        if ( param_templates[it->second] == contents ) return it->second;
+    }
+
+    uint32_t id = param_templates.size();
+    param_templates.emplace_back(std::move(contents));
+    param_template_index.emplace(hash, id);
+    return id;
+}
+
+void
+Params::rebuildParamTemplateIndex()
+{
+    param_template_index.clear();
+    for ( uint32_t id = 0; id < param_templates.size(); id++ ) {
+        param_template_index.emplace(hashParamTemplate(param_templates[id]), id);
+    }
 }
 
 void
@@ -405,6 +496,24 @@ Params::getGlobalParamSet(const std::string& name)
     return ret;
 }
 
+std::map<std::string, std::string>
+Params::getParamTemplate(uint32_t id)
+{
+    std::map<std::string, std::string> ret;
+    if ( id >= param_templates.size() ) return ret;
+
+    for ( auto x : param_templates[id] ) {
+        ret[getParamName(x.first)] = x.second;
+    }
+    return ret;
+}
+
+uint32_t
+Params::getNumParamTemplates()
+{
+    return param_templates.size();
+}
+
 std::vector<std::string>
 Params::getGlobalParamSetNames()
 {
@@ -416,6 +525,17 @@ Params::getGlobalParamSetNames()
     return ret;
 }
 
+void
+Params::serializeGlobals(SST::Core::Serialization::serializer& ser)
+{
+    ser& keyMap;
+    ser& keyMapReverse;
+    ser& nextKeyID;
+    ser& global_params;
+    ser& param_templates;
+    if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) rebuildParamTemplateIndex();
+}
+
 
 std::vector<std::string>
 Params::getLocalKeys() const
@@ -433,15 +553,21 @@ std::vector<std::string>
 Params::getSubscribedGlobalParamSets() const
 {
     std::vector<std::string> ret;
-    ret.reserve((data.size() - 1));
-    // Skip the first item because those are local params
-    for ( size_t i = 1; i < data.size(); ++i ) {
+    ret.reserve((data.size() - 1 - templates.size()));
+    // Skip the local params and the templates
+    for ( size_t i = 1 + templates.size(); i < data.size(); ++i ) {
         // To get <set_name> key, need to use keyID 0
         ret.push_back((*data[i])[0]);
     }
     return ret;
 }
 
+std::vector<uint32_t>
+Params::getParamTemplates() const
+{
+    return std::vector<uint32_t>(templates.rbegin(), templates.rend());
+}
+
 #if 0
  template<>
  uint32_t Params::find(const std::string& k) const
@@ -500,15 +626,17 @@ Params::getSubscribedGlobalParamSets() const
  }
 #endif
 
-std::map<std::string, uint32_t> Params::keyMap;
+std::unordered_map<std::string, uint32_t> Params::keyMap;
 // Index 0 in params is used for set name
-std::vector<std::string>        Params::keyMapReverse({ "<set_name>" });
-uint32_t                        Params::nextKeyID = 1;
-Core::ThreadSafe::Spinlock      Params::keyLock;
-Core::ThreadSafe::Spinlock      Params::globalLock;
+std::vector<std::string>                  Params::keyMapReverse({ "<set_name>" });
+uint32_t                                  Params::nextKeyID = 1;
+Core::ThreadSafe::Spinlock                Params::keyLock;
+Core::ThreadSafe::Spinlock                Params::globalLock;
 // ID 0 is reserved for holding metadata
-bool                            Params::g_verify_enabled = false;
+bool                                      Params::g_verify_enabled = false;
 
 std::map<std::string, std::map<uint32_t, std::string>> Params::global_params;
+std::deque<std::map<uint32_t, std::string>>            Params::param_templates;
+std::unordered_multimap<size_t, uint32_t>              Params::param_template_index;
 
 } // namespace SST
@@ -18,14 +18,19 @@
 #include "sst/core/serialization/serializer.h"
 #include "sst/core/threadsafe.h"
 
+#include <atomic>
 #include <cassert>
+#include <deque>
 #include <inttypes.h>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
 #include <stdlib.h>
+#include <typeindex>
+#include <unordered_map>
 #include <utility>
 
 int main(int argc, char* argv[]);
@@ -196,6 +201,8 @@ NO_VARIABLE:
     typedef std::map<uint32_t, std::string>::const_iterator const_iterator; /*!< Const Iterator type */
 
     const std::string& getString(const std::string& name, bool& found) const;
+    const std::string& getString(uint32_t id, bool& found) const;
+    const std::string& getString(uint32_t id, bool& found, bool& global) const;
 
     /**
        Private function to clean up a token. It will remove leading
@@ -232,6 +239,46 @@ public:
     typedef std::string                    key_type; /*!< Type of key (string) */
     typedef std::set<key_type, KeyCompare> KeySet_t; /*!< Type of a set of keys */
 
+    /**
+     * Handle for a parameter name that is resolved to its internal
+     * key id once and then reused.  Code that looks up the same
+     * parameter many times, such as subcomponents or modules loaded
+     * during the run, can keep a static Key and pass it to find() in
+     * place of the name.
+     *
+     * The id is resolved on first use rather than on construction, so
+     * a Key can be a namespace scope static in an element library.
+     */
+    class Key
+    {
+    public:
+        explicit Key(const key_type& name) : name(name), id(unresolved) {}
+        Key(const Key& other) : name(other.name), id(other.id.load(std::memory_order_relaxed)) {}
+
+        /** Get the parameter name */
+        const key_type& getName() const { return name; }
+
+        /** Get the internal key id of the parameter name */
+        uint32_t getId() const
+        {
+            uint32_t ret = id.load(std::memory_order_relaxed);
+            if ( ret == unresolved ) {
+                ret = Params::getKey(name);
+                id.store(ret, std::memory_order_relaxed);
+            }
+            return ret;
+        }
+
+    private:
+        Key& operator=(const Key&) = delete;
+
+        // Key id 0 is reserved, so never refers to a parameter
+        static constexpr uint32_t unresolved = 0;
+
+        const key_type                name;
+        mutable std::atomic<uint32_t> id;
+    };
+
     /**
      * Enable or disable parameter verification on an instance
      * of Params.  Useful when generating a new set of Params to
@@ -439,6 +486,123 @@ public:
         return find_impl<T>(k, default_value, found);
     }
 
+    /** Find a Parameter value in the set using a key handle, and
+     * return its value as a type T.  The converted value is cached in
+     * this Params object, so repeated lookups of the same key and type
+     * skip the string conversion.  Values that come from a global
+     * param set are converted on every lookup, since the set can still
+     * change through insert_global().  Like the other non-const
+     * methods, this means a Params object must not be used for cached
+     * lookups from more than one thread at a time.  Type T has the same
+     * requirements as for find() with a string key.
+     * @param k - Parameter key
+     * @param default_value - Default value to return if parameter isn't found
+     * @param found - set to true if the the parameter was found
+     * @throw std::invalid_argument If value in (key, value) can't be
+     * converted to type T, an invalid_argument exception is thrown.
+     */
+    template <class T>
+    typename std::enable_if<not std::is_same<std::string, T>::value, T>::type
+    find(const Key& k, T default_value, bool& found) const
+    {
+        std::shared_ptr<const T> value = find_cached<T>(k, found);
+        return found ? *value : default_value;
+    }
+
+    /** Find a Parameter value in the set using a key handle, and
+     * return its value as a type T.  See find(const Key&, T, bool&).
+     * @param k - Parameter key
+     * @param default_value - Default value to return if parameter isn't found,
+     *   specified as a string
+     * @param found - set to true if the the parameter was found
+     */
+    template <class T>
+    T find(const Key& k, const std::string& default_value, bool& found) const
+    {
+        std::shared_ptr<const T> value = find_cached<T>(k, found);
+        if ( found ) return *value;
+        return find_impl<T>(k.getName(), default_value, found);
+    }
+
+    /** Find a Parameter value in the set using a key handle, and
+     * return its value as a type T.  This version is only enabled for
+     * bool, see find(const std::string&, const char*, bool&).
+     * @param k - Parameter key
+     * @param default_value - Default value to return if parameter isn't found,
+     *   specified as a string literal
+     * @param found - set to true if the the parameter was found
+     */
+    template <class T>
+    typename std::enable_if<std::is_same<bool, T>::value, T>::type
+    find(const Key& k, const char* default_value, bool& found) const
+    {
+        if ( nullptr == default_value ) { return find<T>(k, static_cast<T>(0), found); }
+        return find<T>(k, std::string(default_value), found);
+    }
+
+    /** Find a Parameter value in the set using a key handle, and
+     * return its value as a type T.  See find(const Key&, T, bool&).
+     * @param k - Parameter key
+     * @param default_value - Default value to return if parameter isn't found
+     */
+    template <class T>
+    typename std::enable_if<not std::is_same<std::string, T>::value, T>::type
+    find(const Key& k, T default_value) const
+    {
+        bool tmp;
+        return find<T>(k, default_value, tmp);
+    }
+
+    /** Find a Parameter value in the set using a key handle, and
+     * return its value as a type T.  See find(const Key&, T, bool&).
+     * @param k - Parameter key
+     * @param default_value - Default value to return if parameter isn't found,
+     *   specified as a string
+     */
+    template <class T>
+    T find(const Key& k, const std::string& default_value) const
+    {
+        bool tmp;
+        return find<T>(k, default_value, tmp);
+    }
+
+    /** Find a Parameter value in the set using a key handle, and
+     * return its value as a type T.  This version is only enabled for
+     * bool, see find(const std::string&, const char*).
+     * @param k - Parameter key
+     * @param default_value - Default value to return if parameter isn't found,
+     *   specified as a string literal
+     */
+    template <class T>
+    typename std::enable_if<std::is_same<bool, T>::value, T>::type find(const Key& k, const char* default_value) const
+    {
+        bool tmp;
+        return find<T>(k, default_value, tmp);
+    }
+
+    /** Find a Parameter value in the set using a key handle, and
+     * return its value as a type T.  See find(const Key&, T, bool&).
+     * @param k - Parameter key
+     */
+    template <class T>
+    T find(const Key& k) const
+    {
+        bool tmp;
+        return find<T>(k, T(), tmp);
+    }
+
+    /** Find a Parameter value in the set using a key handle, and
+     * return its value as a type T.  This version is not enabled for
+     * bool, see find(const std::string&, bool&).
+     * @param k - Parameter key
+     * @param found - set to true if the the parameter was found
+     */
+    template <class T>
+    typename std::enable_if<not std::is_same<bool, T>::value, T>::type find(const Key& k, bool& found) const
+    {
+        return find<T>(k, T(), found);
+    }
+
     /** Find a Parameter value in the set, and return its value as a
      * vector of T's.  The array will be appended to
      * the end of the vector.
@@ -866,6 +1030,46 @@ private:
      */
     void addGlobalParamSet(const std::string& set);
 
+    /**
+     * Adds a parameter template to be looked at in this Params object
+     * if the key isn't found locally.  Templates are searched before
+     * any global sets, most recently added first.  The template is
+     * shared, not copied, so values inserted into this object are
+     * stored locally as overrides of the template.
+     *
+     * @param id id of the template returned by insertParamTemplate()
+     */
+    void addParamTemplate(uint32_t id);
+
+    /**
+     * Creates a parameter template that can be shared by many Params
+     * objects.  Templates are kept apart from the global param sets,
+     * are broadcast once with them, and a Params object only
+     * serializes the ids of its templates.  Inserting the same
+     * key/value pairs more than once returns the existing template.
+     *
+     * @param values key/value pairs of the template
+     *
+     * @return id of the template
+     */
+    static uint32_t insertParamTemplate(const std::vector<std::pair<key_type, key_type>>& values);
+
+    /**
+     * Get the contents of a parameter template
+     *
+     * @param id id of the template
+     *
+     * @return returns a copy of the template, empty if there is no
+     * template with that id
+     */
+    static std::map<std::string, std::string> getParamTemplate(uint32_t id);
+
+    /**
+     * Get the number of parameter templates.  Template ids run from 0
+     * to one less than this.
+     */
+    static uint32_t getNumParamTemplates();
+
     /**
      * Adds a key/value pair to the specified global set
      *
@@ -900,6 +1104,15 @@ private:
      */
     static std::vector<std::string> getGlobalParamSetNames();
 
+    /**
+     * Serializes the key map and the global param sets.  A
+     * serialized Params object refers to both, so they must be
+     * unpacked before it is.
+     *
+     * @param ser serializer to pack into or unpack from
+     */
+    static void serializeGlobals(SST::Core::Serialization::serializer& ser);
+
     /**
      * Get a vector of the local keys
      *
@@ -919,6 +1132,14 @@ private:
      */
     std::vector<std::string> getSubscribedGlobalParamSets() const;
 
+    /**
+     * Get a vector of the ids of the parameter templates this Params
+     * object uses, in the order they were added
+     *
+     * @return returns a vector of the parameter template ids
+     */
+    std::vector<uint32_t> getParamTemplates() const;
+
 
     // Private functions used by Params
     /**
@@ -927,14 +1148,64 @@ private:
      */
     void verifyKey(const key_type& k) const;
 
+    /** Private utility function to find a Parameter value in the set
+     * by key handle, and return its value converted to type T.  The
+     * converted value is cached, so later lookups of the same key and
+     * type skip the conversion.  Values from global param sets are not
+     * cached, since insert_global() does not clear the caches of the
+     * Params objects subscribed to the set.
+     *
+     * Although this is const, it fills the mutable value_cache, so it
+     * must not be called on one Params object from more than one
+     * thread at a time.
+     * @param k - Parameter key
+     * @param found - set to true if the the parameter was found
+     * @return pointer to the converted value, or nullptr if not found
+     * @throw std::invalid_argument If value in (key, value) can't be
+     * converted to type T, an invalid_argument exception is thrown.
+     */
+    template <class T>
+    std::shared_ptr<const T> find_cached(const Key& k, bool& found) const
+    {
+        verifyKey(k.getName());
+        uint32_t id        = k.getId();
+        auto     cache_key = std::make_pair(id, std::type_index(typeid(T)));
+        if ( value_cache ) {
+            auto it = value_cache->find(cache_key);
+            if ( it != value_cache->end() ) {
+                found = true;
+                return std::static_pointer_cast<const T>(it->second);
+            }
+        }
+
+        bool               global;
+        const std::string& value = getString(id, found, global);
+        if ( !found ) return nullptr;
+
+        std::shared_ptr<T> converted = std::make_shared<T>(convert_value<T>(k.getName(), value));
+        if ( global ) return converted;
+        if ( !value_cache ) value_cache.reset(new ValueCache_t());
+        value_cache->emplace(cache_key, converted);
+        return converted;
+    }
+
 
     // Private data
     std::map<uint32_t, std::string>               my_data;
     std::vector<std::map<uint32_t, std::string>*> data;
+    // Ids of the templates in data[1] to data[templates.size()],
+    // in the same (search) order
+    std::vector<uint32_t>                         templates;
     std::vector<KeySet_t>                         allowedKeys;
     bool                                          verify_enabled;
     static bool                                   g_verify_enabled;
 
+    // Values converted by find() with a Key, created on first use.
+    // Cleared whenever the contents change and never copied.  Values
+    // from global param sets, which can change, are never cached.
+    typedef std::map<std::pair<uint32_t, std::type_index>, std::shared_ptr<void>> ValueCache_t;
+    mutable std::unique_ptr<ValueCache_t>                                         value_cache;
+
     static uint32_t getKey(const std::string& str);
 
     /**
@@ -944,16 +1215,28 @@ private:
      */
     static const std::string& getParamName(uint32_t id);
 
+    /**
+     * Rebuild param_template_index from param_templates.  Must be
+     * called after param_templates is replaced, e.g. by a broadcast
+     */
+    static void rebuildParamTemplateIndex();
+
     /* Friend main() because it broadcasts the maps */
     friend int ::main(int argc, char* argv[]);
 
-    static std::map<std::string, uint32_t> keyMap;
-    static std::vector<std::string>        keyMapReverse;
-    static SST::Core::ThreadSafe::Spinlock keyLock;
-    static SST::Core::ThreadSafe::Spinlock globalLock;
-    static uint32_t                        nextKeyID;
+    static std::unordered_map<std::string, uint32_t> keyMap;
+    static std::vector<std::string>                  keyMapReverse;
+    static SST::Core::ThreadSafe::Spinlock           keyLock;
+    static SST::Core::ThreadSafe::Spinlock           globalLock;
+    static uint32_t                                  nextKeyID;
 
     static std::map<std::string, std::map<uint32_t, std::string>> global_params;
+
+    // Parameter templates, indexed by id.  A deque keeps each template
+    // in place as more are added, since Params objects point to them.
+    static std::deque<std::map<uint32_t, std::string>> param_templates;
+    // Ids of the templates, by hash of contents
+    static std::unordered_multimap<size_t, uint32_t>   param_template_index;
 };
 
 #if 0
@@ -119,6 +119,28 @@ ClockHandlerProfileToolTime<T>::outputData(FILE* fp)
 }
 
 
+ClockHandlerProfileToolCost::ClockHandlerProfileToolCost(const std::string& name, Params& params) :
+    ClockHandlerProfileTool(name, params)
+{}
+
+uintptr_t
+ClockHandlerProfileToolCost::registerHandler(const HandlerMetaData& mdata)
+{
+    const ClockHandlerMetaData& data = dynamic_cast<const ClockHandlerMetaData&>(mdata);
+    return reinterpret_cast<uintptr_t>(&costs_[data.comp_id]);
+}
+
+void
+ClockHandlerProfileToolCost::outputData(FILE* fp)
+{
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "clock_cost, component id, count, handler time (ns)\n");
+    for ( auto& x : costs_ ) {
+        fprintf(fp, "clock_cost, %" PRIu64 ", %" PRIu64 ", %" PRIu64 "\n", x.first, x.second.count, x.second.time);
+    }
+}
+
+
 class ClockHandlerProfileToolTimeHighResolution : public ClockHandlerProfileToolTime<std::chrono::high_resolution_clock>
 {
 public:
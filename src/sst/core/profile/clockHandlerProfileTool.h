@@ -115,6 +115,54 @@ private:
     std::map<std::string, clock_data_t> times_;
 };
 
+/**
+   Profile tool that will record the clock handler time of each
+   (sub)component.  The output can be passed to the sst.profiled
+   partitioner using --partitioner-cost-file.
+ */
+class ClockHandlerProfileToolCost : public ClockHandlerProfileTool
+{
+    struct clock_data_t
+    {
+        uint64_t time;
+        uint64_t count;
+
+        clock_data_t() : time(0), count(0) {}
+    };
+
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        ClockHandlerProfileToolCost,
+        SST::Profile::ClockHandlerProfileTool,
+        "sst",
+        "profile.handler.clock.cost",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will record clock handler time for each component, for use by the profiled partitioner"
+    )
+
+    ClockHandlerProfileToolCost(const std::string& name, Params& params);
+
+    virtual ~ClockHandlerProfileToolCost() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { start_time_ = std::chrono::steady_clock::now(); }
+
+    void handlerEnd(uintptr_t key) override
+    {
+        auto          total_time = std::chrono::steady_clock::now() - start_time_;
+        clock_data_t* entry      = reinterpret_cast<clock_data_t*>(key);
+        entry->time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry->count++;
+    }
+
+    void outputData(FILE* fp) override;
+
+private:
+    std::chrono::steady_clock::time_point start_time_;
+    std::map<ComponentId_t, clock_data_t> costs_;
+};
+
 } // namespace Profile
 } // namespace SST
 
@@ -145,6 +145,34 @@ EventHandlerProfileToolTime<T>::outputData(FILE* fp)
 }
 
 
+EventHandlerProfileToolCost::EventHandlerProfileToolCost(const std::string& name, Params& params) :
+    EventHandlerProfileTool(name, params)
+{
+    // Costs are tracked per port and need both directions
+    profile_sends_    = true;
+    profile_receives_ = true;
+}
+
+uintptr_t
+EventHandlerProfileToolCost::registerHandler(const HandlerMetaData& mdata)
+{
+    const EventHandlerMetaData& data = dynamic_cast<const EventHandlerMetaData&>(mdata);
+    return reinterpret_cast<uintptr_t>(&costs_[std::make_pair(data.comp_id, data.port_name)]);
+}
+
+void
+EventHandlerProfileToolCost::outputData(FILE* fp)
+{
+    fprintf(fp, "%s\n", name.c_str());
+    fprintf(fp, "event_cost, component id, port, recv count, recv time (ns), send count\n");
+    for ( auto& x : costs_ ) {
+        fprintf(
+            fp, "event_cost, %" PRIu64 ", %s, %" PRIu64 ", %" PRIu64 ", %" PRIu64 "\n", x.first.first,
+            x.first.second.c_str(), x.second.recv_count, x.second.recv_time, x.second.send_count);
+    }
+}
+
+
 class EventHandlerProfileToolTimeHighResolution : public EventHandlerProfileToolTime<std::chrono::high_resolution_clock>
 {
 public:
@@ -139,6 +139,58 @@ private:
     std::map<std::string, event_data_t> times_;
 };
 
+/**
+   Profile tool that will record the handler time and the number of
+   events sent and received on each port of each (sub)component.  The
+   output can be passed to the sst.profiled partitioner using
+   --partitioner-cost-file.
+ */
+class EventHandlerProfileToolCost : public EventHandlerProfileTool
+{
+    struct event_data_t
+    {
+        uint64_t recv_time;
+        uint64_t recv_count;
+        uint64_t send_count;
+
+        event_data_t() : recv_time(0), recv_count(0), send_count(0) {}
+    };
+
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolCost,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.cost",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will record handler time and event counts for each port, for use by the profiled partitioner"
+    )
+
+    EventHandlerProfileToolCost(const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolCost() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { start_time_ = std::chrono::steady_clock::now(); }
+
+    void handlerEnd(uintptr_t key) override
+    {
+        auto          total_time = std::chrono::steady_clock::now() - start_time_;
+        event_data_t* entry      = reinterpret_cast<event_data_t*>(key);
+        entry->recv_time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry->recv_count++;
+    }
+
+    void eventSent(uintptr_t key, Event* UNUSED(ev)) override { reinterpret_cast<event_data_t*>(key)->send_count++; }
+
+    void outputData(FILE* fp) override;
+
+private:
+    std::chrono::steady_clock::time_point                          start_time_;
+    std::map<std::pair<ComponentId_t, std::string>, event_data_t> costs_;
+};
+
 } // namespace Profile
 } // namespace SST
 
@@ -48,6 +48,16 @@ public:
     */
     double getNextDouble() { return mean; }
 
+    /**
+        Fills out with count copies of the constant value
+    */
+    void fill(double* out, size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ ) {
+            out[i] = mean;
+        }
+    }
+
     /**
         Gets the constant value for the distribution
         \return Constant value specified by the user when creating the class
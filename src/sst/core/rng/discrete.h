@@ -105,6 +105,23 @@ public:
         return (double)index;
     }
 
+    /**
+        Fills out with the next count doubles from the distribution, drawing the uniform
+        numbers from the base generator in one call. The values are the same as count calls
+        to getNextDouble() would return.
+    */
+    void fill(double* out, size_t count)
+    {
+        baseDistrib->fillUniform(out, count);
+        for ( size_t i = 0; i < count; i++ ) {
+            uint32_t index = 0;
+            for ( ; index < probCount; index++ ) {
+                if ( probabilities[index] >= out[i] ) { break; }
+            }
+            out[i] = (double)index;
+        }
+    }
+
 protected:
     /**
         Sets the base random number generator for the distribution.
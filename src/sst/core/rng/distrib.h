@@ -12,6 +12,8 @@
 #ifndef SST_CORE_RNG_DISTRIB_H
 #define SST_CORE_RNG_DISTRIB_H
 
+#include <stddef.h>
+
 namespace SST {
 namespace RNG {
 
@@ -29,6 +31,19 @@ public:
     */
     virtual double getNextDouble() = 0;
 
+    /**
+        Fills out with the next count doubles from the distribution. Distributions
+        override this to draw the numbers from their generator in bulk.
+        \param out The array to fill
+        \param count The number of doubles to sample
+    */
+    virtual void fill(double* out, size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ ) {
+            out[i] = getNextDouble();
+        }
+    }
+
     /**
         Destroys the distribution
     */
@@ -75,6 +75,19 @@ public:
         return log(1 - next) / (-1 * lambda);
     }
 
+    /**
+        Fills out with the next count doubles from the distribution, drawing the uniform
+        numbers from the base generator in one call. The values are the same as count calls
+        to getNextDouble() would return.
+    */
+    void fill(double* out, size_t count)
+    {
+        baseDistrib->fillUniform(out, count);
+        for ( size_t i = 0; i < count; i++ ) {
+            out[i] = log(1 - out[i]) / (-1 * lambda);
+        }
+    }
+
     /**
         Gets the lambda with which the distribution was created
         \return The lambda which the user created the distribution with
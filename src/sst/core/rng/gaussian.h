@@ -104,6 +104,49 @@ public:
         }
     }
 
+    /**
+        Fills out with the next count doubles from the distribution. This uses the ziggurat
+        method, which needs one 64-bit number from the base generator and no transcendental
+        functions for almost every value, so it draws different numbers from the same
+        distribution than getNextDouble() would.
+        \param out The array to fill
+        \param count The number of doubles to sample
+    */
+    void fill(double* out, size_t count)
+    {
+        const ZigguratTables& zig = getZigguratTables();
+        uint64_t              bits[256];
+
+        if ( usePair && count != 0 ) {
+            usePair = false;
+            *out++  = unusedPair;
+            count--;
+        }
+
+        while ( count != 0 ) {
+            const size_t n = count < 256 ? count : 256;
+            baseDistrib->fillUInt64(bits, n);
+
+            // The fast path: a point inside the rectangle of its layer
+            for ( size_t i = 0; i < n; i++ ) {
+                const int    layer = bits[i] & (ZigguratLayers - 1);
+                const double u     = zigguratUniform(bits[i]);
+                out[i]             = mean + stddev * u * zig.x[layer];
+            }
+
+            // The few points outside the rectangles are tested against the curve
+            for ( size_t i = 0; i < n; i++ ) {
+                const int layer = bits[i] & (ZigguratLayers - 1);
+                if ( fabs(zigguratUniform(bits[i])) >= zig.r[layer] ) {
+                    out[i] = mean + stddev * zigguratSlow(zig, bits[i]);
+                }
+            }
+
+            out += n;
+            count -= n;
+        }
+    }
+
     /**
         Gets the mean of the distribution
         \return The mean of the Guassian distribution
@@ -116,6 +159,93 @@ public:
     */
     double getStandardDev() { return stddev; }
 
+protected:
+    /**
+        Number of layers in the ziggurat
+    */
+    static const int ZigguratLayers = 128;
+
+    /**
+        Tables of the ziggurat for a standard normal distribution, from Doornik, "An Improved
+        Ziggurat Method to Generate Normal Random Samples" (2005)
+    */
+    struct ZigguratTables
+    {
+        /** Right edge of each layer, x[0] being the width of the base including the tail */
+        double x[ZigguratLayers + 1];
+        /** Ratio of the next layer's edge to this one's, below which a point is accepted */
+        double r[ZigguratLayers];
+
+        ZigguratTables()
+        {
+            const double tail = 3.442619855899;
+            const double area = 9.91256303526217e-3;
+            double       f    = exp(-0.5 * tail * tail);
+
+            x[0]              = area / f;
+            x[1]              = tail;
+            x[ZigguratLayers] = 0;
+            for ( int i = 2; i < ZigguratLayers; i++ ) {
+                x[i] = sqrt(-2 * log(area / x[i - 1] + f));
+                f    = exp(-0.5 * x[i] * x[i]);
+            }
+            for ( int i = 0; i < ZigguratLayers; i++ ) {
+                r[i] = x[i + 1] / x[i];
+            }
+        }
+    };
+
+    /**
+        Gets the ziggurat tables, which are built the first time they are used
+    */
+    static const ZigguratTables& getZigguratTables()
+    {
+        static const ZigguratTables tables;
+        return tables;
+    }
+
+    /**
+        Turns the top 53 bits of a random number into a double in [-1, 1). The low bits
+        choose the layer.
+    */
+    static double zigguratUniform(uint64_t bits)
+    {
+        return static_cast<double>(bits >> 11) * (2.0 / 9007199254740992.0) - 1.0;
+    }
+
+    /**
+        Finishes drawing a value whose first point fell outside the rectangle of its
+        layer, by sampling the tail or testing the point against the curve and starting
+        over with new random numbers when it is rejected
+    */
+    double zigguratSlow(const ZigguratTables& zig, uint64_t bits)
+    {
+        while ( true ) {
+            const int    layer = bits & (ZigguratLayers - 1);
+            const double u     = zigguratUniform(bits);
+
+            if ( fabs(u) < zig.r[layer] ) { return u * zig.x[layer]; }
+
+            if ( layer == 0 ) {
+                // Sample the tail beyond x[1] (Marsaglia, 1964)
+                const double tail = zig.x[1];
+                double       tx, ty;
+                do {
+                    tx = log(1 - baseDistrib->nextUniform()) / tail;
+                    ty = log(1 - baseDistrib->nextUniform());
+                } while ( -2 * ty < tx * tx );
+                return u < 0 ? tx - tail : tail - tx;
+            }
+
+            const double px = u * zig.x[layer];
+            const double f0 = exp(-0.5 * (zig.x[layer] * zig.x[layer] - px * px));
+            const double f1 = exp(-0.5 * (zig.x[layer + 1] * zig.x[layer + 1] - px * px));
+            if ( f1 + baseDistrib->nextUniform() * (f0 - f1) < 1.0 ) { return px; }
+
+            bits = baseDistrib->generateNextUInt64();
+        }
+    }
+
 protected:
     /**
         The mean of the Gaussian distribution
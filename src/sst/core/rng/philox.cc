@@ -0,0 +1,245 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "philox.h"
+
+#include "sst/core/sst_types.h"
+
+#include "rng.h"
+
+using namespace SST;
+using namespace SST::RNG;
+
+// Multipliers and key increments from the Philox paper
+#define PHILOX_M0     0xD2511F53U
+#define PHILOX_M1     0xCD9E8D57U
+#define PHILOX_W0     0x9E3779B9U
+#define PHILOX_W1     0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+// Number of blocks generateBlocks() computes side by side
+#define PHILOX_LANES 32
+
+// Number of 32-bit values staged at a time by the 64-bit and uniform fills
+#define PHILOX_STAGE 512
+
+PhiloxRNG::PhiloxRNG(uint32_t startSeed, uint64_t componentId, uint32_t streamId) : SST::RNG::Random()
+{
+    seed(startSeed, componentId, streamId);
+}
+
+/*
+    The counter is the block index in its low 64 bits and the component ID in its high
+    64 bits, so every component has a counter space of its own. The seed and the stream
+    ID each take one word of the key, so no two (seed, stream) pairs share a key.
+*/
+void
+PhiloxRNG::seed(uint32_t newSeed, uint64_t componentId, uint32_t streamId)
+{
+    key[0]    = newSeed;
+    key[1]    = streamId;
+    component = componentId;
+    position  = 0;
+}
+
+void
+PhiloxRNG::generateBlock(const uint32_t key[2], uint64_t component, uint64_t index, uint32_t out[4])
+{
+    uint32_t c0 = (uint32_t)index;
+    uint32_t c1 = (uint32_t)(index >> 32);
+    uint32_t c2 = (uint32_t)component;
+    uint32_t c3 = (uint32_t)(component >> 32);
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+
+    for ( int round = 0; round < PHILOX_ROUNDS; round++ ) {
+        const uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+        const uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t)p1;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t)p0;
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+/*
+    The same rounds as generateBlock(), run on PHILOX_LANES blocks at once with each word
+    of the counter in its own array, so each step of a round is one loop over the lanes
+    that the compiler can turn into vector instructions.
+*/
+void
+PhiloxRNG::generateBlocks(const uint32_t key[2], uint64_t component, uint64_t index, size_t count, uint32_t* out)
+{
+    while ( count >= PHILOX_LANES ) {
+        uint32_t c0[PHILOX_LANES], c1[PHILOX_LANES], c2[PHILOX_LANES], c3[PHILOX_LANES];
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+
+        for ( int lane = 0; lane < PHILOX_LANES; lane++ ) {
+            c0[lane] = (uint32_t)(index + lane);
+            c1[lane] = (uint32_t)((index + lane) >> 32);
+            c2[lane] = (uint32_t)component;
+            c3[lane] = (uint32_t)(component >> 32);
+        }
+
+        for ( int round = 0; round < PHILOX_ROUNDS; round++ ) {
+            for ( int lane = 0; lane < PHILOX_LANES; lane++ ) {
+                const uint64_t p0 = (uint64_t)PHILOX_M0 * c0[lane];
+                const uint64_t p1 = (uint64_t)PHILOX_M1 * c2[lane];
+
+                c0[lane] = (uint32_t)(p1 >> 32) ^ c1[lane] ^ k0;
+                c1[lane] = (uint32_t)p1;
+                c2[lane] = (uint32_t)(p0 >> 32) ^ c3[lane] ^ k1;
+                c3[lane] = (uint32_t)p0;
+            }
+
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+
+        for ( int lane = 0; lane < PHILOX_LANES; lane++ ) {
+            out[4 * lane]     = c0[lane];
+            out[4 * lane + 1] = c1[lane];
+            out[4 * lane + 2] = c2[lane];
+            out[4 * lane + 3] = c3[lane];
+        }
+
+        index += PHILOX_LANES;
+        count -= PHILOX_LANES;
+        out += 4 * PHILOX_LANES;
+    }
+
+    for ( ; count != 0; count-- ) {
+        generateBlock(key, component, index++, out);
+        out += 4;
+    }
+}
+
+/*
+    Finishes the current block from the saved copy, writes whole blocks straight into out,
+    and generates the last, partial block into the saved copy.
+*/
+void
+PhiloxRNG::fillUInt32(uint32_t* out, size_t count)
+{
+    while ( count != 0 && (position & 3) != 0 ) {
+        *out++ = block[position++ & 3];
+        count--;
+    }
+
+    const size_t blocks = count >> 2;
+    generateBlocks(key, component, position >> 2, blocks, out);
+    position += 4 * blocks;
+    out += 4 * blocks;
+
+    for ( size_t i = 0; i < (count & 3); i++ ) {
+        out[i] = generateNextUInt32();
+    }
+}
+
+void
+PhiloxRNG::fillUInt64(uint64_t* out, size_t count)
+{
+    uint32_t stage[PHILOX_STAGE];
+
+    while ( count != 0 ) {
+        const size_t n = count < PHILOX_STAGE / 2 ? count : PHILOX_STAGE / 2;
+        fillUInt32(stage, 2 * n);
+        for ( size_t i = 0; i < n; i++ ) {
+            out[i] = ((uint64_t)stage[2 * i + 1] << 32) | stage[2 * i];
+        }
+        out += n;
+        count -= n;
+    }
+}
+
+void
+PhiloxRNG::fillUniform(double* out, size_t count)
+{
+    uint32_t stage[PHILOX_STAGE];
+
+    while ( count != 0 ) {
+        const size_t n = count < PHILOX_STAGE / 2 ? count : PHILOX_STAGE / 2;
+        fillUInt32(stage, 2 * n);
+        for ( size_t i = 0; i < n; i++ ) {
+            const uint64_t next = ((uint64_t)stage[2 * i + 1] << 32) | stage[2 * i];
+            out[i]              = static_cast<double>(next >> 11) * (1.0 / 9007199254740992.0);
+        }
+        out += n;
+        count -= n;
+    }
+}
+
+void
+PhiloxRNG::skip(uint64_t count)
+{
+    setPosition(position + count);
+}
+
+void
+PhiloxRNG::setPosition(uint64_t newPosition)
+{
+    position = newPosition;
+
+    // Blocks are generated when their first value is drawn, so a
+    // position inside a block needs the block now
+    if ( (position & 3) != 0 ) generateBlock(key, component, position >> 2, block);
+}
+
+/*
+    Transform the top 53 bits of an unsigned 64-bit integer into a uniform double, which
+    is always in the range [0, 1).
+*/
+double
+PhiloxRNG::nextUniform()
+{
+    return static_cast<double>(generateNextUInt64() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+uint32_t
+PhiloxRNG::generateNextUInt32()
+{
+    if ( (position & 3) == 0 ) generateBlock(key, component, position >> 2, block);
+    return block[position++ & 3];
+}
+
+uint64_t
+PhiloxRNG::generateNextUInt64()
+{
+    const uint64_t lowerHalf = generateNextUInt32();
+    const uint64_t upperHalf = generateNextUInt32();
+    return (upperHalf << 32) | lowerHalf;
+}
+
+int64_t
+PhiloxRNG::generateNextInt64()
+{
+    return (int64_t)generateNextUInt64();
+}
+
+int32_t
+PhiloxRNG::generateNextInt32()
+{
+    return (int32_t)generateNextUInt32();
+}
+
+PhiloxRNG::~PhiloxRNG() {}
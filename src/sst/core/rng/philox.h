@@ -0,0 +1,136 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_RNG_PHILOX_H
+#define SST_CORE_RNG_PHILOX_H
+
+#include "rng.h"
+
+#include <stdint.h>
+
+namespace SST {
+namespace RNG {
+/**
+    \class PhiloxRNG philox.h "sst/core/rng/philox.h"
+
+    Implements the Philox4x32-10 counter-based RNG from Salmon et al., "Parallel Random
+    Numbers: As Easy as 1, 2, 3" (SC11). Each block of four 32-bit outputs is a keyed
+    bijection of the block's index, so the generator has no state beyond its position
+    and can skip ahead to any position at no cost.
+
+    The stream of numbers is named by a global seed, a component ID and a stream ID.
+    Components that build their generators from their own ID draw the same numbers no
+    matter how the simulation is partitioned across ranks and threads, and a component
+    that needs several independent streams can give each one its own stream ID.
+*/
+class PhiloxRNG : public SST::RNG::Random
+{
+
+public:
+    /**
+        Create a new Philox RNG
+        @param[in] seed The global seed for this RNG
+        @param[in] componentId The ID of the component using this RNG
+        @param[in] streamId Selects one of the independent streams of the component
+    */
+    PhiloxRNG(uint32_t seed, uint64_t componentId = 0, uint32_t streamId = 0);
+
+    /**
+        Generates the next random number as a double value between 0 and 1.
+    */
+    double nextUniform() override;
+
+    /**
+        Generates the next random number as an unsigned 32-bit integer
+    */
+    uint32_t generateNextUInt32() override;
+
+    /**
+        Generates the next random number as an unsigned 64-bit integer
+    */
+    uint64_t generateNextUInt64() override;
+
+    /**
+        Generates the next random number as a signed 64-bit integer
+    */
+    int64_t generateNextInt64() override;
+
+    /**
+        Generates the next random number as a signed 32-bit integer
+    */
+    int32_t generateNextInt32() override;
+
+    /**
+        Fills out with the next count random numbers between 0 and 1. Whole blocks are
+        generated several at a time, which the compiler can vectorize.
+    */
+    void fillUniform(double* out, size_t count) override;
+
+    /**
+        Fills out with the next count random numbers as unsigned 32-bit integers
+    */
+    void fillUInt32(uint32_t* out, size_t count) override;
+
+    /**
+        Fills out with the next count random numbers as unsigned 64-bit integers
+    */
+    void fillUInt64(uint64_t* out, size_t count) override;
+
+    /**
+        Seed the Philox RNG and restart it from the beginning of the stream. The seed and
+        the stream ID are the two words of the key.
+    */
+    void seed(uint32_t newSeed, uint64_t componentId = 0, uint32_t streamId = 0);
+
+    /**
+        Skips over the next count 32-bit values in the stream. A 64-bit value counts as
+        two 32-bit values.
+    */
+    void skip(uint64_t count);
+
+    /**
+        Moves to the given position in the stream, counted in 32-bit values from the start
+    */
+    void setPosition(uint64_t position);
+
+    /**
+        Returns the number of 32-bit values drawn since the start of the stream
+    */
+    uint64_t getPosition() const { return position; }
+
+    /**
+        Computes block number index of the stream named by key and component, which
+        holds the 32-bit values at positions 4 * index to 4 * index + 3.
+    */
+    static void generateBlock(const uint32_t key[2], uint64_t component, uint64_t index, uint32_t out[4]);
+
+    /**
+        Computes count consecutive blocks, starting with block number index, into out,
+        which must hold 4 * count values.
+    */
+    static void generateBlocks(const uint32_t key[2], uint64_t component, uint64_t index, size_t count, uint32_t* out);
+
+    /**
+        Destructor for Philox
+    */
+    ~PhiloxRNG();
+
+protected:
+    uint32_t key[2];
+    uint64_t component;
+    uint64_t position;
+    uint32_t block[4];
+};
+
+} // namespace RNG
+} // namespace SST
+
+#endif // SST_CORE_RNG_PHILOX_H
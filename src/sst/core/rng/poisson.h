@@ -81,6 +81,41 @@ public:
         return k - 1;
     }
 
+    /**
+        Fills an array with values from the distribution, taking the uniform numbers from the
+        base generator in blocks. Each value uses at least one uniform number, so a block is
+        never larger than the number of values still to draw and the generator is left in the
+        same state as count calls to getNextDouble() would leave it. The values are the same
+        as those calls would return.
+        \param out The array to fill
+        \param count The number of doubles to sample
+    */
+    void fill(double* out, size_t count)
+    {
+        const double L = exp(-lambda);
+        double       uniforms[256];
+        size_t       used      = 0;
+        size_t       available = 0;
+        double       p         = 1.0;
+        int          k         = 0;
+
+        for ( size_t i = 0; i < count; ) {
+            if ( used == available ) {
+                available = count - i < 256 ? count - i : 256;
+                used      = 0;
+                baseDistrib->fillUniform(uniforms, available);
+            }
+
+            k++;
+            p *= uniforms[used++];
+            if ( p <= L ) {
+                out[i++] = k - 1;
+                p        = 1.0;
+                k        = 0;
+            }
+        }
+    }
+
     /**
         Gets the lambda with which the distribution was created
         \return The lambda which the user created the distribution with
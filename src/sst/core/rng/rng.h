@@ -12,6 +12,7 @@
 #ifndef SST_CORE_RNG_RNG_H
 #define SST_CORE_RNG_RNG_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace SST {
@@ -53,6 +54,40 @@ public:
     */
     virtual int32_t generateNextInt32() = 0;
 
+    /**
+        Fills out with the next count random numbers in the range [0,1). The values are the
+        same as count calls to nextUniform() would return. Generators override this to
+        produce many values without a virtual call for each one.
+    */
+    virtual void fillUniform(double* out, size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ ) {
+            out[i] = nextUniform();
+        }
+    }
+
+    /**
+        Fills out with the next count random numbers as unsigned 32-bit integers, the same
+        values as count calls to generateNextUInt32() would return.
+    */
+    virtual void fillUInt32(uint32_t* out, size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ ) {
+            out[i] = generateNextUInt32();
+        }
+    }
+
+    /**
+        Fills out with the next count random numbers as unsigned 64-bit integers, the same
+        values as count calls to generateNextUInt64() would return.
+    */
+    virtual void fillUInt64(uint64_t* out, size_t count)
+    {
+        for ( size_t i = 0; i < count; i++ ) {
+            out[i] = generateNextUInt64();
+        }
+    }
+
     /**
         Destroys the random number generator
     */
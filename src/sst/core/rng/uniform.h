@@ -91,6 +91,23 @@ public:
         return static_cast<double>(current_bin - 1);
     }
 
+    /**
+        Fills out with the next count doubles from the distribution, drawing the uniform
+        numbers from the base generator in one call. The values are the same as count calls
+        to getNextDouble() would return.
+    */
+    void fill(double* out, size_t count)
+    {
+        baseDistrib->fillUniform(out, count);
+        for ( size_t i = 0; i < count; i++ ) {
+            uint32_t current_bin = 1;
+            while ( out[i] > (static_cast<double>(current_bin) * probPerBin) ) {
+                current_bin++;
+            }
+            out[i] = static_cast<double>(current_bin - 1);
+        }
+    }
+
 protected:
     /**
         Sets the base random number generator for the distribution.
@@ -19,9 +19,25 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 
 using namespace SST;
 using namespace SST::RNG;
+
+/*
+    One step of the generator. The fill functions run it on local copies of the state,
+    which the compiler keeps in registers. Each number depends on the one before it, so
+    the steps themselves can not run in parallel.
+*/
+static inline uint32_t
+xorshiftStep(uint32_t& x, uint32_t& y, uint32_t& z, uint32_t& w)
+{
+    uint32_t t = x ^ (x << 11);
+    x          = y;
+    y          = z;
+    z          = w;
+    return w   = w ^ (w >> 19) ^ t ^ (t >> 8);
+}
 /*
     Generate a new random number generator with a random selection for the
     seed.
@@ -67,11 +83,7 @@ XORShiftRNG::nextUniform()
 uint32_t
 XORShiftRNG::generateNextUInt32()
 {
-    uint32_t t = x ^ (x << 11);
-    x          = y;
-    y          = z;
-    z          = w;
-    return w   = w ^ (w >> 19) ^ t ^ (t >> 8);
+    return xorshiftStep(x, y, z, w);
 }
 
 uint64_t
@@ -128,6 +140,59 @@ XORShiftRNG::generateNextInt32()
     return returnInt32;
 }
 
+void
+XORShiftRNG::fillUniform(double* out, size_t count)
+{
+    uint32_t sx = x, sy = y, sz = z, sw = w;
+
+    for ( size_t i = 0; i < count; i++ ) {
+        double temp_dbl;
+        do {
+            temp_dbl = static_cast<double>(xorshiftStep(sx, sy, sz, sw)) / static_cast<double>(XORSHIFT_UINT32_MAX);
+        } while ( UNLIKELY(temp_dbl >= 1.0) );
+        out[i] = temp_dbl;
+    }
+
+    x = sx;
+    y = sy;
+    z = sz;
+    w = sw;
+}
+
+void
+XORShiftRNG::fillUInt32(uint32_t* out, size_t count)
+{
+    uint32_t sx = x, sy = y, sz = z, sw = w;
+
+    for ( size_t i = 0; i < count; i++ ) {
+        out[i] = xorshiftStep(sx, sy, sz, sw);
+    }
+
+    x = sx;
+    y = sy;
+    z = sz;
+    w = sw;
+}
+
+void
+XORShiftRNG::fillUInt64(uint64_t* out, size_t count)
+{
+    uint32_t sx = x, sy = y, sz = z, sw = w;
+
+    // Lay out the halves the way generateNextInt64() does
+    for ( size_t i = 0; i < count; i++ ) {
+        uint32_t halves[2];
+        halves[0] = xorshiftStep(sx, sy, sz, sw);
+        halves[1] = xorshiftStep(sx, sy, sz, sw);
+        memcpy(&out[i], halves, sizeof(halves));
+    }
+
+    x = sx;
+    y = sy;
+    z = sz;
+    w = sw;
+}
+
 void
 XORShiftRNG::seed(uint64_t seed)
 {
@@ -74,6 +74,22 @@ public:
     */
     int32_t generateNextInt32() override;
 
+    /**
+        Fills out with the next count random numbers between 0 and 1, keeping the state in
+        registers rather than making a call for each number.
+    */
+    void fillUniform(double* out, size_t count) override;
+
+    /**
+        Fills out with the next count random numbers as unsigned 32-bit integers
+    */
+    void fillUInt32(uint32_t* out, size_t count) override;
+
+    /**
+        Fills out with the next count random numbers as unsigned 64-bit integers
+    */
+    void fillUInt64(uint64_t* out, size_t count) override;
+
     /**
         Seed the XOR RNG
     */
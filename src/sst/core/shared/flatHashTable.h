@@ -0,0 +1,203 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SHARED_FLATHASHTABLE_H
+#define SST_CORE_SHARED_FLATHASHTABLE_H
+
+#include "sst/core/serialization/serialize.h"
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace SST {
+namespace Shared {
+
+// NOTE: This class is not part of the public API and can change at
+// any time
+
+/**
+   Insert-only hash table used by the hash based SharedObjects.  The
+   entries are kept in a vector in insertion order, and a separate
+   open addressing index (linear probing, at most half full) maps
+   hashes to positions in that vector.  Lookups touch one index slot
+   and one entry in the common case, iteration walks a contiguous
+   array and serializing the table only sends the entries, since the
+   index is rebuilt on the other side.
+
+   entryT is either the key itself (for sets) or a std::pair of key
+   and value (for maps).  keyEqual decides whether two keys refer to
+   the same entry.
+
+   NOTE: Pointers and iterators into the table are invalidated by
+   inserts.
+ */
+template <typename keyT, typename entryT = keyT, typename hashT = std::hash<keyT>,
+          typename keyEqual = std::equal_to<keyT>>
+class FlatHashTable
+{
+    friend class SST::Core::Serialization::serialize<FlatHashTable<keyT, entryT, hashT, keyEqual>>;
+
+public:
+    typedef typename std::vector<entryT>::const_iterator const_iterator;
+
+    FlatHashTable() : shift(64) {}
+
+    size_t size() const { return entries.size(); }
+    bool   empty() const { return entries.empty(); }
+
+    const_iterator begin() const { return entries.cbegin(); }
+    const_iterator end() const { return entries.cend(); }
+
+    void clear()
+    {
+        entries.clear();
+        index.clear();
+        shift = 64;
+    }
+
+    /**
+       Makes room for count entries, so inserting them does not
+       rebuild the index
+     */
+    void reserve(size_t count)
+    {
+        entries.reserve(count);
+        if ( count * 2 > index.size() ) rebuildIndex(count);
+    }
+
+    /**
+       Looks up the entry with the given key
+
+       @return pointer to the entry, or nullptr if it is not in the
+       table
+     */
+    const entryT* lookup(const keyT& key) const
+    {
+        if ( index.empty() ) return nullptr;
+        size_t mask = index.size() - 1;
+        for ( size_t slot = bucket(key);; slot = (slot + 1) & mask ) {
+            uint32_t pos = index[slot];
+            if ( pos == 0 ) return nullptr;
+            if ( keyEqual()(keyOf(entries[pos - 1]), key) ) return &entries[pos - 1];
+        }
+    }
+
+    entryT* lookup(const keyT& key)
+    {
+        return const_cast<entryT*>(static_cast<const FlatHashTable*>(this)->lookup(key));
+    }
+
+    const_iterator find(const keyT& key) const
+    {
+        const entryT* entry = lookup(key);
+        return entry ? entries.cbegin() + (entry - entries.data()) : entries.cend();
+    }
+
+    size_t count(const keyT& key) const { return lookup(key) ? 1 : 0; }
+
+    /**
+       Inserts entry if there is no entry with the same key
+
+       @return pointer to the entry in the table with the key of
+       entry, and whether entry was inserted
+     */
+    std::pair<entryT*, bool> insert(const entryT& entry)
+    {
+        if ( (entries.size() + 1) * 2 > index.size() ) rebuildIndex(entries.size() + 1);
+
+        const keyT& key  = keyOf(entry);
+        size_t      mask = index.size() - 1;
+        size_t      slot = bucket(key);
+        for ( ; index[slot] != 0; slot = (slot + 1) & mask ) {
+            entryT& existing = entries[index[slot] - 1];
+            if ( keyEqual()(keyOf(existing), key) ) return std::make_pair(&existing, false);
+        }
+        entries.push_back(entry);
+        index[slot] = static_cast<uint32_t>(entries.size());
+        return std::make_pair(&entries.back(), true);
+    }
+
+private:
+    std::vector<entryT>   entries;
+    // Position in entries + 1 for each slot, 0 if the slot is empty
+    std::vector<uint32_t> index;
+    // Shift that takes the top bits of the mixed hash as the slot
+    int                   shift;
+
+    static const keyT& keyOf(const keyT& key) { return key; }
+
+    template <typename valT>
+    static const keyT& keyOf(const std::pair<keyT, valT>& entry)
+    {
+        return entry.first;
+    }
+
+    // Fibonacci hashing, so hash functions that return the key
+    // itself (as std::hash does for integers) still spread out
+    size_t bucket(const keyT& key) const
+    {
+        return static_cast<size_t>((static_cast<uint64_t>(hashT()(key)) * 0x9E3779B97F4A7C15ull) >> shift);
+    }
+
+    // Sizes the index for count entries and reinserts every entry
+    void rebuildIndex(size_t count)
+    {
+        size_t slots = 16;
+        int    bits  = 4;
+        while ( slots < count * 2 ) {
+            slots <<= 1;
+            bits++;
+        }
+        if ( slots <= index.size() ) slots = index.size();
+        else {
+            shift = 64 - bits;
+        }
+
+        index.assign(slots, 0);
+        size_t mask = slots - 1;
+        for ( size_t i = 0; i < entries.size(); ++i ) {
+            size_t slot = bucket(keyOf(entries[i]));
+            while ( index[slot] != 0 )
+                slot = (slot + 1) & mask;
+            index[slot] = static_cast<uint32_t>(i + 1);
+        }
+    }
+};
+
+} // namespace Shared
+
+namespace Core {
+namespace Serialization {
+
+template <typename keyT, typename entryT, typename hashT, typename keyEqual>
+class serialize<SST::Shared::FlatHashTable<keyT, entryT, hashT, keyEqual>>
+{
+public:
+    void
+    operator()(SST::Shared::FlatHashTable<keyT, entryT, hashT, keyEqual>& v, SST::Core::Serialization::serializer& ser)
+    {
+        // Only the entries are sent, the index is rebuilt
+        ser& v.entries;
+        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
+            v.index.clear();
+            v.shift = 64;
+            v.rebuildIndex(v.entries.size());
+        }
+    }
+};
+
+} // namespace Serialization
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_SHARED_FLATHASHTABLE_H
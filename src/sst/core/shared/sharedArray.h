@@ -15,6 +15,9 @@
 #include "sst/core/shared/sharedObject.h"
 #include "sst/core/sst_types.h"
 
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
 #include <vector>
 
 namespace SST {
@@ -23,6 +26,12 @@ namespace Shared {
 /**
    SharedArray class.  The class is templated to allow for an array
    of any non-pointer type.  The type must be serializable.
+
+   With --node-shared-arrays, arrays of trivially copyable types are
+   copied byte for byte into memory shared by the ranks on a node.
+   Such a type must not contain pointers (or anything else that is
+   only valid in one process), since the other ranks would read them
+   as is.
  */
 template <typename T>
 class SharedArray : public SharedObject
@@ -102,8 +111,8 @@ public:
 
     /*** Typedefs and functions to mimic parts of the vector API ***/
 
-    typedef typename std::vector<T>::const_iterator         const_iterator;
-    typedef typename std::vector<T>::const_reverse_iterator const_reverse_iterator;
+    typedef const T*                              const_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
     /**
        Get the length of the array.
@@ -117,27 +126,27 @@ public:
 
        @return true if array is empty (size = 0), false otherwise
      */
-    inline bool empty() const { return data->array.empty(); }
+    inline bool empty() const { return data->length == 0; }
 
     /**
        Get const_iterator to beginning of underlying map
      */
-    const_iterator begin() const { return data->array.cbegin(); }
+    const_iterator begin() const { return data->values; }
 
     /**
        Get const_iterator to end of underlying map
      */
-    const_iterator end() const { return data->array.cend(); }
+    const_iterator end() const { return data->values + data->length; }
 
     /**
        Get const_reverse_iterator to beginning of underlying map
      */
-    const_reverse_iterator rbegin() const { return data->array.crbegin(); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
 
     /**
        Get const_reverse_iterator to end of underlying map
      */
-    const_reverse_iterator rend() const { return data->array.crend(); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
 
     /**
        Indicate that the calling element has written all the data it
@@ -224,7 +233,17 @@ private:
         T                 init;
         verify_type       verify;
 
-        Data(const std::string& name) : SharedObjectData(name), change_set(nullptr), verify(VERIFY_UNINITIALIZED)
+        // Reads go through values, which points to either array or a
+        // copy in memory shared by the ranks on the node
+        const T* values;
+        size_t   length;
+
+        Data(const std::string& name) :
+            SharedObjectData(name),
+            change_set(nullptr),
+            verify(VERIFY_UNINITIALIZED),
+            values(nullptr),
+            length(0)
         {
             if ( Private::getNumRanks().rank > 1 ) { change_set = new ChangeSet(name); }
         }
@@ -247,6 +266,8 @@ private:
             if ( size > array.size() ) {
                 // Need to resize the vector
                 array.resize(size, init_data);
+                values = array.data();
+                length = array.size();
                 if ( v_type == FE_VERIFY ) { written.resize(size); }
                 if ( change_set ) change_set->setSize(size, init_data, v_type);
             }
@@ -272,7 +293,7 @@ private:
         size_t getSize()
         {
             std::lock_guard<std::mutex> lock(mtx);
-            return array.size();
+            return length;
         }
 
         void update_write(int index, const T& data)
@@ -314,20 +335,36 @@ private:
         // the array may be resized by another thread.  If there is a
         // danger of the array being resized during init, use the
         // mutex_read function until after the init phase.
-        inline const T& read(int index) const { return array[index]; }
+        inline const T& read(int index) const { return values[index]; }
 
         // Mutexed read for use if you are resizing the array as you go
         inline const T& mutex_read(int index) const
         {
             std::lock_guard<std::mutex> lock(mtx);
-            auto                        ret = array[index];
-            return ret;
+            return values[index];
         }
 
         // Functions inherited from SharedObjectData
         virtual SharedObjectChangeSet* getChangeSet() override { return change_set; }
         virtual void                   resetChangeSet() override { change_set->clear(); }
 
+        // Only arrays of types that can be copied byte for byte can
+        // be placed in shared memory.  Pointers would not be valid in
+        // the other ranks; pointers held inside T cannot be detected,
+        // so T must not contain any (see the class documentation).
+        const void* getNodeSharedData(size_t& size) override
+        {
+            size = std::is_trivially_copyable<T>::value && !std::is_pointer<T>::value ? length * sizeof(T) : 0;
+            return size ? values : nullptr;
+        }
+
+        void setNodeSharedData(const void* ptr) override
+        {
+            values = static_cast<const T*>(ptr);
+            std::vector<T>().swap(array);
+            std::vector<bool>().swap(written);
+        }
+
     private:
         class ChangeSet : public SharedObjectChangeSet
         {
@@ -336,30 +373,65 @@ private:
             size_t                         size;
             T                              init;
             verify_type                    verify;
+            bool                           resized;
+            bool                           compacted;
 
             void serialize_order(SST::Core::Serialization::serializer& ser) override
             {
+                // Only the last write to each index is sent
+                if ( ser.mode() != SST::Core::Serialization::serializer::UNPACK ) compact();
                 SharedObjectChangeSet::serialize_order(ser);
                 ser& changes;
                 ser& size;
                 ser& init;
                 ser& verify;
+                compacted = true;
+            }
+
+            // Sorts the changes by index and keeps only the last write to
+            // each index.  Writes are recorded in order, so the stable
+            // sort keeps them in order within an index.
+            void compact()
+            {
+                if ( compacted ) return;
+                std::stable_sort(
+                    changes.begin(), changes.end(),
+                    [](const std::pair<int, T>& a, const std::pair<int, T>& b) { return a.first < b.first; });
+                auto out = changes.begin();
+                for ( auto it = changes.begin(); it != changes.end(); ++it ) {
+                    if ( it + 1 != changes.end() && (it + 1)->first == it->first ) continue;
+                    if ( out != it ) *out = std::move(*it);
+                    ++out;
+                }
+                changes.erase(out, changes.end());
+                compacted = true;
             }
 
             ImplementSerializable(SST::Shared::SharedArray<T>::Data::ChangeSet);
 
         public:
             // For serialization
-            ChangeSet() : SharedObjectChangeSet() {}
-            ChangeSet(const std::string& name) : SharedObjectChangeSet(name), size(0), verify(VERIFY_UNINITIALIZED) {}
-
-            void addChange(int index, const T& value) { changes.emplace_back(index, value); }
+            ChangeSet() : SharedObjectChangeSet(), resized(false), compacted(true) {}
+            ChangeSet(const std::string& name) :
+                SharedObjectChangeSet(name),
+                size(0),
+                verify(VERIFY_UNINITIALIZED),
+                resized(false),
+                compacted(true)
+            {}
+
+            void addChange(int index, const T& value)
+            {
+                changes.emplace_back(index, value);
+                compacted = false;
+            }
 
             void setSize(size_t length, const T& init_data, verify_type v_type)
             {
-                size   = length;
-                init   = init_data;
-                verify = v_type;
+                size    = length;
+                init    = init_data;
+                verify  = v_type;
+                resized = true;
             }
             size_t getSize() { return size; }
 
@@ -372,7 +444,67 @@ private:
                 }
             }
 
-            void clear() override { changes.clear(); }
+            void merge(SharedObjectChangeSet* other) override
+            {
+                ChangeSet* cs = static_cast<ChangeSet*>(other);
+                if ( cs->verify != VERIFY_UNINITIALIZED ) {
+                    if ( verify == VERIFY_UNINITIALIZED ) {
+                        init   = cs->init;
+                        verify = cs->verify;
+                    }
+                    else if ( init != cs->init ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: Two different init_data values passed into SharedArray %s\n",
+                            getName().c_str());
+                    }
+                    else if ( verify != cs->verify ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: Two different verify types passed into SharedArray %s\n",
+                            getName().c_str());
+                    }
+                }
+                if ( cs->size > size ) size = cs->size;
+
+                // Both sets of changes are sorted by index, so they are
+                // merged in one pass
+                compact();
+                cs->compact();
+                std::vector<std::pair<int, T>> merged;
+                merged.reserve(changes.size() + cs->changes.size());
+                auto mine   = changes.begin();
+                auto theirs = cs->changes.begin();
+                while ( mine != changes.end() || theirs != cs->changes.end() ) {
+                    if ( theirs == cs->changes.end() || (mine != changes.end() && mine->first < theirs->first) ) {
+                        merged.push_back(std::move(*mine++));
+                    }
+                    else if ( mine == changes.end() || theirs->first < mine->first ) {
+                        merged.push_back(*theirs++);
+                    }
+                    else {
+                        // With INIT_VERIFY, a write of the init value does
+                        // not conflict and the other write is kept
+                        bool init_write = verify == INIT_VERIFY && (mine->second == init || theirs->second == init);
+                        if ( verify != NO_VERIFY && !init_write && mine->second != theirs->second ) {
+                            Private::getSimulationOutput().fatal(
+                                CALL_INFO, 1, "ERROR: wrote two different values to index %d of SharedArray %s\n",
+                                mine->first, getName().c_str());
+                        }
+                        if ( init_write && mine->second == init ) mine->second = theirs->second;
+                        merged.push_back(std::move(*mine++));
+                        ++theirs;
+                    }
+                }
+                changes.swap(merged);
+            }
+
+            bool isEmpty() override { return changes.empty() && !resized; }
+
+            void clear() override
+            {
+                changes.clear();
+                resized   = false;
+                compacted = true;
+            }
         };
     };
 };
@@ -691,30 +823,65 @@ private:
             size_t                            size;
             bool                              init;
             verify_type                       verify;
+            bool                              resized;
+            bool                              compacted;
 
             void serialize_order(SST::Core::Serialization::serializer& ser) override
             {
+                // Only the last write to each index is sent
+                if ( ser.mode() != SST::Core::Serialization::serializer::UNPACK ) compact();
                 SharedObjectChangeSet::serialize_order(ser);
                 ser& changes;
                 ser& size;
                 ser& init;
                 ser& verify;
+                compacted = true;
+            }
+
+            // Sorts the changes by index and keeps only the last write to
+            // each index.  Writes are recorded in order, so the stable
+            // sort keeps them in order within an index.
+            void compact()
+            {
+                if ( compacted ) return;
+                std::stable_sort(
+                    changes.begin(), changes.end(),
+                    [](const std::pair<int, bool>& a, const std::pair<int, bool>& b) { return a.first < b.first; });
+                auto out = changes.begin();
+                for ( auto it = changes.begin(); it != changes.end(); ++it ) {
+                    if ( it + 1 != changes.end() && (it + 1)->first == it->first ) continue;
+                    if ( out != it ) *out = std::move(*it);
+                    ++out;
+                }
+                changes.erase(out, changes.end());
+                compacted = true;
             }
 
             ImplementSerializable(SST::Shared::SharedArray<bool>::Data::ChangeSet);
 
         public:
             // For serialization
-            ChangeSet() : SharedObjectChangeSet() {}
-            ChangeSet(const std::string& name) : SharedObjectChangeSet(name), size(0), verify(VERIFY_UNINITIALIZED) {}
-
-            void addChange(int index, bool value) { changes.emplace_back(index, value); }
+            ChangeSet() : SharedObjectChangeSet(), resized(false), compacted(true) {}
+            ChangeSet(const std::string& name) :
+                SharedObjectChangeSet(name),
+                size(0),
+                verify(VERIFY_UNINITIALIZED),
+                resized(false),
+                compacted(true)
+            {}
+
+            void addChange(int index, bool value)
+            {
+                changes.emplace_back(index, value);
+                compacted = false;
+            }
 
             void setSize(size_t length, bool init_data, verify_type v_type)
             {
-                size   = length;
-                init   = init_data;
-                verify = v_type;
+                size    = length;
+                init    = init_data;
+                verify  = v_type;
+                resized = true;
             }
             size_t getSize() { return size; }
 
@@ -727,7 +894,67 @@ private:
                 }
             }
 
-            void clear() override { changes.clear(); }
+            void merge(SharedObjectChangeSet* other) override
+            {
+                ChangeSet* cs = static_cast<ChangeSet*>(other);
+                if ( cs->verify != VERIFY_UNINITIALIZED ) {
+                    if ( verify == VERIFY_UNINITIALIZED ) {
+                        init   = cs->init;
+                        verify = cs->verify;
+                    }
+                    else if ( init != cs->init ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: Two different init_data values passed into SharedArray %s\n",
+                            getName().c_str());
+                    }
+                    else if ( verify != cs->verify ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: Two different verify types passed into SharedArray %s\n",
+                            getName().c_str());
+                    }
+                }
+                if ( cs->size > size ) size = cs->size;
+
+                // Both sets of changes are sorted by index, so they are
+                // merged in one pass
+                compact();
+                cs->compact();
+                std::vector<std::pair<int, bool>> merged;
+                merged.reserve(changes.size() + cs->changes.size());
+                auto mine   = changes.begin();
+                auto theirs = cs->changes.begin();
+                while ( mine != changes.end() || theirs != cs->changes.end() ) {
+                    if ( theirs == cs->changes.end() || (mine != changes.end() && mine->first < theirs->first) ) {
+                        merged.push_back(std::move(*mine++));
+                    }
+                    else if ( mine == changes.end() || theirs->first < mine->first ) {
+                        merged.push_back(*theirs++);
+                    }
+                    else {
+                        // With INIT_VERIFY, a write of the init value does
+                        // not conflict and the other write is kept
+                        bool init_write = verify == INIT_VERIFY && (mine->second == init || theirs->second == init);
+                        if ( verify != NO_VERIFY && !init_write && mine->second != theirs->second ) {
+                            Private::getSimulationOutput().fatal(
+                                CALL_INFO, 1, "ERROR: wrote two different values to index %d of SharedArray %s\n",
+                                mine->first, getName().c_str());
+                        }
+                        if ( init_write && mine->second == init ) mine->second = theirs->second;
+                        merged.push_back(std::move(*mine++));
+                        ++theirs;
+                    }
+                }
+                changes.swap(merged);
+            }
+
+            bool isEmpty() override { return changes.empty() && !resized; }
+
+            void clear() override
+            {
+                changes.clear();
+                resized   = false;
+                compacted = true;
+            }
         };
     };
 };
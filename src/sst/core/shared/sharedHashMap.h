@@ -0,0 +1,383 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SHARED_SHAREDHASHMAP_H
+#define SST_CORE_SHARED_SHAREDHASHMAP_H
+
+#include "sst/core/shared/flatHashTable.h"
+#include "sst/core/shared/sharedObject.h"
+#include "sst/core/sst_types.h"
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace SST {
+namespace Shared {
+
+/**
+   SharedHashMap class.  This is a SharedMap backed by a flat hash
+   table instead of a std::map, for maps that are only used to look
+   up keys.  Lookups are O(1) and the data is sent between ranks as
+   a flat list of entries.  Iteration visits the entries in an
+   unspecified order, so there are no reverse iterators or
+   lower_bound()/upper_bound().
+
+   The key type must be usable with hashT and operator==, and both
+   types must be serializable.  The value type can not be a pointer.
+ */
+template <typename keyT, typename valT, typename hashT = std::hash<keyT>>
+class SharedHashMap : public SharedObject
+{
+    static_assert(!std::is_pointer<valT>::value, "Cannot use a pointer type as value with SharedHashMap");
+
+    // Forward declaration.  Defined below
+    class Data;
+
+    typedef FlatHashTable<keyT, std::pair<keyT, valT>, hashT> table_t;
+
+public:
+    SharedHashMap() : SharedObject(), published(false), data(nullptr) {}
+
+    ~SharedHashMap()
+    {
+        // data does not need to be deleted since the
+        // SharedObjectManager owns the pointer
+    }
+
+    /**
+       Initialize the SharedHashMap.
+
+       @param obj_name Name of the object.  This name is how the
+       object is uniquely identified across ranks.
+
+       @param verify_mode Specifies how multiply written data should
+       be verified.  Since the underlying table knows if the data has
+       already been written, FE_VERIFY and INIT_VERIFY simply use this
+       built-in mechanism to know when an item has previously been
+       written.  When these modes are enabled, multiply written data
+       must match what was written before.  When NO_VERIFY is passed,
+       no verification will occur.  VERIFY_UNINITIALIZED is a reserved
+       value and should not be passed.
+
+       @param expected_size Number of entries the map is expected to
+       hold.  Space for them is reserved up front.
+
+       @return returns the number of instances that have intialized
+       themselve before this instance on this MPI rank.
+     */
+    int initialize(const std::string& obj_name, verify_type v_type = FE_VERIFY, size_t expected_size = 0)
+    {
+        if ( data ) {
+            Private::getSimulationOutput().fatal(
+                CALL_INFO, 1, "ERROR: called initialize() of SharedHashMap %s more than once\n", obj_name.c_str());
+        }
+
+        data    = manager.getSharedObjectData<Data>(obj_name);
+        int ret = incShareCount(data);
+        data->setVerify(v_type);
+        if ( expected_size != 0 ) data->reserve(expected_size);
+        return ret;
+    }
+
+    /*** Typedefs and functions to mimic parts of the unordered_map API ***/
+    typedef typename table_t::const_iterator const_iterator;
+
+    /**
+       Get the size of the map.
+
+       @return size of the map
+     */
+    inline size_t size() const { return data->getSize(); }
+
+    /**
+       Tests if the map is empty.
+
+       @return true if map is empty, false otherwise
+     */
+    inline bool empty() const { return data->map.empty(); }
+
+    /**
+       Counts elements with a specific key.  Becuase this is not a
+       multimap, it will either return 1 or 0.
+
+       @return Count of elements with specified key
+     */
+    size_t count(const keyT& k) const { return data->map.count(k); }
+
+    /**
+       Searches the container for an element with a key equivalent to
+       k and returns an iterator to it if found, otherwise it returns
+       an iterator to SharedHashMap::end().
+
+       @param key key to search for
+     */
+    const_iterator find(const keyT& key) const { return data->map.find(key); }
+
+    /**
+       Get const_iterator to beginning of underlying table
+     */
+    const_iterator begin() const { return data->map.begin(); }
+
+    /**
+       Get const_iterator to end of underlying table
+     */
+    const_iterator end() const { return data->map.end(); }
+
+    /**
+       Indicate that the calling element has written all the data it
+       plans to write.  Writing to the map through this instance
+       after publish() is called will create an error.
+     */
+    void publish()
+    {
+        if ( published ) return;
+        published = true;
+        incPublishCount(data);
+    }
+
+    /**
+       Check whether all instances of this SharedHashMap have called
+       publish().  NOTE: Is is possible that this could return true
+       one round, but false the next if a new instance of the
+       SharedHashMap was initialized but not published after the last
+       call.
+     */
+    bool isFullyPublished() { return data->isFullyPublished(); }
+
+    /**
+       Write data to the map.  This function is thread-safe, as a
+       mutex is used to ensure only one write at a time.
+
+       @param key key of the write
+
+       @param value value to be written
+     */
+    inline void write(const keyT& key, const valT& value)
+    {
+        if ( published ) {
+            Private::getSimulationOutput().fatal(
+                CALL_INFO, 1, "ERROR: write to SharedHashMap %s after publish() was called\n",
+                data->getName().c_str());
+        }
+        return data->write(key, value);
+    }
+
+    /**
+       Read data from the map.  This returns a const reference, so is
+       read only.  If the key is not in the map, an out_of_range
+       exception will be thrown.
+
+       NOTE: This function does not use a mutex, so it is possible to
+       get invalid results if another thread is simulateously writing
+       to the map.  However, after the init() phase of simulation is
+       complete (in setup() and beyond), this is always a safe
+       operation.  If reading during init() and you can't guarantee
+       that all elements have already written all elements to the
+       SharedHashMap, use mutex_read() to guarantee thread safety.
+
+       @param key key to read
+
+       @return const reference to data referenced by key
+
+       @exception std::out_of_range key is not found in map
+     */
+    inline const valT& operator[](const keyT& key) const { return data->read(key); }
+
+    /**
+       Read data from the map.  This returns a const reference, so
+       is read only.  This version of read is always thread safe (@see
+       operator[]).  If the key is not in the map, an out_of_range
+       exception will be thrown.
+
+       @param key key to read
+
+       @return const reference to data at index
+
+       @exception std::out_of_range key is not found in map
+    */
+    inline const valT& mutex_read(const keyT& key) const { return data->mutex_read(key); }
+
+private:
+    bool  published;
+    Data* data;
+
+    class Data : public SharedObjectData
+    {
+
+        // Forward declaration.  Defined below
+        class ChangeSet;
+
+    public:
+        table_t     map;
+        ChangeSet*  change_set;
+        verify_type verify;
+
+        Data(const std::string& name) : SharedObjectData(name), change_set(nullptr), verify(VERIFY_UNINITIALIZED)
+        {
+            if ( Private::getNumRanks().rank > 1 ) { change_set = new ChangeSet(name); }
+        }
+
+        ~Data() { delete change_set; }
+
+        void setVerify(verify_type v_type)
+        {
+            if ( v_type != verify && verify != VERIFY_UNINITIALIZED ) {
+                Private::getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: Two different verify_types specified for SharedHashMap %s\n", name.c_str());
+            }
+            verify = v_type;
+            if ( change_set ) change_set->setVerify(v_type);
+        }
+
+        void reserve(size_t count)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            map.reserve(count);
+        }
+
+        size_t getSize() const { return map.size(); }
+
+        void update_write(const keyT& key, const valT& value)
+        {
+            // Don't need to mutex because this is only ever called
+            // from one thread at a time, with barrier before and
+            // after, or from write(), which does mutex.
+            auto success = map.insert(std::make_pair(key, value));
+            if ( !success.second ) {
+                // Wrote to a key that already existed
+                if ( verify != NO_VERIFY && value != success.first->second ) {
+                    Private::getSimulationOutput().fatal(
+                        CALL_INFO, 1, "ERROR: wrote two different values to same key in SharedHashMap %s\n",
+                        name.c_str());
+                }
+            }
+        }
+
+        void write(const keyT& key, const valT& value)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            check_lock_for_write("SharedHashMap");
+            update_write(key, value);
+            if ( change_set ) change_set->addChange(key, value);
+        }
+
+        // Inline the read since it may be called often during run().
+        // This read is not protected from data races in the case
+        // where the map may be simulataeously written by another
+        // thread.  If there is a danger of simultaneous access
+        // during init, use the mutex_read function until after the
+        // init phase.
+        inline const valT& read(const keyT& key)
+        {
+            auto entry = map.lookup(key);
+            if ( entry == nullptr ) throw std::out_of_range("SharedHashMap::read");
+            return entry->second;
+        }
+
+        // Mutexed read for use if you are resizing the array as you go
+        inline const valT& mutex_read(const keyT& key)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return read(key);
+        }
+
+        // Functions inherited from SharedObjectData
+        virtual SharedObjectChangeSet* getChangeSet() override { return change_set; }
+        virtual void                   resetChangeSet() override { change_set->clear(); }
+
+    private:
+        class ChangeSet : public SharedObjectChangeSet
+        {
+
+            table_t     changes;
+            verify_type verify;
+            bool        verify_changed;
+
+            void serialize_order(SST::Core::Serialization::serializer& ser) override
+            {
+                SharedObjectChangeSet::serialize_order(ser);
+                ser& changes;
+                ser& verify;
+            }
+
+            ImplementSerializable(SST::Shared::SharedHashMap<keyT, valT, hashT>::Data::ChangeSet);
+
+        public:
+            // For serialization
+            ChangeSet() : SharedObjectChangeSet(), verify(VERIFY_UNINITIALIZED), verify_changed(false) {}
+            ChangeSet(const std::string& name) :
+                SharedObjectChangeSet(name),
+                verify(VERIFY_UNINITIALIZED),
+                verify_changed(false)
+            {}
+
+            // Only the last write to each key needs to be sent
+            void addChange(const keyT& key, const valT& value)
+            {
+                auto success = changes.insert(std::make_pair(key, value));
+                if ( !success.second ) success.first->second = value;
+            }
+
+            void setVerify(verify_type v_type)
+            {
+                if ( v_type != verify ) verify_changed = true;
+                verify = v_type;
+            }
+
+            void applyChanges(SharedObjectDataManager* manager) override
+            {
+                auto data = manager->getSharedObjectData<Data>(getName());
+                data->setVerify(verify);
+                data->map.reserve(data->map.size() + changes.size());
+                for ( auto& x : changes ) {
+                    data->update_write(x.first, x.second);
+                }
+            }
+
+            void merge(SharedObjectChangeSet* other) override
+            {
+                ChangeSet* cs = static_cast<ChangeSet*>(other);
+                if ( cs->verify != VERIFY_UNINITIALIZED ) {
+                    if ( verify != VERIFY_UNINITIALIZED && verify != cs->verify ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: Two different verify_types specified for SharedHashMap %s\n",
+                            getName().c_str());
+                    }
+                    verify = cs->verify;
+                }
+
+                changes.reserve(changes.size() + cs->changes.size());
+                for ( auto& x : cs->changes ) {
+                    auto success = changes.insert(x);
+                    if ( !success.second && verify != NO_VERIFY && x.second != success.first->second ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: wrote two different values to same key in SharedHashMap %s\n",
+                            getName().c_str());
+                    }
+                }
+            }
+
+            bool isEmpty() override { return changes.empty() && !verify_changed; }
+
+            void clear() override
+            {
+                changes.clear();
+                verify_changed = false;
+            }
+        };
+    };
+};
+
+} // namespace Shared
+} // namespace SST
+
+#endif // SST_CORE_SHARED_SHAREDHASHMAP_H
@@ -0,0 +1,363 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SHARED_SHAREDHASHSET_H
+#define SST_CORE_SHARED_SHAREDHASHSET_H
+
+#include "sst/core/shared/flatHashTable.h"
+#include "sst/core/shared/sharedObject.h"
+#include "sst/core/sst_types.h"
+
+#include <functional>
+
+namespace SST {
+namespace Shared {
+
+/**
+   SharedHashSet class.  This is a SharedSet backed by a flat hash
+   table instead of a std::set, for sets that are only used to look
+   up items.  Lookups are O(1) and the data is sent between ranks as
+   a flat list of items.  Iteration visits the items in an
+   unspecified order, so there are no reverse iterators.
+
+   Two items are the same set item when keyEqual says they are, which
+   by default is operator==.  hashT must hash equal items to the same
+   value.  As with SharedSet, the verify modes check that items that
+   are the same set item are also equal according to operator==.
+   The type must be serializable and can not be a pointer.
+ */
+template <typename valT, typename hashT = std::hash<valT>, typename keyEqual = std::equal_to<valT>>
+class SharedHashSet : public SharedObject
+{
+    static_assert(!std::is_pointer<valT>::value, "Cannot use a pointer type as value with SharedHashSet");
+
+    // Forward declaration.  Defined below
+    class Data;
+
+    typedef FlatHashTable<valT, valT, hashT, keyEqual> table_t;
+
+public:
+    SharedHashSet() : SharedObject(), published(false), data(nullptr) {}
+
+    ~SharedHashSet()
+    {
+        // data does not need to be deleted since the
+        // SharedObjectManager owns the pointer
+    }
+
+    /**
+       Initialize the SharedHashSet.
+
+       @param obj_name Name of the object.  This name is how the
+       object is uniquely identified across ranks.
+
+       @param verify_mode Specifies how multiply written data should
+       be verified.  Since the underlying table knows if the data has
+       already been written, FE_VERIFY and INIT_VERIFY simply use this
+       built-in mechanism to know when an item has previously been
+       written.  When these modes are enabled, multiply written data
+       must match what was written before.  When NO_VERIFY is passed,
+       no verification will occur.  VERIFY_UNINITIALIZED is a reserved
+       value and should not be passed.
+
+       @param expected_size Number of items the set is expected to
+       hold.  Space for them is reserved up front.
+
+       @return returns the number of instances that have intialized
+       themselve before this instance on this MPI rank.
+     */
+    int initialize(const std::string& obj_name, verify_type v_type, size_t expected_size = 0)
+    {
+        if ( data ) {
+            Private::getSimulationOutput().fatal(
+                CALL_INFO, 1, "ERROR: called initialize() of SharedHashSet %s more than once\n", obj_name.c_str());
+        }
+
+        data    = manager.getSharedObjectData<Data>(obj_name);
+        int ret = incShareCount(data);
+        data->setVerify(v_type);
+        if ( expected_size != 0 ) data->reserve(expected_size);
+        return ret;
+    }
+
+    /*** Typedefs and functions to mimic parts of the unordered_set API ***/
+    typedef typename table_t::const_iterator const_iterator;
+
+    /**
+       Get the size of the set.
+
+       @return size of the set
+     */
+    inline size_t size() const { return data->getSize(); }
+
+    /**
+       Tests if the set is empty.
+
+       @return true if set is empty, false otherwise
+     */
+    inline bool empty() const { return data->set.empty(); }
+
+    /**
+       Counts elements with a specific value.  Becuase this is not a
+       multiset, it will either return 1 or 0.
+
+       @return Count of elements with specified value
+     */
+    size_t count(const valT& k) const { return data->set.count(k); }
+
+    /**
+       Get const_iterator to beginning of underlying table
+     */
+    const_iterator begin() const { return data->set.begin(); }
+
+    /**
+       Get const_iterator to end of underlying table
+     */
+    const_iterator end() const { return data->set.end(); }
+
+    /**
+       Indicate that the calling element has written all the data it
+       plans to write.  Writing to the set through this instance
+       after publish() is called will create an error.
+     */
+    void publish()
+    {
+        if ( published ) return;
+        published = true;
+        incPublishCount(data);
+    }
+
+    /**
+       Check whether all instances of this SharedHashSet have called
+       publish().  NOTE: Is is possible that this could return true
+       one round, but false the next if a new instance of the
+       SharedHashSet was initialized but not published after the last
+       call.
+     */
+    bool isFullyPublished() { return data->isFullyPublished(); }
+
+    /**
+       Insert data to the set.  This function is thread-safe, as a
+       mutex is used to ensure only one insert at a time.
+
+       @param val value of the insert
+     */
+    inline void insert(const valT& value)
+    {
+        if ( published ) {
+            Private::getSimulationOutput().fatal(
+                CALL_INFO, 1, "ERROR: insert into SharedHashSet %s after publish() was called\n",
+                data->getName().c_str());
+        }
+        return data->write(value);
+    }
+
+    /**
+       Searches the SharedHashSet for an element equivalent to value
+       and returns a const iterator to it if found, otherwise it
+       returns an iterator to SharedHashSet::end.
+
+       @param value value to search for
+
+       NOTE: This function does not use a mutex, so it is possible to
+       get invalid results if another thread is simulateously writing
+       to the set.  However, after the init() phase of simulation is
+       complete (in setup() and beyond), this is always a safe
+       operation.  If reading during init() and you can't guarantee
+       that all elements have already written all elements to the
+       SharedHashSet, use mutex_find() to guarantee thread safety.
+
+       @return read-only iterator to data referenced by value
+     */
+    inline const_iterator find(const valT& value) const { return data->find(value); }
+
+    /**
+       Searches the SharedHashSet for an element equivalent to value
+       and returns a const iterator to it if found, otherwise it
+       returns an iterator to SharedHashSet::end. This version of find
+       is always thread safe (@see find()).
+
+       @param value value to search for
+
+       @return read-only iterator to data reference by value
+    */
+    inline const_iterator mutex_find(const valT& value) const { return data->mutex_find(value); }
+
+private:
+    bool  published;
+    Data* data;
+
+    class Data : public SharedObjectData
+    {
+
+        // Forward declaration.  Defined below
+        class ChangeSet;
+
+    public:
+        table_t    set;
+        ChangeSet* change_set;
+
+        verify_type verify;
+
+        Data(const std::string& name) : SharedObjectData(name), change_set(nullptr), verify(VERIFY_UNINITIALIZED)
+        {
+            if ( Private::getNumRanks().rank > 1 ) { change_set = new ChangeSet(name); }
+        }
+
+        ~Data() { delete change_set; }
+
+        void setVerify(verify_type v_type)
+        {
+            if ( v_type != verify && verify != VERIFY_UNINITIALIZED ) {
+                Private::getSimulationOutput().fatal(
+                    CALL_INFO, 1, "ERROR: Two different verify_types specified for SharedHashSet %s\n", name.c_str());
+            }
+            verify = v_type;
+            if ( change_set ) change_set->setVerify(v_type);
+        }
+
+        void reserve(size_t count)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            set.reserve(count);
+        }
+
+        size_t getSize() const
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return set.size();
+        }
+
+        void update_write(const valT& value)
+        {
+            // Don't need to mutex because this is only ever called
+            // from one thread at a time, with barrier before and
+            // after, or from write(), which does mutex.
+            auto success = set.insert(value);
+            if ( !success.second ) {
+                // Wrote to a value that already existed
+                if ( verify != NO_VERIFY && !(value == *(success.first)) ) {
+                    Private::getSimulationOutput().fatal(
+                        CALL_INFO, 1, "ERROR: wrote two non-equal values to same set item in SharedHashSet %s\n",
+                        name.c_str());
+                }
+            }
+        }
+
+        void write(const valT& value)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            check_lock_for_write("SharedHashSet");
+            update_write(value);
+            if ( change_set ) change_set->addChange(value);
+        }
+
+        // Inline the read since it may be called often during run().
+        // This read is not protected from data races in the case
+        // where the set may be simulataeously written by another
+        // thread.  If there is a danger of simultaneous access
+        // during init, use the mutex_find function until after the
+        // init phase.
+        inline const_iterator find(const valT& value) { return set.find(value); }
+
+        // Mutexed find for use if others may be writing as you go
+        inline const_iterator mutex_find(const valT& value)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return set.find(value);
+        }
+
+        // Functions inherited from SharedObjectData
+        virtual SharedObjectChangeSet* getChangeSet() override { return change_set; }
+        virtual void                   resetChangeSet() override { change_set->clear(); }
+
+    private:
+        class ChangeSet : public SharedObjectChangeSet
+        {
+
+            table_t     changes;
+            verify_type verify;
+            bool        verify_changed;
+
+            void serialize_order(SST::Core::Serialization::serializer& ser) override
+            {
+                SharedObjectChangeSet::serialize_order(ser);
+                ser& changes;
+                ser& verify;
+            }
+
+            ImplementSerializable(SST::Shared::SharedHashSet<valT, hashT, keyEqual>::Data::ChangeSet);
+
+        public:
+            // For serialization
+            ChangeSet() : SharedObjectChangeSet(), verify(VERIFY_UNINITIALIZED), verify_changed(false) {}
+            ChangeSet(const std::string& name) :
+                SharedObjectChangeSet(name),
+                verify(VERIFY_UNINITIALIZED),
+                verify_changed(false)
+            {}
+
+            void addChange(const valT& value) { changes.insert(value); }
+
+            void setVerify(verify_type v_type)
+            {
+                if ( v_type != verify ) verify_changed = true;
+                verify = v_type;
+            }
+
+            void applyChanges(SharedObjectDataManager* manager) override
+            {
+                auto data = manager->getSharedObjectData<Data>(getName());
+                data->setVerify(verify);
+                data->set.reserve(data->set.size() + changes.size());
+                for ( auto& x : changes ) {
+                    data->update_write(x);
+                }
+            }
+
+            void merge(SharedObjectChangeSet* other) override
+            {
+                ChangeSet* cs = static_cast<ChangeSet*>(other);
+                if ( cs->verify != VERIFY_UNINITIALIZED ) {
+                    if ( verify != VERIFY_UNINITIALIZED && verify != cs->verify ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: Two different verify_types specified for SharedHashSet %s\n",
+                            getName().c_str());
+                    }
+                    verify = cs->verify;
+                }
+
+                changes.reserve(changes.size() + cs->changes.size());
+                for ( auto& x : cs->changes ) {
+                    auto success = changes.insert(x);
+                    if ( !success.second && verify != NO_VERIFY && !(x == *(success.first)) ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: wrote two non-equal values to same set item in SharedHashSet %s\n",
+                            getName().c_str());
+                    }
+                }
+            }
+
+            bool isEmpty() override { return changes.empty() && !verify_changed; }
+
+            void clear() override
+            {
+                changes.clear();
+                verify_changed = false;
+            }
+        };
+    };
+};
+
+} // namespace Shared
+} // namespace SST
+
+#endif // SST_CORE_SHARED_SHAREDHASHSET_H
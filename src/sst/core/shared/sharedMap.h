@@ -303,6 +303,7 @@ private:
 
             std::map<keyT, valT> changes;
             verify_type          verify;
+            bool                 verify_changed;
 
             void serialize_order(SST::Core::Serialization::serializer& ser) override
             {
@@ -315,12 +316,20 @@ private:
 
         public:
             // For serialization
-            ChangeSet() : SharedObjectChangeSet(), verify(VERIFY_UNINITIALIZED) {}
-            ChangeSet(const std::string& name) : SharedObjectChangeSet(name), verify(VERIFY_UNINITIALIZED) {}
+            ChangeSet() : SharedObjectChangeSet(), verify(VERIFY_UNINITIALIZED), verify_changed(false) {}
+            ChangeSet(const std::string& name) :
+                SharedObjectChangeSet(name),
+                verify(VERIFY_UNINITIALIZED),
+                verify_changed(false)
+            {}
 
             void addChange(const keyT& key, const valT& value) { changes[key] = value; }
 
-            void setVerify(verify_type v_type) { verify = v_type; }
+            void setVerify(verify_type v_type)
+            {
+                if ( v_type != verify ) verify_changed = true;
+                verify = v_type;
+            }
 
             void applyChanges(SharedObjectDataManager* manager) override
             {
@@ -331,7 +340,35 @@ private:
                 }
             }
 
-            void clear() override { changes.clear(); }
+            void merge(SharedObjectChangeSet* other) override
+            {
+                ChangeSet* cs = static_cast<ChangeSet*>(other);
+                if ( cs->verify != VERIFY_UNINITIALIZED ) {
+                    if ( verify != VERIFY_UNINITIALIZED && verify != cs->verify ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: Two different verify_types specified for SharedMap %s\n",
+                            getName().c_str());
+                    }
+                    verify = cs->verify;
+                }
+
+                for ( auto& x : cs->changes ) {
+                    auto success = changes.insert(x);
+                    if ( !success.second && verify != NO_VERIFY && x.second != success.first->second ) {
+                        Private::getSimulationOutput().fatal(
+                            CALL_INFO, 1, "ERROR: wrote two different values to same key in SharedMap %s\n",
+                            getName().c_str());
+                    }
+                }
+            }
+
+            bool isEmpty() override { return changes.empty() && !verify_changed; }
+
+            void clear() override
+            {
+                changes.clear();
+                verify_changed = false;
+            }
         };
     };
 };
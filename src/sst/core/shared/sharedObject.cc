@@ -13,6 +13,7 @@
 
 #include "sst/core/shared/sharedObject.h"
 
+#include "sst/core/cputimer.h"
 #include "sst/core/objectComms.h"
 #include "sst/core/output.h"
 #include "sst/core/rankInfo.h"
@@ -22,6 +23,16 @@
 #include "sst/core/simulation_impl.h"
 #include "sst/core/warnmacros.h"
 
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <set>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
 namespace SST {
 namespace Shared {
 
@@ -40,65 +51,176 @@ getNumRanks()
 
 } // namespace Private
 
+#ifdef SST_CONFIG_HAVE_MPI
+namespace {
+
+// Changesets merged from a group of ranks, by name of the shared data
+typedef std::map<std::string, SharedObjectChangeSet*> ChangeSetMap;
+
+// This rank's own changesets, which belong to the shared data and are
+// merged into in place rather than deleted
+typedef std::set<SharedObjectChangeSet*> ChangeSetSet;
+
+// Whether all instances on a group of ranks have published, by name
+// of the shared data
+typedef std::map<std::string, bool> PublishMap;
+
+void
+sendState(int dest, ChangeSetMap& changes, PublishMap& published)
+{
+    std::vector<SharedObjectChangeSet*> out;
+    out.reserve(changes.size());
+    for ( auto& x : changes ) {
+        out.push_back(x.second);
+    }
+    Comms::send(dest, 0, out);
+    Comms::send(dest, 0, published);
+}
+
+// Receives the state of another group of ranks and merges it into
+// changes and published.  The changes of the lower group win where
+// unverified values conflict, so both groups end up with the same
+// merged state.
+void
+recvState(int src, bool src_is_lower, ChangeSetMap& changes, PublishMap& published, const ChangeSetSet& own)
+{
+    std::vector<SharedObjectChangeSet*> in;
+    PublishMap                          in_published;
+    Comms::recv(src, 0, in);
+    Comms::recv(src, 0, in_published);
+
+    for ( auto cs : in ) {
+        auto it = changes.find(cs->getName());
+        if ( it == changes.end() ) { changes[cs->getName()] = cs; }
+        else if ( src_is_lower ) {
+            cs->merge(it->second);
+            if ( own.count(it->second) == 0 ) delete it->second;
+            it->second = cs;
+        }
+        else {
+            it->second->merge(cs);
+            delete cs;
+        }
+    }
+
+    for ( auto& x : in_published ) {
+        auto it = published.find(x.first);
+        if ( it == published.end() ) { published.insert(x); }
+        else {
+            it->second = it->second && x.second;
+        }
+    }
+}
+
+} // namespace
+#endif
+
 SharedObjectDataManager SharedObject::manager;
 std::mutex              SharedObjectDataManager::mtx;
 
 std::mutex SharedObjectDataManager::update_mtx;
 
+SharedObjectDataManager::~SharedObjectDataManager()
+{
+    for ( auto x : shared_data ) {
+        delete x.second;
+    }
+    for ( auto& x : node_regions ) {
+        munmap(x.first, x.second);
+    }
+}
+
 void
 SharedObjectDataManager::updateState(bool finalize)
 {
     std::lock_guard<std::mutex> lock(update_mtx);
 
 #ifdef SST_CONFIG_HAVE_MPI
-    // Exchange data between ranks
+    // Exchange data between ranks.  Rather than every rank sending
+    // its changes to every other rank, the changes are merged pairwise
+    // by recursive doubling, so each step only carries one merged
+    // copy of each changed object.  Objects with no changes since the
+    // last exchange are not sent at all.
     if ( Simulation_impl::getSimulation()->getNumRanks().rank > 1 ) {
-        int                                 myRank = Simulation_impl::getSimulation()->getRank().rank;
-        // Create a vector off all my changesets
-        std::vector<SharedObjectChangeSet*> myChanges;
+        double start_time = sst_get_cpu_time();
+        int    myRank     = Simulation_impl::getSimulation()->getRank().rank;
+        int    numRanks   = Simulation_impl::getSimulation()->getNumRanks().rank;
 
-        // Create a vector to check to see if regions are fully
-        // published
-        std::vector<std::pair<std::string, bool>> myFullPub;
+        // Changes from other ranks are merged directly into my own
+        // changesets, which are cleared once the exchange is done.
+        // Received changesets are deleted as they are merged.
+        ChangeSetMap changes;
+        ChangeSetSet own;
+        PublishMap   published;
         for ( auto x : shared_data ) {
-            myChanges.push_back(x.second->getChangeSet());
-            myFullPub.emplace_back(x.second->getName(), x.second->getPublishCount() == x.second->getShareCount());
+            SharedObjectChangeSet* cs = x.second->getChangeSet();
+            if ( !cs->isEmpty() ) {
+                changes[x.first] = cs;
+                own.insert(cs);
+            }
+            published[x.first] = x.second->getPublishCount() == x.second->getShareCount();
         }
+        size_t sent = changes.size();
 
-        std::vector<std::vector<SharedObjectChangeSet*>>       allChanges;
-        std::vector<std::vector<std::pair<std::string, bool>>> allFullyPub;
+        // The ranks above the largest power of two fold their state
+        // into the ranks below it, sit out the exchange, and then get
+        // the final state back
+        int pow2 = 1;
+        while ( pow2 * 2 <= numRanks )
+            pow2 *= 2;
 
-        // Get and apply all the changes
-        Comms::all_gather(myChanges, allChanges);
-        for ( size_t i = 0; i < allChanges.size(); ++i ) {
-            if ( i == (size_t)myRank ) continue;
+        if ( myRank >= pow2 ) { sendState(myRank - pow2, changes, published); }
+        else if ( myRank + pow2 < numRanks ) {
+            recvState(myRank + pow2, false, changes, published, own);
+        }
 
-            for ( size_t j = 0; j < allChanges[i].size(); ++j ) {
-                auto cs = allChanges[i][j];
-                cs->applyChanges(this);
-                delete cs;
+        if ( myRank < pow2 ) {
+            for ( int mask = 1; mask < pow2; mask <<= 1 ) {
+                int partner = myRank ^ mask;
+                if ( myRank < partner ) {
+                    sendState(partner, changes, published);
+                    recvState(partner, false, changes, published, own);
+                }
+                else {
+                    recvState(partner, true, changes, published, own);
+                    sendState(partner, changes, published);
+                }
             }
         }
+
+        if ( myRank >= pow2 ) {
+            for ( auto& x : changes ) {
+                if ( own.count(x.second) == 0 ) delete x.second;
+            }
+            changes.clear();
+            published.clear();
+            recvState(myRank - pow2, true, changes, published, own);
+        }
+        else if ( myRank + pow2 < numRanks ) {
+            sendState(myRank + pow2, changes, published);
+        }
+
+        // Apply all the changes.  This includes my own, which were
+        // already written locally and so don't change anything.
+        for ( auto& x : changes ) {
+            x.second->applyChanges(this);
+            if ( own.count(x.second) == 0 ) delete x.second;
+        }
         for ( auto x : shared_data ) {
             x.second->getChangeSet()->clear();
         }
 
-        // See if the SharedObjects are ready
-        Comms::all_gather(myFullPub, allFullyPub);
-        std::map<std::string, bool> pub_map;
-        for ( auto x : allFullyPub ) {
-            for ( auto y : x ) {
-                auto it = pub_map.find(y.first);
-                if ( it == pub_map.end() ) { pub_map[y.first] = y.second; }
-                else {
-                    it->second = it->second & y.second;
-                }
-            }
+        // See if the SharedObjects are ready.  Objects that only
+        // exist on other ranks are not created here.
+        for ( auto& x : published ) {
+            auto it = shared_data.find(x.first);
+            if ( it != shared_data.end() ) it->second->fully_published = x.second;
         }
 
-        for ( auto x : pub_map ) {
-            shared_data[x.first]->fully_published = x.second;
-        }
+        Private::getSimulationOutput().verbose(
+            CALL_INFO, 2, 0, "SharedObject exchange %d: sent %zu of %zu changesets, merged %zu, took %f seconds\n",
+            exchange_count, sent, shared_data.size(), changes.size(), sst_get_cpu_time() - start_time);
+        exchange_count++;
     }
     else {
 #endif
@@ -120,7 +242,126 @@ SharedObjectDataManager::updateState(bool finalize)
             x.second->fully_published = true;
         }
         locked = true;
+
+        if ( node_shared ) shareOnNode();
+    }
+}
+
+void
+SharedObjectDataManager::shareOnNode()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( Simulation_impl::getSimulation()->getNumRanks().rank == 1 ) return;
+
+    MPI_Comm node_comm;
+    int      node_rank = 0;
+    int      node_size = 0;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+    MPI_Comm_rank(node_comm, &node_rank);
+    MPI_Comm_size(node_comm, &node_size);
+    if ( node_size == 1 ) {
+        MPI_Comm_free(&node_comm);
+        return;
+    }
+
+    // After the final exchange every rank holds the same data, so the
+    // lowest rank on the node copies each array into a region and the
+    // other ranks map it.  Pairs are (object name, region name).
+    Output&                                          out = Private::getSimulationOutput();
+    std::vector<std::pair<std::string, std::string>> regions;
+    if ( node_rank == 0 ) {
+        for ( auto x : shared_data ) {
+            size_t      size = 0;
+            const void* src  = x.second->getNodeSharedData(size);
+            if ( src == nullptr ) continue;
+
+            std::string region = "/sst_shared_" + std::to_string(getpid()) + "-" + std::to_string(regions.size());
+            int         fd     = shm_open(region.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+            if ( fd < 0 ) {
+                out.output(
+                    "WARNING: could not create shared memory for SharedArray %s, each rank will keep its own copy: "
+                    "%s\n",
+                    x.first.c_str(), strerror(errno));
+                continue;
+            }
+
+            // Reserve the memory now so running out shows up as an
+            // error instead of a SIGBUS during the copy
+            void* ptr = MAP_FAILED;
+            int   err = posix_fallocate(fd, 0, size);
+            if ( err == 0 ) { ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0); }
+            if ( err == 0 && ptr == MAP_FAILED ) err = errno;
+            close(fd);
+            if ( err != 0 ) {
+                shm_unlink(region.c_str());
+                out.output(
+                    "WARNING: could not create shared memory for SharedArray %s, each rank will keep its own copy: "
+                    "%s\n",
+                    x.first.c_str(), strerror(err));
+                continue;
+            }
+
+            memcpy(ptr, src, size);
+            mprotect(ptr, size, PROT_READ);
+            x.second->setNodeSharedData(ptr);
+            node_regions.emplace_back(ptr, size);
+            regions.emplace_back(x.first, region);
+        }
+    }
+
+    std::vector<char> buffer;
+    int64_t           buffer_size = 0;
+    if ( node_rank == 0 ) {
+        buffer      = Comms::serialize(regions);
+        buffer_size = buffer.size();
     }
+    MPI_Bcast(&buffer_size, 1, MPI_INT64_T, 0, node_comm);
+    buffer.resize(buffer_size);
+    MPI_Bcast(buffer.data(), buffer_size, MPI_BYTE, 0, node_comm);
+
+    if ( node_rank != 0 ) {
+        Comms::deserialize(buffer.data(), buffer_size, regions);
+        for ( auto& x : regions ) {
+            auto it = shared_data.find(x.first);
+            if ( it == shared_data.end() ) continue;
+
+            size_t size = 0;
+            if ( it->second->getNodeSharedData(size) == nullptr ) continue;
+
+            int fd = shm_open(x.second.c_str(), O_RDONLY, 0);
+            if ( fd < 0 ) continue;
+
+            struct stat region_stat;
+            void*       ptr = MAP_FAILED;
+            if ( fstat(fd, &region_stat) == 0 && (size_t)region_stat.st_size == size ) {
+                ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            }
+            close(fd);
+            if ( ptr == MAP_FAILED ) continue;
+
+            it->second->setNodeSharedData(ptr);
+            node_regions.emplace_back(ptr, size);
+        }
+    }
+
+    // The names are only needed until every rank has mapped the
+    // regions
+    MPI_Barrier(node_comm);
+    if ( node_rank == 0 ) {
+        for ( auto& x : regions ) {
+            shm_unlink(x.second.c_str());
+        }
+    }
+    MPI_Comm_free(&node_comm);
+
+    size_t bytes = 0;
+    for ( auto& x : node_regions ) {
+        bytes += x.second;
+    }
+    out.verbose(
+        CALL_INFO, 1, 0, "Sharing %zu SharedArrays (%zu bytes) between the %d ranks on this node\n",
+        node_regions.size(), bytes, node_size);
+#endif
 }
 
 } // namespace Shared
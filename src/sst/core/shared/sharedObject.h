@@ -19,6 +19,8 @@
 
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace SST {
 
@@ -63,6 +65,26 @@ public:
      */
     virtual void clear() = 0;
 
+    /**
+       Merges the changes from another rank into this changeset so
+       they can be forwarded as one set.  Where both changesets hold
+       a value for the same item, the value in this changeset is
+       kept, unless verification is on and the values differ, which
+       is a fatal error.
+
+       @param other Changeset for the same shared data.  Its changes
+       may be reordered or compacted, but are otherwise not modified.
+     */
+    virtual void merge(SharedObjectChangeSet* other) = 0;
+
+    /**
+       Checks whether there is anything that needs to be sent to the
+       other ranks since the last call to clear()
+
+       @return true if there are no changes to send
+     */
+    virtual bool isEmpty() = 0;
+
     /**
        Get the name of the shared data the changeset should be applied
        to
@@ -179,6 +201,33 @@ protected:
      */
     virtual void resetChangeSet() = 0;
 
+    /* For sharing data between the ranks on a node */
+
+    /**
+       Gets the data that can be placed in memory shared by the ranks
+       on a node once the object is locked.  This is called by the
+       core after the init phase when --node-shared-arrays is used.
+
+       @param size set to the number of bytes of data
+
+       @return pointer to the data, or nullptr if the object can't be
+       shared this way
+     */
+    virtual const void* getNodeSharedData(size_t& size)
+    {
+        size = 0;
+        return nullptr;
+    }
+
+    /**
+       Switches the object to read its data from memory shared by the
+       ranks on the node.  The object should free its own copy.
+
+       @param ptr read-only copy of the data returned by
+       getNodeSharedData().  It is owned by the core.
+     */
+    virtual void setNodeSharedData(const void* UNUSED(ptr)) {}
+
     /**
        Called by the core when writing to shared regions is no longer
        allowed
@@ -215,15 +264,21 @@ class SharedObjectDataManager
 
     bool locked;
 
+    // Number of times the state has been exchanged between ranks,
+    // used when reporting the time spent in each exchange
+    int exchange_count;
+
+    // Whether to place locked objects in memory shared by the ranks
+    // on each node, and the regions mapped to do so
+    bool                                  node_shared;
+    std::vector<std::pair<void*, size_t>> node_regions;
+
+    void shareOnNode();
+
 public:
-    SharedObjectDataManager() : locked(false) {}
+    SharedObjectDataManager() : locked(false), exchange_count(0), node_shared(false) {}
 
-    ~SharedObjectDataManager()
-    {
-        for ( auto x : shared_data ) {
-            delete x.second;
-        }
-    }
+    ~SharedObjectDataManager();
 
     template <typename T>
     T* getSharedObjectData(const std::string name)
@@ -255,6 +310,8 @@ public:
     }
 
     void updateState(bool finalize);
+
+    void setNodeSharedArrays(bool enable) { node_shared = enable; }
 };
 
 class SharedObject
@@ -18,6 +18,7 @@
 #include "sst/core/sst_types.h"
 
 #include <algorithm>
+#include <type_traits>
 #include <vector>
 
 namespace SST {
@@ -107,6 +108,13 @@ private:
         int middle;
 
         if ( data.size() == 0 ) return -1;
+
+        // IDs are usually dense and start at zero, in which case the
+        // data for an ID is found at the index of the same value
+        if constexpr ( std::is_integral<keyT>::value ) {
+            if ( static_cast<size_t>(id) < data.size() && data[id].key() == id ) return static_cast<int>(id);
+        }
+
         while ( bottom <= top ) {
             middle = bottom + (top - bottom) / 2;
             if ( id == data[middle].key() )
@@ -144,7 +152,7 @@ public:
     {
         data.swap(new_data);
         if ( !sorted ) {
-            std::sort(data.begin(), data.end, [](const classT& lhs, const classT& rhs) -> bool {
+            std::sort(data.begin(), data.end(), [](const classT& lhs, const classT& rhs) -> bool {
                 return lhs.key() < rhs.key();
             });
         }
@@ -364,6 +372,13 @@ private:
         int middle;
 
         if ( data.size() == 0 ) return -1;
+
+        // IDs are usually dense and start at zero, in which case the
+        // data for an ID is found at the index of the same value
+        if constexpr ( std::is_integral<keyT>::value ) {
+            if ( static_cast<size_t>(id) < data.size() && data[id]->key() == id ) return static_cast<int>(id);
+        }
+
         while ( bottom <= top ) {
             middle = bottom + (top - bottom) / 2;
             if ( id == data[middle]->key() )
@@ -401,7 +416,7 @@ public:
     {
         data.swap(new_data);
         if ( !sorted ) {
-            std::sort(data.begin(), data.end, [](const classT* lhs, const classT* rhs) -> bool {
+            std::sort(data.begin(), data.end(), [](const classT* lhs, const classT* rhs) -> bool {
                 return lhs->key() < rhs->key();
             });
         }
@@ -641,6 +656,13 @@ private:
         int middle;
 
         if ( data.size() == 0 ) return -1;
+
+        // IDs are usually dense and start at zero, in which case the
+        // data for an ID is found at the index of the same value
+        if constexpr ( std::is_integral<keyT>::value ) {
+            if ( static_cast<size_t>(id) < data.size() && data[id] == id ) return static_cast<int>(id);
+        }
+
         while ( bottom <= top ) {
             middle = bottom + (top - bottom) / 2;
             if ( id == data[middle] )
@@ -678,7 +700,7 @@ public:
     {
         data.swap(new_data);
         if ( !sorted ) {
-            std::sort(data.begin(), data.end, [](const keyT& lhs, const keyT& rhs) -> bool { return lhs < rhs; });
+            std::sort(data.begin(), data.end(), [](const keyT& lhs, const keyT& rhs) -> bool { return lhs < rhs; });
         }
     }
 
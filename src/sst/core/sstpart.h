@@ -22,6 +22,7 @@ namespace SST {
 
 class ConfigGraph;
 class PartitionGraph;
+class Params;
 
 namespace Partition {
 
@@ -59,6 +60,32 @@ public:
      */
     virtual void performPartition(ConfigGraph* graph);
 
+    /** Function to be overridden by subclasses that use measured
+     * costs from a profiled run.
+     *
+     * Called before performPartition() when --partitioner-cost-file
+     * was given.
+     */
+    virtual void setCostFile(const std::string& UNUSED(file)) {}
+
+    /** Function to be overridden by subclasses that support tuning
+     * parameters
+     *
+     * Called before performPartition() when --partitioner-params
+     * was given.
+     */
+    virtual void setParams(Params& UNUSED(params)) {}
+
+    /** Function to be overridden by subclasses that combine other
+     * partitioners, one for each level of the machine.
+     *
+     * Called before setCostFile() and performPartition() when
+     * --thread-partitioner was given.
+     */
+    virtual void
+    setLevelPartitioners(const std::string& UNUSED(rank_partitioner), const std::string& UNUSED(thread_partitioner))
+    {}
+
     virtual bool requiresConfigGraph() { return false; }
 
     virtual bool spawnOnAllRanks() { return false; }
@@ -0,0 +1,104 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statbinaryreader.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using SST::Statistics::StatisticBinaryReader;
+namespace BinaryStatFormat = SST::Statistics::BinaryStatFormat;
+
+static void
+print_usage(FILE* output, int exit_code)
+{
+    fprintf(output, "sst-stat-dump <FILE>\n");
+    fprintf(output, "\n");
+    fprintf(output, "Prints the statistics in a file written by sst.statOutputBinary\n");
+    fprintf(output, "as CSV, in the same columns as sst.statOutputCSV.  Fields that\n");
+    fprintf(output, "a statistic did not write are printed as 0.\n");
+    fprintf(output, "\n");
+    fprintf(output, "Return: 0 if the file was read, 1 if it is missing or corrupt\n");
+    exit(exit_code);
+}
+
+static void
+print_value(const StatisticBinaryReader& reader, size_t chunk, size_t col, uint64_t row)
+{
+    const void* data = reader.getRawColumnData(chunk, col);
+    switch ( reader.getColumn(col).type ) {
+    case BinaryStatFormat::INT32:
+        printf("%" PRId32, static_cast<const int32_t*>(data)[row]);
+        break;
+    case BinaryStatFormat::UINT32:
+        printf("%" PRIu32, static_cast<const uint32_t*>(data)[row]);
+        break;
+    case BinaryStatFormat::INT64:
+        printf("%" PRId64, static_cast<const int64_t*>(data)[row]);
+        break;
+    case BinaryStatFormat::UINT64:
+        printf("%" PRIu64, static_cast<const uint64_t*>(data)[row]);
+        break;
+    default:
+        printf("%f", reader.getValueAsDouble(chunk, col, row));
+        break;
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    if ( argc != 2 ) { print_usage(stderr, 1); }
+    if ( strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-help") == 0 ) { print_usage(stdout, 0); }
+
+    StatisticBinaryReader reader;
+    if ( !reader.open(argv[1]) ) {
+        fprintf(stderr, "sst-stat-dump: %s: %s\n", argv[1], reader.getError().c_str());
+        return 1;
+    }
+
+    printf("ComponentName, StatisticName, StatisticSubId, StatisticType, SimTime");
+    for ( size_t col = BinaryStatFormat::numFixedColumns; col < reader.getNumColumns(); col++ ) {
+        printf(", %s", reader.getColumn(col).name.c_str());
+    }
+    printf("\n");
+
+    for ( size_t chunk = 0; chunk < reader.getNumChunks(); chunk++ ) {
+        const uint64_t* simTime = reader.getColumnData<uint64_t>(chunk, BinaryStatFormat::simTimeColumn);
+        const uint32_t* statId  = reader.getColumnData<uint32_t>(chunk, BinaryStatFormat::statIdColumn);
+        if ( simTime == nullptr || statId == nullptr ) {
+            fprintf(stderr, "sst-stat-dump: %s: Bad SimTime or StatId column\n", argv[1]);
+            return 1;
+        }
+
+        for ( uint64_t row = 0; row < reader.getChunkRows(chunk); row++ ) {
+            if ( statId[row] >= reader.getNumStatistics() ) {
+                fprintf(stderr, "sst-stat-dump: %s: Bad statistic id %" PRIu32 "\n", argv[1], statId[row]);
+                return 1;
+            }
+
+            const StatisticBinaryReader::StatInfo& stat = reader.getStatistic(statId[row]);
+            printf(
+                "%s, %s, %s, %s, %" PRIu64, stat.compName.c_str(), stat.statName.c_str(), stat.statSubId.c_str(),
+                stat.statType.c_str(), simTime[row]);
+            for ( size_t col = BinaryStatFormat::numFixedColumns; col < reader.getNumColumns(); col++ ) {
+                printf(", ");
+                print_value(reader, chunk, col, row);
+            }
+            printf("\n");
+        }
+    }
+    return 0;
+}
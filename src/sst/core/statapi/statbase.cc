@@ -18,9 +18,12 @@
 #include "sst/core/statapi/stataccumulator.h"
 #include "sst/core/statapi/stathistogram.h"
 #include "sst/core/statapi/statnull.h"
+#include "sst/core/statapi/statoutputbinary.h"
 #include "sst/core/statapi/statoutputcsv.h"
 #include "sst/core/statapi/statoutputjson.h"
+#include "sst/core/statapi/statoutputreduce.h"
 #include "sst/core/statapi/statoutputtxt.h"
+#include "sst/core/statapi/statquantile.h"
 #include "sst/core/statapi/statuniquecount.h"
 
 namespace SST {
@@ -217,6 +220,13 @@ SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(QuantileStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(QuantileStatistic, double);
+
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int64_t);
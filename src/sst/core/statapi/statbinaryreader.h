@@ -0,0 +1,406 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATBINARYREADER_H
+#define SST_CORE_STATAPI_STATBINARYREADER_H
+
+// NOTE: This header is intentionally self-contained (no SST core
+// dependencies) so that analysis tools can include it and read files
+// produced by StatisticOutputBinary without linking against SST.
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+   Constants describing the on-disk layout of the binary columnar
+   statistic format.  All multi-byte values are written in the native
+   byte order of the writer; byteOrderMark allows a reader to detect a
+   mismatch.
+
+   File layout:
+     - File header (fileMagic, version, byteOrderMark, rank, numColumns,
+       chunkRows), followed by one schema entry per column
+       (uint8 type, uint8 reserved, uint16 name length, name bytes),
+       padded to an 8-byte boundary.
+     - Zero or more chunks.  Each chunk is an 8-byte chunk header
+       (chunkMagic, row count) followed by one contiguous array per
+       column holding row count fixed-width values.  Each column array
+       is padded to an 8-byte boundary so it can be used in place.
+     - Footer: the statistic table (uint32 count, then for each entry
+       the component, statistic, subid and type names as uint16 length
+       + bytes) and the chunk index (uint64 count, then uint64 offset
+       and uint64 row count per chunk).
+     - Trailer: uint64 footer offset followed by endMagic.
+
+   Column 0 is always "SimTime" (uint64) and column 1 is always "StatId"
+   (uint32, index into the statistic table).  The remaining columns are
+   the fields registered by the statistics, in handle order.  Fields not
+   written by a statistic for a given row are zero.
+*/
+namespace BinaryStatFormat {
+
+const uint64_t fileMagic     = 0x5441545342545353ull; // "SSTBSTAT"
+const uint64_t endMagic      = 0x444e455342545353ull; // "SSTBSEND"
+const uint32_t chunkMagic    = 0x4b4e4843u;           // "CHNK"
+const uint32_t byteOrderMark = 0x01020304u;
+const uint32_t version       = 1;
+
+const uint32_t simTimeColumn   = 0;
+const uint32_t statIdColumn    = 1;
+const uint32_t numFixedColumns = 2;
+
+enum ColumnType : uint8_t { INT32 = 0, UINT32 = 1, INT64 = 2, UINT64 = 3, FLOAT = 4, DOUBLE = 5 };
+
+inline size_t
+columnWidth(uint8_t type)
+{
+    switch ( type ) {
+    case INT32:
+    case UINT32:
+    case FLOAT:
+        return 4;
+    case INT64:
+    case UINT64:
+    case DOUBLE:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+inline size_t
+padTo8(size_t size)
+{
+    return (size + 7) & ~size_t(7);
+}
+
+} // namespace BinaryStatFormat
+
+/**
+    \class StatisticBinaryReader
+
+    Read-only, memory-mapped view of a file written by
+    StatisticOutputBinary.  Column data is accessed in place, one chunk at
+    a time, without copying:
+
+    \code
+    StatisticBinaryReader reader;
+    if ( !reader.open("StatisticOutput.bin") ) { fprintf(stderr, "%s\n", reader.getError().c_str()); }
+    int col = reader.findColumn("Sum.u64");
+    for ( size_t c = 0; c < reader.getNumChunks(); c++ ) {
+        const uint64_t* sum = reader.getColumnData<uint64_t>(c, col);
+        for ( uint64_t r = 0; r < reader.getChunkRows(c); r++ ) ...
+    }
+    \endcode
+*/
+class StatisticBinaryReader
+{
+public:
+    /** Schema entry for a single column */
+    struct Column
+    {
+        std::string name;
+        uint8_t     type;
+    };
+
+    /** Identity of a statistic referenced by the StatId column */
+    struct StatInfo
+    {
+        std::string compName;
+        std::string statName;
+        std::string statSubId;
+        std::string statType;
+    };
+
+    StatisticBinaryReader() : m_base(nullptr), m_size(0), m_rank(0), m_chunkRows(0) {}
+
+    ~StatisticBinaryReader() { close(); }
+
+    StatisticBinaryReader(const StatisticBinaryReader&) = delete;
+    StatisticBinaryReader& operator=(const StatisticBinaryReader&) = delete;
+
+    /** Map a file and parse its schema, statistic table and chunk index.
+     * @param path - Path to the file
+     * @return True on success; on failure getError() describes the problem
+     */
+    bool open(const std::string& path)
+    {
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if ( fd < 0 ) { return fail("Unable to open '" + path + "': " + std::string(strerror(errno))); }
+
+        struct stat st;
+        if ( fstat(fd, &st) != 0 ) {
+            ::close(fd);
+            return fail("Unable to stat '" + path + "': " + std::string(strerror(errno)));
+        }
+        m_size = st.st_size;
+
+        void* ptr = nullptr;
+        if ( m_size > 0 ) ptr = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if ( ptr == nullptr || ptr == MAP_FAILED ) {
+            m_size = 0;
+            return fail("Unable to map '" + path + "'");
+        }
+        m_base = static_cast<const uint8_t*>(ptr);
+
+        if ( !parse() ) {
+            std::string error = m_error;
+            close();
+            m_error = error;
+            return false;
+        }
+        return true;
+    }
+
+    /** Unmap the file.  Any pointers obtained from the reader become invalid. */
+    void close()
+    {
+        if ( m_base ) munmap(const_cast<uint8_t*>(m_base), m_size);
+        m_base = nullptr;
+        m_size = 0;
+        m_columns.clear();
+        m_stats.clear();
+        m_chunkOffsets.clear();
+        m_chunkRowCounts.clear();
+        m_error.clear();
+    }
+
+    /** Return a description of the last error */
+    const std::string& getError() const { return m_error; }
+
+    /** Return the rank that wrote this file */
+    uint32_t getRank() const { return m_rank; }
+
+    /** Return the number of columns (including SimTime and StatId) */
+    size_t getNumColumns() const { return m_columns.size(); }
+
+    /** Return the schema entry for a column */
+    const Column& getColumn(size_t col) const { return m_columns[col]; }
+
+    /** Find a column by name
+     * @param name - Column name, in the form "fieldName.typeShortName" (e.g. "Sum.u64")
+     * @return Column index or -1 if not found
+     */
+    int findColumn(const std::string& name) const
+    {
+        for ( size_t i = 0; i < m_columns.size(); i++ ) {
+            if ( m_columns[i].name == name ) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    /** Return the number of statistics referenced by the StatId column */
+    size_t getNumStatistics() const { return m_stats.size(); }
+
+    /** Return the identity of a statistic.  statId must be less than
+     * getNumStatistics(); StatId values read from the file should be
+     * checked before they are passed here.
+     */
+    const StatInfo& getStatistic(uint32_t statId) const { return m_stats[statId]; }
+
+    /** Return the number of chunks in the file */
+    size_t getNumChunks() const { return m_chunkOffsets.size(); }
+
+    /** Return the number of rows in a chunk */
+    uint64_t getChunkRows(size_t chunk) const { return m_chunkRowCounts[chunk]; }
+
+    /** Return the total number of rows in the file */
+    uint64_t getNumRows() const
+    {
+        uint64_t total = 0;
+        for ( auto rows : m_chunkRowCounts )
+            total += rows;
+        return total;
+    }
+
+    /** Return a pointer to the raw data for a column within a chunk */
+    const void* getRawColumnData(size_t chunk, size_t col) const
+    {
+        size_t offset = m_chunkOffsets[chunk] + 8;
+        for ( size_t i = 0; i < col; i++ ) {
+            offset +=
+                BinaryStatFormat::padTo8(m_chunkRowCounts[chunk] * BinaryStatFormat::columnWidth(m_columns[i].type));
+        }
+        return m_base + offset;
+    }
+
+    /** Return a typed pointer to the data for a column within a chunk.
+     * T must match the width of the column type.
+     */
+    template <typename T>
+    const T* getColumnData(size_t chunk, size_t col) const
+    {
+        if ( sizeof(T) != BinaryStatFormat::columnWidth(m_columns[col].type) ) return nullptr;
+        return static_cast<const T*>(getRawColumnData(chunk, col));
+    }
+
+    /** Return the value of a single cell converted to double */
+    double getValueAsDouble(size_t chunk, size_t col, uint64_t row) const
+    {
+        const void* data = getRawColumnData(chunk, col);
+        switch ( m_columns[col].type ) {
+        case BinaryStatFormat::INT32:
+            return static_cast<const int32_t*>(data)[row];
+        case BinaryStatFormat::UINT32:
+            return static_cast<const uint32_t*>(data)[row];
+        case BinaryStatFormat::INT64:
+            return static_cast<const int64_t*>(data)[row];
+        case BinaryStatFormat::UINT64:
+            return static_cast<const uint64_t*>(data)[row];
+        case BinaryStatFormat::FLOAT:
+            return static_cast<const float*>(data)[row];
+        case BinaryStatFormat::DOUBLE:
+            return static_cast<const double*>(data)[row];
+        default:
+            return 0.0;
+        }
+    }
+
+private:
+    bool fail(const std::string& msg)
+    {
+        m_error = msg;
+        return false;
+    }
+
+    template <typename T>
+    bool read(size_t& offset, T& value) const
+    {
+        if ( offset + sizeof(T) > m_size ) return false;
+        memcpy(&value, m_base + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    bool readString(size_t& offset, std::string& str) const
+    {
+        uint16_t len;
+        if ( !read(offset, len) || offset + len > m_size ) return false;
+        str.assign(reinterpret_cast<const char*>(m_base + offset), len);
+        offset += len;
+        return true;
+    }
+
+    bool parse()
+    {
+        size_t   offset = 0;
+        uint64_t magic;
+        uint32_t version, bom, numColumns, reserved;
+        if ( !read(offset, magic) || magic != BinaryStatFormat::fileMagic ) return fail("Not a binary statistic file");
+        if ( !read(offset, version) || version != BinaryStatFormat::version ) return fail("Unsupported format version");
+        if ( !read(offset, bom) || bom != BinaryStatFormat::byteOrderMark ) return fail("File byte order mismatch");
+        if ( !read(offset, m_rank) || !read(offset, numColumns) || !read(offset, m_chunkRows) ||
+             !read(offset, reserved) ) {
+            return fail("Truncated file header");
+        }
+
+        // Every count read from the file is checked against the bytes
+        // left before it is used to size anything.  Each schema entry
+        // takes at least 4 bytes
+        if ( numColumns < BinaryStatFormat::numFixedColumns || numColumns > (m_size - offset) / 4 ) {
+            return fail("Bad column count");
+        }
+        m_columns.resize(numColumns);
+        for ( auto& col : m_columns ) {
+            uint8_t pad;
+            if ( !read(offset, col.type) || !read(offset, pad) || !readString(offset, col.name) ) {
+                return fail("Truncated column schema");
+            }
+            if ( BinaryStatFormat::columnWidth(col.type) == 0 ) return fail("Unknown column type in " + col.name);
+        }
+        const size_t dataStart = BinaryStatFormat::padTo8(offset);
+
+        // Locate the footer through the trailer
+        if ( m_size < dataStart + 16 ) return fail("Missing file trailer (file not closed?)");
+        size_t   trailer = m_size - 16;
+        uint64_t footer;
+        if ( !read(trailer, footer) || !read(trailer, magic) || magic != BinaryStatFormat::endMagic ) {
+            return fail("Missing file trailer (file not closed?)");
+        }
+        if ( footer < dataStart || footer > m_size - 16 ) return fail("Bad footer offset");
+
+        offset = footer;
+        uint32_t numStats;
+        if ( !read(offset, numStats) ) return fail("Truncated statistic table");
+        // Each entry is four strings of at least 2 bytes
+        if ( numStats > (m_size - offset) / 8 ) return fail("Bad statistic count");
+        m_stats.resize(numStats);
+        for ( auto& stat : m_stats ) {
+            if ( !readString(offset, stat.compName) || !readString(offset, stat.statName) ||
+                 !readString(offset, stat.statSubId) || !readString(offset, stat.statType) ) {
+                return fail("Truncated statistic table");
+            }
+        }
+
+        uint64_t numChunks;
+        if ( !read(offset, numChunks) ) return fail("Truncated chunk index");
+        if ( numChunks > (m_size - offset) / 16 ) return fail("Bad chunk count");
+        m_chunkOffsets.resize(numChunks);
+        m_chunkRowCounts.resize(numChunks);
+        for ( uint64_t i = 0; i < numChunks; i++ ) {
+            if ( !read(offset, m_chunkOffsets[i]) || !read(offset, m_chunkRowCounts[i]) ) {
+                return fail("Truncated chunk index");
+            }
+            if ( !checkChunk(m_chunkOffsets[i], m_chunkRowCounts[i], dataStart, footer) ) {
+                return fail("Bad chunk " + std::to_string(i));
+            }
+        }
+        return true;
+    }
+
+    // Checks that a chunk starts with a chunk header for the same
+    // number of rows and that all of its columns end before the footer
+    bool checkChunk(uint64_t start, uint64_t rows, size_t dataStart, size_t footer) const
+    {
+        if ( start < dataStart || start > footer || footer - start < 8 ) return false;
+
+        size_t   offset = start;
+        uint32_t magic, chunkRows;
+        if ( !read(offset, magic) || !read(offset, chunkRows) ) return false;
+        if ( magic != BinaryStatFormat::chunkMagic || chunkRows != rows ) return false;
+
+        for ( auto& col : m_columns ) {
+            const size_t width = BinaryStatFormat::columnWidth(col.type);
+            if ( rows > (footer - offset) / width ) return false;
+            offset += BinaryStatFormat::padTo8(rows * width);
+            if ( offset > footer ) return false;
+        }
+        return true;
+    }
+
+    const uint8_t*        m_base;
+    size_t                m_size;
+    uint32_t              m_rank;
+    uint32_t              m_chunkRows;
+    std::vector<Column>   m_columns;
+    std::vector<StatInfo> m_stats;
+    std::vector<uint64_t> m_chunkOffsets;
+    std::vector<uint64_t> m_chunkRowCounts;
+    std::string           m_error;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATBINARYREADER_H
@@ -61,6 +61,23 @@ StatisticProcessingEngine::stat_outputs_simulation_end()
     }
 }
 
+void
+StatisticProcessingEngine::stat_outputs_synchronize(SimTime_t syncTime)
+{
+    for ( auto& so : m_statOutputs ) {
+        so->synchronize(syncTime);
+    }
+}
+
+bool
+StatisticProcessingEngine::stat_outputs_need_synchronize(SimTime_t syncTime)
+{
+    for ( auto& so : m_statOutputs ) {
+        if ( so->needsSynchronize(syncTime) ) return true;
+    }
+    return false;
+}
+
 
 void
 StatisticProcessingEngine::setup(Simulation_impl* sim, ConfigGraph* graph)
@@ -94,6 +94,16 @@ public:
      */
     static void stat_outputs_simulation_end();
 
+    /** Called to notify StatOutputs that the simulation has reached a
+       synchronization point
+     */
+    static void stat_outputs_synchronize(SimTime_t syncTime);
+
+    /** Called to check whether any StatOutput on this rank has work to
+       do at a synchronization point
+     */
+    static bool stat_outputs_need_synchronize(SimTime_t syncTime);
+
 private:
     friend class SST::Simulation_impl;
     friend int ::main(int argc, char** argv);
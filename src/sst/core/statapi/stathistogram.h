@@ -17,6 +17,11 @@
 #include "sst/core/statapi/statoutput.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <map>
+#include <type_traits>
+#include <vector>
+
 namespace SST {
 namespace Statistics {
 
@@ -75,6 +80,9 @@ public:
         m_OOBMinCount      = 0;
         m_OOBMaxCount      = 0;
         m_itemsBinnedCount = 0;
+        m_activeBinCount   = 0;
+        m_maxValue         = getBinsMaxValue();
+        m_denseBins        = m_numBins <= maxDenseBins;
         this->setCollectionCount(0);
 
         // Set the Name of this Statistic
@@ -85,17 +93,17 @@ public:
 
 protected:
     /**
-        Adds a new value to the histogram. The correct bin is identified and then incremented. If no bin can be found
-        to hold the value then a new bin is created.
+        Adds a new value to the histogram N times. The bin index is computed directly from the value, and the bin's
+        counter is incremented by N.
     */
     void addData_impl_Ntimes(uint64_t N, BinDataType value) override
     {
         // Check to see if the value is above or below the min/max values
-        if ( value < getBinsMinValue() ) {
+        if ( value < m_minValue ) {
             m_OOBMinCount += N;
             return;
         }
-        if ( value > getBinsMaxValue() ) {
+        if ( value > m_maxValue ) {
             m_OOBMaxCount += N;
             return;
         }
@@ -106,29 +114,20 @@ protected:
         m_totalSummedSqr += N * (value * value);
 
         // Increment the Binned count (note this <= to the Statistics added Item Count)
-        m_itemsBinnedCount++;
-
-        // Figure out what the starting bin is and find it in the map
-        // To support signed and unsigned values along with floating point types,
-        // the calculation to find the bin_start value must be done in floating point
-        // then converted to BinDataType
-        double      calc1     = (double)value / (double)m_binWidth;
-        double      calc2     = floor(calc1); // Find the floor of the value
-        double      calc3     = m_binWidth * calc2;
-        BinDataType bin_start = (BinDataType)calc3;
-        //      printf("DEBUG: value = %d, junk1 = %f, calc2 = %f, calc3 = %f : bin_start = %d, item count = %ld, \n",
-        //      value, calc1, calc2, calc3, bin_start, getStatCollectionCount());
-
-        HistoMapItr_t bin_itr = m_binsMap.find(bin_start);
-
-        // Was the bin found?
-        if ( bin_itr == m_binsMap.end() ) {
-            // No, Create the bin and set a value of 1 to it
-            m_binsMap.insert(std::pair<BinDataType, CountType>(bin_start, (CountType)N));
+        m_itemsBinnedCount += N;
+
+        uint64_t index = getBinIndex(value);
+        if ( m_denseBins ) {
+            // Dense bins: a counter per bin, allocated when the first
+            // value is binned
+            if ( m_binCounts.empty() ) m_binCounts.assign(m_numBins, 0);
+            CountType& count = m_binCounts[index];
+            m_activeBinCount += (0 == count);
+            count += N;
         }
         else {
-            // Yes, Increment the specific bin's count
-            bin_itr->second += N;
+            // Sparse bins: only bins that have been hit are stored
+            m_binsMap[index] += N;
         }
     }
 
@@ -136,7 +135,7 @@ protected:
 
 private:
     /** Count how many bins are active in this histogram */
-    NumBinsType getActiveBinCount() { return m_binsMap.size(); }
+    NumBinsType getActiveBinCount() { return m_denseBins ? m_activeBinCount : m_binsMap.size(); }
 
     /** Count how many bins are available */
     NumBinsType getNumBins() { return m_numBins; }
@@ -145,22 +144,30 @@ private:
     NumBinsType getBinWidth() { return m_binWidth; }
 
     /**
-        Get the count of items in the bin by the start value (e.g. give me the count of items in the bin which begins at
-       value X). \return The count of items in the bin else 0.
+        Get the count of items in a bin
+        \return The count of items in the bin at index binIndex
     */
-    CountType getBinCountByBinStart(BinDataType binStartValue)
+    CountType getBinCount(uint64_t binIndex)
     {
-        // Find the Bin Start Value in the Bin Map
-        HistoMapItr_t bin_itr = m_binsMap.find(binStartValue);
+        if ( m_denseBins ) return m_binCounts.empty() ? (CountType)0 : m_binCounts[binIndex];
+
+        HistoMapItr_t bin_itr = m_binsMap.find(binIndex);
+        return (bin_itr == m_binsMap.end()) ? (CountType)0 : bin_itr->second;
+    }
 
-        // Check to see if the Start Value was found
-        if ( bin_itr == m_binsMap.end() ) {
-            // No, return no count for this bin
-            return (CountType)0;
+    /**
+        Get the index of the bin holding a value that is within the range of the histogram
+    */
+    uint64_t getBinIndex(BinDataType value)
+    {
+        if constexpr ( std::is_integral<BinDataType>::value ) {
+            // Unsigned arithmetic gives the right distance for any signed or unsigned value >= m_minValue
+            return ((uint64_t)value - (uint64_t)m_minValue) / m_binWidth;
         }
         else {
-            // Yes, return the bin count
-            return m_binsMap[binStartValue];
+            // Guard against rounding putting the largest values one bin too high
+            uint64_t index = (uint64_t)((value - m_minValue) / m_binWidth);
+            return (index < m_numBins) ? index : m_numBins - 1;
         }
     }
 
@@ -219,6 +226,8 @@ private:
         m_OOBMinCount      = 0;
         m_OOBMaxCount      = 0;
         m_itemsBinnedCount = 0;
+        m_activeBinCount   = 0;
+        std::fill(m_binCounts.begin(), m_binCounts.end(), 0);
         m_binsMap.clear();
         this->setCollectionCount(0);
     }
@@ -278,11 +287,8 @@ private:
 
         // Do we also need to dump the bin counts on output
         if ( true == m_dumpBinsOnOutput ) {
-            BinDataType currentBinValue = getBinsMinValue();
             for ( uint32_t y = 0; y < getNumBins(); y++ ) {
-                statOutput->outputField(m_Fields[x++], getBinCountByBinStart(currentBinValue));
-                // Increment the currentBinValue to get the next bin
-                currentBinValue += getBinWidth();
+                statOutput->outputField(m_Fields[x++], getBinCount(y));
             }
         }
     }
@@ -301,8 +307,11 @@ private:
     }
 
 private:
-    // Bin Map Definition
-    typedef std::map<BinDataType, CountType> HistoMap_t;
+    // Histograms with more bins than this keep their bins in a map
+    static constexpr NumBinsType maxDenseBins = 1 << 16;
+
+    // Bin Map Definition (bin index to count)
+    typedef std::map<uint64_t, CountType> HistoMap_t;
 
     // Iterator over the histogram bins
     typedef typename HistoMap_t::iterator HistoMapItr_t;
@@ -332,7 +341,17 @@ private:
     // values such as variance.
     BinDataType m_totalSummedSqr;
 
-    // A map of the the bin starts to the bin counts
+    // The largest value that is binned (cached getBinsMaxValue())
+    BinDataType m_maxValue;
+
+    // The bin counts, indexed by bin, when the number of bins is small
+    // enough for a dense array.  Empty until a value is binned.
+    bool                   m_denseBins;
+    std::vector<CountType> m_binCounts;
+    NumBinsType            m_activeBinCount;
+
+    // A map of the bin indexes to the bin counts, used instead of
+    // m_binCounts for very large numbers of bins
     HistoMap_t m_binsMap;
 
     // Support
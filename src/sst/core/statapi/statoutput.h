@@ -107,6 +107,19 @@ protected:
      * Allows object to perform any shutdown required. */
     virtual void endOfSimulation() = 0;
 
+    /** Indicate to Statistic Output that the simulation has reached a
+     * synchronization point at syncTime.  All outputs for earlier times
+     * have been made on every rank; other threads may already be making
+     * outputs for later times.  Called from one thread of each rank, and
+     * in parallel runs from every rank, so it may use collective
+     * communication.  It is only called when needsSynchronize() was true
+     * on at least one rank. */
+    virtual void synchronize(SimTime_t UNUSED(syncTime)) {}
+
+    /** Return true if synchronize() has work to do at syncTime.  Called
+     * from one thread of each rank, just before synchronize(). */
+    virtual bool needsSynchronize(SimTime_t UNUSED(syncTime)) { return false; }
+
 private:
     // Start / Stop of register Fields
     virtual void registerStatistic(StatisticBase* stat) = 0;
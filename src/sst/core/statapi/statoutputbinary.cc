@@ -0,0 +1,307 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statoutputbinary.h"
+
+#include "sst/core/simulation_impl.h"
+
+namespace SST {
+namespace Statistics {
+
+StatisticOutputBinary::StatisticOutputBinary(Params& outputParameters) : StatisticFieldsOutput(outputParameters)
+{
+    // Announce this output object's name
+    Output& out = Simulation_impl::getSimulationOutput();
+    out.verbose(CALL_INFO, 1, 0, " : StatisticOutputBinary enabled...\n");
+    setStatisticOutputName("StatisticOutputBinary");
+
+    m_hFile      = nullptr;
+    m_currentRow = 0;
+    m_fileOffset = 0;
+}
+
+bool
+StatisticOutputBinary::checkOutputParameters()
+{
+    bool foundKey;
+
+    // Look for Help Param
+    getOutputParameters().find<std::string>("help", "1", foundKey);
+    if ( true == foundKey ) { return false; }
+
+    // Get the parameters
+    m_FilePath  = getOutputParameters().find<std::string>("filepath", "./StatisticOutput.bin");
+    m_chunkRows = getOutputParameters().find<uint64_t>("chunkrows", 8192);
+
+    if ( 0 == m_FilePath.length() ) {
+        // Filepath is zero length
+        return false;
+    }
+    if ( 0 == m_chunkRows || m_chunkRows > UINT32_MAX ) {
+        // Must buffer at least one row, and chunk row counts are stored in 32 bits
+        return false;
+    }
+
+    return true;
+}
+
+void
+StatisticOutputBinary::printUsage()
+{
+    // Display how to use this output object
+    Output out("", 0, 0, Output::STDOUT);
+    out.output(" : Usage - Sends all statistic output to a binary columnar file.\n");
+    out.output(" : Parameters:\n");
+    out.output(" : help = Force Statistic Output to display usage\n");
+    out.output(" : filepath = <Path to .bin file> - Default is ./StatisticOutput.bin\n");
+    out.output(" : chunkrows = <rows buffered per chunk before writing> - Default is 8192\n");
+}
+
+uint8_t
+StatisticOutputBinary::getColumnType(fieldType_t type)
+{
+    if ( type == StatisticFieldInfo::getFieldTypeFromTemplate<int32_t>() ) return BinaryStatFormat::INT32;
+    if ( type == StatisticFieldInfo::getFieldTypeFromTemplate<uint32_t>() ) return BinaryStatFormat::UINT32;
+    if ( type == StatisticFieldInfo::getFieldTypeFromTemplate<int64_t>() ) return BinaryStatFormat::INT64;
+    if ( type == StatisticFieldInfo::getFieldTypeFromTemplate<uint64_t>() ) return BinaryStatFormat::UINT64;
+    if ( type == StatisticFieldInfo::getFieldTypeFromTemplate<float>() ) return BinaryStatFormat::FLOAT;
+    if ( type == StatisticFieldInfo::getFieldTypeFromTemplate<double>() ) return BinaryStatFormat::DOUBLE;
+
+    Simulation_impl::getSimulationOutput().fatal(
+        CALL_INFO, 1, "StatisticOutputBinary does not support field type %s\n",
+        StatisticFieldInfo::getFieldTypeFullName(type));
+    return 0;
+}
+
+void
+StatisticOutputBinary::startOfSimulation()
+{
+    // Set Filename with Rank if Num Ranks > 1
+    if ( 1 < Simulation_impl::getSimulation()->getNumRanks().rank ) {
+        int         rank    = Simulation_impl::getSimulation()->getRank().rank;
+        std::string rankstr = "_" + std::to_string(rank);
+
+        // Search for any extension
+        size_t index = m_FilePath.find_last_of(".");
+        if ( std::string::npos != index ) {
+            // We found a . at the end of the file, insert the rank string
+            m_FilePath.insert(index, rankstr);
+        }
+        else {
+            // No . found, append the rank string
+            m_FilePath += rankstr;
+        }
+    }
+
+    m_hFile = fopen(m_FilePath.c_str(), "wb");
+    if ( nullptr == m_hFile ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, " : StatisticOutputBinary - Problem opening File %s - %s\n", m_FilePath.c_str(),
+            strerror(errno));
+    }
+
+    // Build the column schema: the fixed columns followed by one column per field
+    std::vector<std::pair<std::string, uint8_t>> schema;
+    schema.emplace_back("SimTime", BinaryStatFormat::UINT64);
+    schema.emplace_back("StatId", BinaryStatFormat::UINT32);
+    for ( auto* field : getFieldInfoArray() ) {
+        schema.emplace_back(
+            field->getFieldName() + "." + getFieldTypeShortName(field->getFieldType()),
+            getColumnType(field->getFieldType()));
+    }
+
+    // Allocate (zeroed) column buffers for a full chunk
+    m_columns.resize(schema.size());
+    for ( size_t i = 0; i < schema.size(); i++ ) {
+        m_columns[i].width = BinaryStatFormat::columnWidth(schema[i].second);
+        m_columns[i].data.assign(m_chunkRows * m_columns[i].width, 0);
+    }
+
+    // Write the file header and column schema
+    uint32_t header[5] = { BinaryStatFormat::byteOrderMark, (uint32_t)Simulation_impl::getSimulation()->getRank().rank,
+                           (uint32_t)schema.size(), (uint32_t)m_chunkRows, 0 };
+    writeBytes(&BinaryStatFormat::fileMagic, sizeof(uint64_t));
+    writeBytes(&BinaryStatFormat::version, sizeof(uint32_t));
+    writeBytes(header, sizeof(header));
+
+    for ( auto& col : schema ) {
+        uint8_t type[2] = { col.second, 0 };
+        writeBytes(type, sizeof(type));
+        writeString(col.first);
+    }
+    writePadding(BinaryStatFormat::padTo8(m_fileOffset) - m_fileOffset);
+}
+
+void
+StatisticOutputBinary::endOfSimulation()
+{
+    if ( nullptr == m_hFile ) return;
+
+    flushChunk();
+
+    uint64_t footerOffset = m_fileOffset;
+
+    // Statistic table
+    uint32_t numStats = m_statInfos.size();
+    writeBytes(&numStats, sizeof(numStats));
+    for ( auto& info : m_statInfos ) {
+        writeString(info.compName);
+        writeString(info.statName);
+        writeString(info.statSubId);
+        writeString(info.statType);
+    }
+
+    // Chunk index
+    uint64_t numChunks = m_chunkOffsets.size();
+    writeBytes(&numChunks, sizeof(numChunks));
+    for ( size_t i = 0; i < m_chunkOffsets.size(); i++ ) {
+        writeBytes(&m_chunkOffsets[i], sizeof(uint64_t));
+        writeBytes(&m_chunkRowCounts[i], sizeof(uint64_t));
+    }
+
+    // Trailer
+    writeBytes(&footerOffset, sizeof(footerOffset));
+    writeBytes(&BinaryStatFormat::endMagic, sizeof(uint64_t));
+
+    // Buffered data is written out by fclose, so it can fail too
+    if ( 0 != fclose(m_hFile) ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, " : StatisticOutputBinary - Problem closing File %s - %s\n", m_FilePath.c_str(),
+            strerror(errno));
+    }
+    m_hFile = nullptr;
+}
+
+uint32_t
+StatisticOutputBinary::getStatisticId(StatisticBase* statistic)
+{
+    auto iter = m_statIds.find(statistic);
+    if ( iter != m_statIds.end() ) return iter->second;
+
+    uint32_t id          = m_statInfos.size();
+    m_statIds[statistic] = id;
+    m_statInfos.push_back(
+        { statistic->getCompName(), statistic->getStatName(), statistic->getStatSubId(),
+          statistic->getStatTypeName() });
+    return id;
+}
+
+void
+StatisticOutputBinary::implStartOutputEntries(StatisticBase* statistic)
+{
+    // Column buffers are zeroed in bulk when a chunk is flushed, so only
+    // the fixed columns need to be filled in here
+    uint64_t simTime = Simulation_impl::getSimulation()->getCurrentSimCycle();
+    uint32_t statId  = getStatisticId(statistic);
+    memcpy(&m_columns[BinaryStatFormat::simTimeColumn].data[m_currentRow * sizeof(simTime)], &simTime, sizeof(simTime));
+    memcpy(&m_columns[BinaryStatFormat::statIdColumn].data[m_currentRow * sizeof(statId)], &statId, sizeof(statId));
+}
+
+void
+StatisticOutputBinary::implStopOutputEntries()
+{
+    m_currentRow++;
+    if ( m_currentRow == m_chunkRows ) { flushChunk(); }
+}
+
+void
+StatisticOutputBinary::flushChunk()
+{
+    if ( 0 == m_currentRow ) return;
+
+    m_chunkOffsets.push_back(m_fileOffset);
+    m_chunkRowCounts.push_back(m_currentRow);
+
+    uint32_t chunkHeader[2] = { BinaryStatFormat::chunkMagic, (uint32_t)m_currentRow };
+    writeBytes(chunkHeader, sizeof(chunkHeader));
+
+    for ( auto& col : m_columns ) {
+        size_t bytes = m_currentRow * col.width;
+        writeBytes(col.data.data(), bytes);
+        writePadding(BinaryStatFormat::padTo8(bytes) - bytes);
+        memset(col.data.data(), 0, bytes);
+    }
+    m_currentRow = 0;
+}
+
+void
+StatisticOutputBinary::writeBytes(const void* data, size_t size)
+{
+    if ( fwrite(data, 1, size, m_hFile) != size ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, " : StatisticOutputBinary - Problem writing File %s - %s\n", m_FilePath.c_str(),
+            strerror(errno));
+    }
+    m_fileOffset += size;
+}
+
+void
+StatisticOutputBinary::writeString(const std::string& str)
+{
+    // String lengths are stored in 16 bits
+    if ( str.length() > UINT16_MAX ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1,
+            " : StatisticOutputBinary - Name of %zu bytes is longer than the 65535 bytes the format allows: %.64s...\n",
+            str.length(), str.c_str());
+    }
+    uint16_t len = str.length();
+    writeBytes(&len, sizeof(len));
+    writeBytes(str.data(), len);
+}
+
+void
+StatisticOutputBinary::writePadding(size_t size)
+{
+    const uint8_t zeros[8] = { 0 };
+    writeBytes(zeros, size);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, int32_t data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, int64_t data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, uint64_t data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, float data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, double data)
+{
+    storeField(fieldHandle, data);
+}
+
+} // namespace Statistics
+} // namespace SST
@@ -0,0 +1,141 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATOUTPUTBINARY_H
+#define SST_CORE_STATAPI_STATOUTPUTBINARY_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbinaryreader.h"
+#include "sst/core/statapi/statoutput.h"
+
+#include <unordered_map>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticOutputBinary
+
+    The class for statistics output to a binary columnar file.  Each
+    registered field is stored as a column of fixed-width native values.
+    Rows are buffered per column and appended to the file in chunks, so
+    the cost of an output is a handful of stores rather than a formatted
+    print.  See BinaryStatFormat for the layout and StatisticBinaryReader
+    for a memory-mapped reader.
+*/
+class StatisticOutputBinary : public StatisticFieldsOutput
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+      StatisticOutput,
+      StatisticOutputBinary,
+      "sst",
+      "statoutputbinary",
+      SST_ELI_ELEMENT_VERSION(1,0,0),
+      "Output to a binary columnar file"
+   )
+
+    /** Construct a StatOutputBinary
+     * @param outputParameters - Parameters used for this Statistic Output
+     */
+    StatisticOutputBinary(Params& outputParameters);
+
+protected:
+    /** Perform a check of provided parameters
+     * @return True if all required parameters and options are acceptable
+     */
+    bool checkOutputParameters() override;
+
+    /** Print out usage for this Statistic Output */
+    void printUsage() override;
+
+    /** Indicate to Statistic Output that simulation started.
+     *  Statistic output may perform any startup code here as necessary.
+     */
+    void startOfSimulation() override;
+
+    /** Indicate to Statistic Output that simulation ended.
+     *  Statistic output may perform any shutdown code here as necessary.
+     */
+    void endOfSimulation() override;
+
+    /** Implementation function for the start of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is about to send data to the Statistic Output for processing.
+     * @param statistic - Pointer to the statistic object than the output can
+     * retrieve data from.
+     */
+    void implStartOutputEntries(StatisticBase* statistic) override;
+
+    /** Implementation function for the end of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is finished sending data to the Statistic Output for processing.
+     * The Statistic Output can perform any output related functions here.
+     */
+    void implStopOutputEntries() override;
+
+    /** Implementation functions for output.
+     * These will be called by the statistic to provide Statistic defined
+     * data to be output.
+     * @param fieldHandle - The handle to the registered statistic field.
+     * @param data - The data related to the registered field to be output.
+     */
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, float data) override;
+    void outputField(fieldHandle_t fieldHandle, double data) override;
+
+    /** True if this StatOutput can handle StatisticGroups */
+    virtual bool acceptsGroups() const override { return true; }
+
+protected:
+    StatisticOutputBinary() { ; } // For serialization
+
+private:
+    struct ColumnBuffer
+    {
+        std::vector<uint8_t> data;
+        size_t               width;
+    };
+
+    template <typename T>
+    void storeField(fieldHandle_t fieldHandle, T data)
+    {
+        ColumnBuffer& col = m_columns[BinaryStatFormat::numFixedColumns + fieldHandle];
+        memcpy(&col.data[m_currentRow * sizeof(T)], &data, sizeof(T));
+    }
+
+    uint8_t  getColumnType(fieldType_t type);
+    void     writeBytes(const void* data, size_t size);
+    void     writeString(const std::string& str);
+    void     writePadding(size_t size);
+    void     flushChunk();
+    uint32_t getStatisticId(StatisticBase* statistic);
+
+private:
+    FILE*                                        m_hFile;
+    std::string                                  m_FilePath;
+    uint64_t                                     m_chunkRows;
+    uint64_t                                     m_currentRow;
+    uint64_t                                     m_fileOffset;
+    std::vector<ColumnBuffer>                    m_columns;
+    std::vector<uint64_t>                        m_chunkOffsets;
+    std::vector<uint64_t>                        m_chunkRowCounts;
+    std::unordered_map<StatisticBase*, uint32_t> m_statIds;
+    std::vector<StatisticBinaryReader::StatInfo> m_statInfos;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATOUTPUTBINARY_H
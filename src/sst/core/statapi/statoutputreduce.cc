@@ -0,0 +1,528 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/statapi/statoutputreduce.h"
+
+#include "sst/core/objectComms.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/statapi/statgroup.h"
+#include "sst/core/stringize.h"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <type_traits>
+
+namespace SST {
+namespace Statistics {
+
+void
+StatisticOutputReduce::ReducedField::merge(const ReducedField& other)
+{
+    switch ( op ) {
+    case REDUCE_SUM:
+        ival += other.ival;
+        uval += other.uval;
+        dval += other.dval;
+        break;
+    case REDUCE_MIN:
+        ival = std::min(ival, other.ival);
+        uval = std::min(uval, other.uval);
+        dval = std::min(dval, other.dval);
+        break;
+    case REDUCE_MAX:
+        ival = std::max(ival, other.ival);
+        uval = std::max(uval, other.uval);
+        dval = std::max(dval, other.dval);
+        break;
+    case REDUCE_FIRST:
+    default:
+        break;
+    }
+}
+
+std::string
+StatisticOutputReduce::ReducedField::toString() const
+{
+    switch ( kind ) {
+    case VALUE_UNSIGNED:
+        return format_string("%" PRIu64, uval);
+    case VALUE_FLOAT:
+        return format_string("%f", dval);
+    case VALUE_SIGNED:
+    default:
+        return format_string("%" PRId64, ival);
+    }
+}
+
+void
+StatisticOutputReduce::ReducedRecord::merge(const ReducedRecord& other)
+{
+    numMerged += other.numMerged;
+    for ( auto& field : other.fields ) {
+        auto iter = fields.find(field.first);
+        if ( iter == fields.end() ) { fields.insert(field); }
+        else {
+            iter->second.merge(field.second);
+        }
+    }
+    if ( other.hasSketch ) addSketch(other.sketch, other.quantiles);
+    if ( UNIQUE_EXACT == other.uniqueMode ) addUniqueValues(other.uniqueValues);
+    if ( UNIQUE_HLL == other.uniqueMode ) addHyperLogLog(other.hll);
+}
+
+void
+StatisticOutputReduce::ReducedRecord::addSketch(
+    const QuantileSketch& otherSketch, const std::vector<double>& otherQuantiles)
+{
+    if ( !hasSketch ) {
+        sketch    = otherSketch;
+        quantiles = otherQuantiles;
+        hasSketch = true;
+        return;
+    }
+    if ( !sketch.merge(otherSketch) ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1,
+            " : StatisticOutputReduce - Statistic %s of type %s has different accuracies and cannot be merged\n",
+            statName.c_str(), statType.c_str());
+    }
+    for ( auto q : otherQuantiles ) {
+        if ( std::find(quantiles.begin(), quantiles.end(), q) == quantiles.end() ) quantiles.push_back(q);
+    }
+}
+
+void
+StatisticOutputReduce::ReducedRecord::addUniqueValues(const std::set<uint64_t>& otherValues)
+{
+    if ( UNIQUE_HLL == uniqueMode ) {
+        // Mixed with estimated counts, so the result is an estimate too
+        for ( auto bits : otherValues ) {
+            hll.addHash(HyperLogLog::hashBits(bits));
+        }
+        return;
+    }
+    uniqueMode = UNIQUE_EXACT;
+    uniqueValues.insert(otherValues.begin(), otherValues.end());
+}
+
+void
+StatisticOutputReduce::ReducedRecord::addHyperLogLog(const HyperLogLog& otherHll)
+{
+    if ( UNIQUE_HLL != uniqueMode ) {
+        hll = otherHll;
+        for ( auto bits : uniqueValues ) {
+            hll.addHash(HyperLogLog::hashBits(bits));
+        }
+        uniqueValues.clear();
+        uniqueMode = UNIQUE_HLL;
+        return;
+    }
+    if ( !hll.merge(otherHll) ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1,
+            " : StatisticOutputReduce - Statistic %s of type %s has different precisions and cannot be merged\n",
+            statName.c_str(), statType.c_str());
+    }
+}
+
+uint64_t
+StatisticOutputReduce::ReducedRecord::getUniqueCount() const
+{
+    return UNIQUE_HLL == uniqueMode ? hll.getEstimate() : uniqueValues.size();
+}
+
+StatisticOutputReduce::StatisticOutputReduce(Params& outputParameters) : StatisticFieldsOutput(outputParameters)
+{
+    // Announce this output object's name
+    Output& out = Simulation_impl::getSimulationOutput();
+    out.verbose(CALL_INFO, 1, 0, " : StatisticOutputReduce enabled...\n");
+    setStatisticOutputName("StatisticOutputReduce");
+
+    m_hFile           = nullptr;
+    m_rank            = 0;
+    m_numRanks        = 1;
+    m_serial          = true;
+    m_currentEndOfSim = false;
+    m_currentStat     = nullptr;
+}
+
+bool
+StatisticOutputReduce::checkOutputParameters()
+{
+    bool foundKey;
+
+    // Look for Help Param
+    getOutputParameters().find<std::string>("help", "1", foundKey);
+    if ( true == foundKey ) { return false; }
+
+    // Get the parameters
+    m_FilePath  = getOutputParameters().find<std::string>("filepath", "./StatisticOutput.csv");
+    m_Separator = getOutputParameters().find<std::string>("separator", ", ");
+
+    if ( 0 == m_FilePath.length() ) {
+        // Filepath is zero length
+        return false;
+    }
+    if ( 0 == m_Separator.length() ) {
+        // Separator is zero length
+        return false;
+    }
+
+    return true;
+}
+
+void
+StatisticOutputReduce::printUsage()
+{
+    // Display how to use this output object
+    Output out("", 0, 0, Output::STDOUT);
+    out.output(" : Usage - Reduces statistics with the same name and type across components, threads\n");
+    out.output(" :         and ranks and writes them to a single CSV File from rank 0.\n");
+    out.output(" : Parameters:\n");
+    out.output(" : help = Force Statistic Output to display usage\n");
+    out.output(" : filepath = <Path to .csv file> - Default is ./StatisticOutput.csv\n");
+    out.output(" : separator = <separator between fields> - Default is \", \"\n");
+}
+
+void
+StatisticOutputReduce::startOfSimulation()
+{
+    m_rank     = Simulation_impl::getSimulation()->getRank().rank;
+    m_numRanks = Simulation_impl::getSimulation()->getNumRanks().rank;
+    m_serial   = 1 == m_numRanks && 1 == Simulation_impl::getSimulation()->getNumRanks().thread;
+
+    // The columns are the union of the fields registered on all ranks
+    std::set<std::string> fieldNames;
+    for ( auto* fieldInfo : getFieldInfoArray() ) {
+        fieldNames.insert(getFieldKey(fieldInfo));
+    }
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( m_numRanks > 1 ) {
+        std::vector<std::set<std::string>> allFieldNames;
+        Comms::gather(fieldNames, allFieldNames, 0);
+        for ( auto& names : allFieldNames ) {
+            fieldNames.insert(names.begin(), names.end());
+        }
+    }
+#endif
+    if ( 0 != m_rank ) return;
+    m_fieldNames.assign(fieldNames.begin(), fieldNames.end());
+
+    m_hFile = fopen(m_FilePath.c_str(), "w");
+    if ( nullptr == m_hFile ) {
+        Simulation_impl::getSimulationOutput().fatal(
+            CALL_INFO, 1, " : StatisticOutputReduce - Problem opening File %s - %s\n", m_FilePath.c_str(),
+            strerror(errno));
+    }
+
+    std::string line = "StatisticGroup" + m_Separator + "StatisticName" + m_Separator + "StatisticSubId" +
+                       m_Separator + "StatisticType" + m_Separator + "SimTime" + m_Separator + "EndOfSim" +
+                       m_Separator + "NumMerged";
+    for ( auto& name : m_fieldNames ) {
+        line += m_Separator + name;
+    }
+    fprintf(m_hFile, "%s\n", line.c_str());
+}
+
+void
+StatisticOutputReduce::endOfSimulation()
+{
+    reducePeriods(MAX_SIMTIME_T);
+    if ( nullptr != m_hFile ) {
+        fclose(m_hFile);
+        m_hFile = nullptr;
+    }
+}
+
+void
+StatisticOutputReduce::synchronize(SimTime_t syncTime)
+{
+    this->lock();
+    reducePeriods(syncTime);
+    this->unlock();
+}
+
+bool
+StatisticOutputReduce::needsSynchronize(SimTime_t syncTime)
+{
+    this->lock();
+    bool ended = !m_records.empty() && m_records.begin()->second.simTime < syncTime;
+    this->unlock();
+    return ended;
+}
+
+void
+StatisticOutputReduce::reducePeriods(SimTime_t endTime)
+{
+    // Records are ordered by time, so the periods that ended before
+    // endTime are at the front of the map
+    RecordMap_t ended;
+    auto        end = m_records.lower_bound(format_string("%020" PRIu64, endTime));
+    ended.insert(std::make_move_iterator(m_records.begin()), std::make_move_iterator(end));
+    m_records.erase(m_records.begin(), end);
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Binomial tree reduction to rank 0: in each round, the ranks with
+    // the current bit set send what they have merged so far to their
+    // partner and drop out
+    for ( int mask = 1; mask < m_numRanks; mask <<= 1 ) {
+        if ( m_rank & mask ) {
+            Comms::send(m_rank - mask, 0, ended);
+            return;
+        }
+        if ( m_rank + mask < m_numRanks ) {
+            RecordMap_t other;
+            Comms::recv(m_rank + mask, 0, other);
+            mergeRecords(ended, other);
+        }
+    }
+#endif
+    writeRecords(ended);
+}
+
+void
+StatisticOutputReduce::mergeRecords(RecordMap_t& records, RecordMap_t& other)
+{
+    for ( auto& record : other ) {
+        auto iter = records.find(record.first);
+        if ( iter == records.end() ) { records.insert(std::move(record)); }
+        else {
+            iter->second.merge(record.second);
+        }
+    }
+}
+
+void
+StatisticOutputReduce::writeRecords(RecordMap_t& records)
+{
+    if ( records.empty() ) return;
+
+    const std::string doubleType =
+        StatisticFieldInfo::getFieldTypeShortName(StatisticFieldInfo::getFieldTypeFromTemplate<double>());
+    const std::string uint64Type =
+        StatisticFieldInfo::getFieldTypeShortName(StatisticFieldInfo::getFieldTypeFromTemplate<uint64_t>());
+
+    for ( auto& iter : records ) {
+        ReducedRecord& record = iter.second;
+
+        // Quantiles cannot be merged from their values, so they are read
+        // from the merged sketch
+        if ( record.hasSketch ) {
+            for ( auto q : record.quantiles ) {
+                std::string   name  = QuantileStatisticBase::getQuantileFieldName(q) + "." + doubleType;
+                ReducedField& field = record.fields[name];
+                field.kind          = VALUE_FLOAT;
+                field.dval          = record.sketch.getQuantile(q);
+            }
+        }
+
+        // Unique counts are not additive, so they are counted from the
+        // merged values
+        if ( UNIQUE_NONE != record.uniqueMode ) {
+            std::string   name  = std::string(UniqueCountStatisticBase::uniqueItemsFieldName) + "." + uint64Type;
+            ReducedField& field = record.fields[name];
+            field.kind          = VALUE_UNSIGNED;
+            field.uval          = record.getUniqueCount();
+        }
+
+        std::string line = record.groupName + m_Separator + record.statName + m_Separator + record.statSubId +
+                           m_Separator + record.statType + m_Separator + std::to_string(record.simTime) +
+                           m_Separator + (record.endOfSim ? "1" : "0") + m_Separator +
+                           std::to_string(record.numMerged);
+        for ( auto& name : m_fieldNames ) {
+            auto field = record.fields.find(name);
+            line += m_Separator + (field == record.fields.end() ? std::string("0") : field->second.toString());
+        }
+        fprintf(m_hFile, "%s\n", line.c_str());
+    }
+    fflush(m_hFile);
+}
+
+void
+StatisticOutputReduce::output(StatisticBase* statistic, bool endOfSimFlag)
+{
+    this->lock();
+    m_currentEndOfSim = endOfSimFlag;
+    StatisticFieldsOutput::output(statistic, endOfSimFlag);
+    this->unlock();
+}
+
+void
+StatisticOutputReduce::startOutputGroup(StatisticGroup* group)
+{
+    StatisticFieldsOutput::startOutputGroup(group);
+    m_currentGroup = group->name;
+}
+
+void
+StatisticOutputReduce::stopOutputGroup()
+{
+    StatisticFieldsOutput::stopOutputGroup();
+    m_currentGroup = "";
+}
+
+StatisticOutputReduce::ReduceOp
+StatisticOutputReduce::getReduceOp(const std::string& fieldName)
+{
+    if ( fieldName == "Min" || fieldName == "BinsMinValue" ) return REDUCE_MIN;
+    // NumActiveBins cannot be recomputed from the merged bins, so the
+    // largest per-statistic count is reported
+    if ( fieldName == "Max" || fieldName == "BinsMaxValue" || fieldName == "TotalNumBins" ||
+         fieldName == "NumActiveBins" )
+        return REDUCE_MAX;
+    if ( fieldName == "BinWidth" ) return REDUCE_FIRST;
+    return REDUCE_SUM;
+}
+
+std::string
+StatisticOutputReduce::getFieldKey(StatisticFieldInfo* fieldInfo)
+{
+    return fieldInfo->getFieldName() + "." + getFieldTypeShortName(fieldInfo->getFieldType());
+}
+
+void
+StatisticOutputReduce::implStartOutputEntries(StatisticBase* statistic)
+{
+    // Field handles are only valid on this rank, so each handle is mapped
+    // to a "name.type" key that is the same on every rank
+    auto& fieldInfos = getFieldInfoArray();
+    if ( m_fieldKeys.size() != fieldInfos.size() ) {
+        m_fieldKeys.resize(fieldInfos.size());
+        m_currentFields.resize(fieldInfos.size());
+        for ( size_t i = 0; i < fieldInfos.size(); i++ ) {
+            m_fieldKeys[i]        = getFieldKey(fieldInfos[i]);
+            m_currentFields[i].op = getReduceOp(fieldInfos[i]->getFieldName());
+        }
+    }
+    m_currentValid.assign(fieldInfos.size(), false);
+    m_currentStat = statistic;
+}
+
+void
+StatisticOutputReduce::implStopOutputEntries()
+{
+    uint64_t simTime = Simulation_impl::getSimulation()->getCurrentSimCycle();
+
+    // With one thread on one rank, an output at a later time means the
+    // earlier periods are complete
+    if ( m_serial && !m_records.empty() && m_records.begin()->second.simTime < simTime ) reducePeriods(simTime);
+
+    // Build the key so that records sort by time, then end of sim flag
+    std::string key = format_string("%020" PRIu64 "%c", simTime, m_currentEndOfSim ? '1' : '0');
+    key += m_currentGroup + '\0' + m_currentStat->getStatName() + '\0' + m_currentStat->getStatSubId() + '\0' +
+           m_currentStat->getStatTypeName();
+
+    ReducedRecord& record = m_records[key];
+    if ( 0 == record.numMerged ) {
+        record.simTime   = simTime;
+        record.endOfSim  = m_currentEndOfSim;
+        record.groupName = m_currentGroup;
+        record.statName  = m_currentStat->getStatName();
+        record.statSubId = m_currentStat->getStatSubId();
+        record.statType  = m_currentStat->getStatTypeName();
+    }
+    record.numMerged++;
+
+    // A statistic that has not collected anything reports 0 for its
+    // minimum and maximum, which must not take part in the reduction
+    bool empty = false;
+    for ( size_t i = 0; i < m_currentValid.size(); i++ ) {
+        if ( !m_currentValid[i] ) continue;
+        const std::string& name = getFieldInfoArray()[i]->getFieldName();
+        if ( (name == "Count" || name == "NumItemsCollected") && 0 == m_currentFields[i].uval ) empty = true;
+    }
+
+    for ( size_t i = 0; i < m_currentValid.size(); i++ ) {
+        if ( !m_currentValid[i] ) continue;
+        const std::string& name = getFieldInfoArray()[i]->getFieldName();
+        if ( empty && (name == "Min" || name == "Max") ) continue;
+
+        auto iter = record.fields.find(m_fieldKeys[i]);
+        if ( iter == record.fields.end() ) { record.fields.emplace(m_fieldKeys[i], m_currentFields[i]); }
+        else {
+            iter->second.merge(m_currentFields[i]);
+        }
+    }
+
+    auto* quantileStat = dynamic_cast<QuantileStatisticBase*>(m_currentStat);
+    if ( quantileStat ) record.addSketch(quantileStat->getSketch(), quantileStat->getQuantiles());
+
+    auto* uniqueStat = dynamic_cast<UniqueCountStatisticBase*>(m_currentStat);
+    if ( uniqueStat && uniqueStat->isApproximate() ) { record.addHyperLogLog(uniqueStat->getHyperLogLog()); }
+    else if ( uniqueStat ) {
+        std::set<uint64_t> bits;
+        uniqueStat->getUniqueValueBits(bits);
+        record.addUniqueValues(bits);
+    }
+    m_currentStat = nullptr;
+}
+
+template <typename T>
+void
+StatisticOutputReduce::storeField(fieldHandle_t fieldHandle, T data)
+{
+    ReducedField& field = m_currentFields[fieldHandle];
+    if constexpr ( std::is_floating_point<T>::value ) {
+        field.kind = VALUE_FLOAT;
+        field.dval = data;
+    }
+    else if constexpr ( std::is_signed<T>::value ) {
+        field.kind = VALUE_SIGNED;
+        field.ival = data;
+    }
+    else {
+        field.kind = VALUE_UNSIGNED;
+        field.uval = data;
+    }
+    m_currentValid[fieldHandle] = true;
+}
+
+void
+StatisticOutputReduce::outputField(fieldHandle_t fieldHandle, int32_t data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputReduce::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputReduce::outputField(fieldHandle_t fieldHandle, int64_t data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputReduce::outputField(fieldHandle_t fieldHandle, uint64_t data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputReduce::outputField(fieldHandle_t fieldHandle, float data)
+{
+    storeField(fieldHandle, data);
+}
+
+void
+StatisticOutputReduce::outputField(fieldHandle_t fieldHandle, double data)
+{
+    storeField(fieldHandle, data);
+}
+
+} // namespace Statistics
+} // namespace SST
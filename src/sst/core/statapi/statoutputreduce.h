@@ -0,0 +1,263 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATOUTPUTREDUCE_H
+#define SST_CORE_STATAPI_STATOUTPUTREDUCE_H
+
+#include "sst/core/serialization/serializable.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/statapi/statquantile.h"
+#include "sst/core/statapi/statuniquecount.h"
+
+#include <map>
+#include <set>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticOutputReduce
+
+    The class for statistics output that is reduced to a single global
+    CSV file.  Statistics with the same name, subid and type (or the
+    same StatisticGroup, when groups are used) are merged across
+    components, threads and ranks.  Fields are summed by default;
+    minimum and maximum fields are merged with min/max and histogram
+    bin layout fields are kept as is.  Quantiles are read from the
+    merged sketches of the QuantileStatistics and unique counts from
+    the merged value sets or HyperLogLogs of the UniqueCountStatistics.
+
+    Outputs are merged locally as they happen.  Periodic outputs fire
+    inside clock handlers, where a collective call could deadlock, so
+    each output period is reduced to rank 0 at the first
+    synchronization point after it ends, when every rank has made its
+    outputs for it, and rank 0 appends its rows to the file.  Whether
+    any rank has a period to reduce is exchanged with the exit check
+    that runs at every rank synchronization, so synchronization points
+    where no period ended cost no extra communication.  The reduction
+    is a binomial tree, so each rank merges at most log2(ranks) maps.  Only the
+    periods that have not been reduced yet are held in memory.  In a
+    serial run a period is written as soon as a later output is made.
+*/
+class StatisticOutputReduce : public StatisticFieldsOutput
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+      StatisticOutput,
+      StatisticOutputReduce,
+      "sst",
+      "statoutputreduce",
+      SST_ELI_ELEMENT_VERSION(1,0,0),
+      "Output statistics reduced across components, threads and ranks to a single CSV file"
+   )
+
+    /** Construct a StatOutputReduce
+     * @param outputParameters - Parameters used for this Statistic Output
+     */
+    StatisticOutputReduce(Params& outputParameters);
+
+    void output(StatisticBase* statistic, bool endOfSimFlag) override;
+
+    void startOutputGroup(StatisticGroup* group) override;
+    void stopOutputGroup() override;
+
+protected:
+    /** Perform a check of provided parameters
+     * @return True if all required parameters and options are acceptable
+     */
+    bool checkOutputParameters() override;
+
+    /** Print out usage for this Statistic Output */
+    void printUsage() override;
+
+    /** Indicate to Statistic Output that simulation started.
+     *  Statistic output may perform any startup code here as necessary.
+     */
+    void startOfSimulation() override;
+
+    /** Indicate to Statistic Output that simulation ended.  The
+     *  remaining per-rank results are reduced to rank 0 and written here.
+     */
+    void endOfSimulation() override;
+
+    /** Reduce the output periods that ended before syncTime to rank 0
+     *  and write them.
+     */
+    void synchronize(SimTime_t syncTime) override;
+
+    /** Return true if an output period ended before syncTime has not
+     *  been reduced yet.
+     */
+    bool needsSynchronize(SimTime_t syncTime) override;
+
+    /** Implementation function for the start of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is about to send data to the Statistic Output for processing.
+     * @param statistic - Pointer to the statistic object than the output can
+     * retrieve data from.
+     */
+    void implStartOutputEntries(StatisticBase* statistic) override;
+
+    /** Implementation function for the end of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is finished sending data to the Statistic Output for processing.
+     * The Statistic Output can perform any output related functions here.
+     */
+    void implStopOutputEntries() override;
+
+    /** Implementation functions for output.
+     * These will be called by the statistic to provide Statistic defined
+     * data to be output.
+     * @param fieldHandle - The handle to the registered statistic field.
+     * @param data - The data related to the registered field to be output.
+     */
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, float data) override;
+    void outputField(fieldHandle_t fieldHandle, double data) override;
+
+    /** True if this StatOutput can handle StatisticGroups */
+    virtual bool acceptsGroups() const override { return true; }
+
+protected:
+    StatisticOutputReduce() { ; } // For serialization
+
+public:
+    /** How values of a field are combined */
+    enum ReduceOp : uint8_t { REDUCE_SUM, REDUCE_MIN, REDUCE_MAX, REDUCE_FIRST };
+
+    /** Value representation of a field */
+    enum ValueKind : uint8_t { VALUE_SIGNED, VALUE_UNSIGNED, VALUE_FLOAT };
+
+    /** How the unique values of a record are kept */
+    enum UniqueMode : uint8_t { UNIQUE_NONE, UNIQUE_EXACT, UNIQUE_HLL };
+
+    /** A single reduced field value */
+    class ReducedField : public SST::Core::Serialization::serializable
+    {
+    public:
+        uint8_t  kind = VALUE_SIGNED;
+        uint8_t  op   = REDUCE_SUM;
+        int64_t  ival = 0;
+        uint64_t uval = 0;
+        double   dval = 0.0;
+
+        /** Combine another value of the same field into this one */
+        void merge(const ReducedField& other);
+
+        /** Return the value formatted for the CSV file */
+        std::string toString() const;
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) override
+        {
+            ser& kind;
+            ser& op;
+            ser& ival;
+            ser& uval;
+            ser& dval;
+        }
+
+        ImplementSerializable(SST::Statistics::StatisticOutputReduce::ReducedField)
+    };
+
+    /** All values reduced into one output row */
+    class ReducedRecord : public SST::Core::Serialization::serializable
+    {
+    public:
+        uint64_t                            simTime   = 0;
+        bool                                endOfSim  = false;
+        uint64_t                            numMerged = 0;
+        std::string                         groupName;
+        std::string                         statName;
+        std::string                         statSubId;
+        std::string                         statType;
+        std::map<std::string, ReducedField> fields;
+        bool                                hasSketch = false;
+        QuantileSketch                      sketch;
+        std::vector<double>                 quantiles;
+        uint8_t                             uniqueMode = UNIQUE_NONE;
+        std::set<uint64_t>                  uniqueValues;
+        HyperLogLog                         hll { HyperLogLog::minPrecision };
+
+        /** Combine another record with the same key into this one */
+        void merge(const ReducedRecord& other);
+
+        /** Merge the sketch of a QuantileStatistic into this record */
+        void addSketch(const QuantileSketch& otherSketch, const std::vector<double>& otherQuantiles);
+
+        /** Merge the unique values of a UniqueCountStatistic into this record */
+        void addUniqueValues(const std::set<uint64_t>& otherValues);
+
+        /** Merge the estimator of a UniqueCountStatistic into this record */
+        void addHyperLogLog(const HyperLogLog& otherHll);
+
+        /** Return the number of unique values merged into this record */
+        uint64_t getUniqueCount() const;
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) override
+        {
+            ser& simTime;
+            ser& endOfSim;
+            ser& numMerged;
+            ser& groupName;
+            ser& statName;
+            ser& statSubId;
+            ser& statType;
+            ser& fields;
+            ser& hasSketch;
+            ser& sketch;
+            ser& quantiles;
+            ser& uniqueMode;
+            ser& uniqueValues;
+            ser& hll;
+        }
+
+        ImplementSerializable(SST::Statistics::StatisticOutputReduce::ReducedRecord)
+    };
+
+    /** Records keyed so that map order is simulation time, then end of
+     *  simulation flag, then statistic identity */
+    typedef std::map<std::string, ReducedRecord> RecordMap_t;
+
+private:
+    template <typename T>
+    void storeField(fieldHandle_t fieldHandle, T data);
+
+    ReduceOp    getReduceOp(const std::string& fieldName);
+    std::string getFieldKey(StatisticFieldInfo* fieldInfo);
+    void        reducePeriods(SimTime_t endTime);
+    void        mergeRecords(RecordMap_t& records, RecordMap_t& other);
+    void        writeRecords(RecordMap_t& records);
+
+private:
+    std::string               m_FilePath;
+    std::string               m_Separator;
+    FILE*                     m_hFile;
+    int                       m_rank;
+    int                       m_numRanks;
+    bool                      m_serial;
+    std::vector<std::string>  m_fieldNames;
+    std::string               m_currentGroup;
+    bool                      m_currentEndOfSim;
+    StatisticBase*            m_currentStat;
+    std::vector<ReducedField> m_currentFields;
+    std::vector<bool>         m_currentValid;
+    std::vector<std::string>  m_fieldKeys;
+    RecordMap_t               m_records;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATOUTPUTREDUCE_H
@@ -0,0 +1,435 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATQUANTILE_H
+#define SST_CORE_STATAPI_STATQUANTILE_H
+
+#include "sst/core/output.h"
+#include "sst/core/serialization/serializable.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class QuantileSketch
+
+    Fixed-memory, mergeable sketch of a distribution that answers
+    quantile queries with a bounded relative error (DDSketch).  Values
+    are mapped to logarithmically sized buckets, so that any value in
+    a bucket is within the relative accuracy of the bucket's
+    representative value.  Positive and negative values are kept in
+    separate stores.  When a store would need more than the maximum
+    number of buckets, the lowest buckets are collapsed together,
+    which only affects the accuracy of the smallest magnitudes.
+
+    Two sketches created with the same relative accuracy can be merged
+    by adding their bucket counts, so sketches from different
+    components, threads or ranks (the class is serializable) can be
+    combined without loss.
+*/
+class QuantileSketch : public SST::Core::Serialization::serializable
+{
+public:
+    /** Create a sketch
+     * @param relativeAccuracy - Relative error bound of quantile estimates (0 < alpha < 1)
+     * @param maxBins - Maximum number of buckets in each of the positive and negative stores
+     */
+    QuantileSketch(double relativeAccuracy = 0.01, uint32_t maxBins = 2048) :
+        m_relativeAccuracy(relativeAccuracy),
+        m_maxBins(maxBins),
+        m_zeroCount(0),
+        m_count(0)
+    {
+        computeMapping();
+    }
+
+    /** Add a value to the sketch count times */
+    void add(double value, uint64_t count = 1)
+    {
+        if ( value > m_minIndexable ) { m_positive.add(getKey(value), count, m_maxBins); }
+        else if ( value < -m_minIndexable ) {
+            m_negative.add(getKey(-value), count, m_maxBins);
+        }
+        else {
+            m_zeroCount += count;
+        }
+        m_count += count;
+    }
+
+    /** Return the estimated value at quantile q (0 <= q <= 1).  Returns
+     * 0 if the sketch is empty. */
+    double getQuantile(double q) const
+    {
+        if ( 0 == m_count ) return 0.0;
+        if ( q < 0.0 ) q = 0.0;
+        if ( q > 1.0 ) q = 1.0;
+
+        double   rank = q * (m_count - 1);
+        uint64_t seen = 0;
+
+        // Negative values, from the largest magnitude down
+        for ( size_t i = m_negative.bins.size(); i-- > 0; ) {
+            seen += m_negative.bins[i];
+            if ( seen > rank ) return -getValue(m_negative.offset + (int32_t)i);
+        }
+
+        seen += m_zeroCount;
+        if ( seen > rank ) return 0.0;
+
+        for ( size_t i = 0; i < m_positive.bins.size(); i++ ) {
+            seen += m_positive.bins[i];
+            if ( seen > rank ) return getValue(m_positive.offset + (int32_t)i);
+        }
+        return getValue(m_positive.offset + (int32_t)m_positive.bins.size() - 1);
+    }
+
+    /** Merge another sketch into this one.
+     * @return false if the sketches were created with different accuracies
+     * and could not be merged
+     */
+    bool merge(const QuantileSketch& other)
+    {
+        if ( other.m_relativeAccuracy != m_relativeAccuracy ) return false;
+
+        for ( size_t i = 0; i < other.m_positive.bins.size(); i++ ) {
+            if ( other.m_positive.bins[i] )
+                m_positive.add(other.m_positive.offset + (int32_t)i, other.m_positive.bins[i], m_maxBins);
+        }
+        for ( size_t i = 0; i < other.m_negative.bins.size(); i++ ) {
+            if ( other.m_negative.bins[i] )
+                m_negative.add(other.m_negative.offset + (int32_t)i, other.m_negative.bins[i], m_maxBins);
+        }
+        m_zeroCount += other.m_zeroCount;
+        m_count += other.m_count;
+        return true;
+    }
+
+    /** Remove all values from the sketch */
+    void clear()
+    {
+        m_positive.bins.clear();
+        m_negative.bins.clear();
+        m_zeroCount = 0;
+        m_count     = 0;
+    }
+
+    /** Return the number of values added to the sketch */
+    uint64_t getCount() const { return m_count; }
+
+    /** Return the relative accuracy of the sketch */
+    double getRelativeAccuracy() const { return m_relativeAccuracy; }
+
+    /** Return the maximum number of buckets per store */
+    uint32_t getMaxBins() const { return m_maxBins; }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& m_relativeAccuracy;
+        ser& m_maxBins;
+        ser& m_zeroCount;
+        ser& m_count;
+        ser& m_positive.offset;
+        ser& m_positive.bins;
+        ser& m_negative.offset;
+        ser& m_negative.bins;
+        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) computeMapping();
+    }
+
+    ImplementSerializable(SST::Statistics::QuantileSketch)
+
+private:
+    /** Contiguous bucket counts for keys [offset, offset + bins.size()) */
+    struct Store
+    {
+        std::vector<uint64_t> bins;
+        int32_t               offset = 0;
+
+        void add(int32_t key, uint64_t count, uint32_t maxBins)
+        {
+            if ( bins.empty() ) {
+                bins.assign(1, count);
+                offset = key;
+                return;
+            }
+
+            int32_t size = (int32_t)bins.size();
+            if ( key >= offset + size ) {
+                // Grow upward, collapsing the lowest buckets if the
+                // span would exceed maxBins
+                int32_t span = key - offset + 1;
+                if ( span > (int32_t)maxBins ) {
+                    int32_t  shift     = span - (int32_t)maxBins;
+                    uint64_t collapsed = 0;
+                    for ( int32_t i = 0; i < std::min(shift, size); i++ ) {
+                        collapsed += bins[i];
+                    }
+                    if ( shift < size ) {
+                        bins.erase(bins.begin(), bins.begin() + shift);
+                        bins[0] += collapsed;
+                    }
+                    else {
+                        bins.assign(1, collapsed);
+                    }
+                    offset += shift;
+                }
+                bins.resize(key - offset + 1, 0);
+            }
+            else if ( key < offset ) {
+                int32_t top = offset + size - 1;
+                if ( top - key + 1 > (int32_t)maxBins ) {
+                    // Below the collapsed range, goes in the lowest bucket
+                    int32_t low = top - (int32_t)maxBins + 1;
+                    bins.insert(bins.begin(), offset - low, 0);
+                    offset = low;
+                    bins[0] += count;
+                    return;
+                }
+                // Grow downward with some slack so repeated extension is
+                // amortized constant time
+                int32_t grow = std::min(std::max(offset - key, size), (int32_t)maxBins - size);
+                bins.insert(bins.begin(), grow, 0);
+                offset -= grow;
+            }
+            bins[key - offset] += count;
+        }
+    };
+
+    void computeMapping()
+    {
+        double gamma   = (1.0 + m_relativeAccuracy) / (1.0 - m_relativeAccuracy);
+        m_gamma        = gamma;
+        m_invLogGamma  = 1.0 / std::log(gamma);
+        m_minIndexable = std::numeric_limits<double>::min() * gamma;
+    }
+
+    int32_t getKey(double value) const { return (int32_t)std::ceil(std::log(value) * m_invLogGamma); }
+
+    double getValue(int32_t key) const { return 2.0 * std::pow(m_gamma, key) / (m_gamma + 1.0); }
+
+    double   m_relativeAccuracy;
+    uint32_t m_maxBins;
+    double   m_gamma;
+    double   m_invLogGamma;
+    double   m_minIndexable;
+    Store    m_positive;
+    Store    m_negative;
+    uint64_t m_zeroCount;
+    uint64_t m_count;
+};
+
+/**
+    \class QuantileStatisticBase
+
+    The part of QuantileStatistic that does not depend on the type of
+    the values, so that statistic outputs can merge the sketches of
+    statistics from different components, threads and ranks.
+*/
+class QuantileStatisticBase
+{
+public:
+    virtual ~QuantileStatisticBase() {}
+
+    /** Return the sketch holding the distribution */
+    virtual const QuantileSketch& getSketch() const = 0;
+
+    /** Return the quantiles that are output */
+    virtual const std::vector<double>& getQuantiles() const = 0;
+
+    /** Return the name of the output field for quantile q, e.g. p99.9 for 0.999 */
+    static std::string getQuantileFieldName(double q)
+    {
+        std::stringstream ss;
+        ss << "p" << q * 100.0;
+        return ss.str();
+    }
+};
+
+/**
+    \class QuantileStatistic
+
+    Tracks the distribution of a quantity in a fixed amount of memory
+    and reports configurable quantiles (e.g. p50, p99, p99.9) with a
+    bounded relative error, without choosing bins up front.  Adding a
+    value costs a logarithm and an array increment.
+
+    @tparam T A template for the basic numerical type of values
+*/
+template <typename T>
+class QuantileStatistic : public Statistic<T>, public QuantileStatisticBase
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        QuantileStatistic,
+        "sst",
+        "QuantileStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Track quantiles of statistic using a fixed-memory sketch",
+        "SST::Statistic<T>")
+
+    QuantileStatistic(
+        BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
+        Statistic<T>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("accuracy");
+        allowedKeySet.insert("maxbins");
+        allowedKeySet.insert("quantiles");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        // Process the Parameters
+        double   accuracy = statParams.find<double>("accuracy", 0.01);
+        uint32_t maxBins  = statParams.find<uint32_t>("maxbins", 2048);
+        if ( accuracy <= 0.0 || accuracy >= 1.0 ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "QuantileStatistic %s: accuracy must be between 0 and 1, got %f\n", statName.c_str(),
+                accuracy);
+        }
+        if ( 0 == maxBins ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "QuantileStatistic %s: maxbins must be greater than 0\n", statName.c_str());
+        }
+        m_sketch = QuantileSketch(accuracy, maxBins);
+
+        if ( statParams.contains("quantiles") ) { statParams.find_array<double>("quantiles", m_quantiles); }
+        else {
+            m_quantiles = { 0.5, 0.9, 0.99, 0.999 };
+        }
+        for ( auto q : m_quantiles ) {
+            if ( q < 0.0 || q > 1.0 ) {
+                Output::getDefaultObject().fatal(
+                    CALL_INFO, 1, "QuantileStatistic %s: quantiles must be between 0 and 1, got %f\n",
+                    statName.c_str(), q);
+            }
+        }
+
+        m_sum = 0;
+        m_min = std::numeric_limits<T>::max();
+        m_max = std::numeric_limits<T>::lowest();
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("Quantile");
+    }
+
+    ~QuantileStatistic() {}
+
+protected:
+    /**
+        Present a new value to the class to be included in the statistics.
+        @param value New value to be presented
+    */
+    void addData_impl(T value) override { addData_impl_Ntimes(1, value); }
+
+    void addData_impl_Ntimes(uint64_t N, T value) override
+    {
+        m_sketch.add((double)value, N);
+        m_sum += N * value;
+        m_min = (value < m_min) ? value : m_min;
+        m_max = (value > m_max) ? value : m_max;
+    }
+
+public:
+    /**
+        Get the estimated value at a quantile
+        @param q Quantile to look up (0 <= q <= 1)
+        @return The estimated value
+    */
+    double getQuantile(double q) const { return m_sketch.getQuantile(q); }
+
+    /** Return the sketch holding the distribution, e.g. to merge it with another */
+    const QuantileSketch& getSketch() const override { return m_sketch; }
+
+    /** Return the quantiles that are output */
+    const std::vector<double>& getQuantiles() const override { return m_quantiles; }
+
+    /** Merge the values of a sketch (with the same accuracy) into this statistic
+     * @return false if the sketch could not be merged
+     */
+    bool merge(const QuantileSketch& sketch)
+    {
+        if ( !m_sketch.merge(sketch) ) return false;
+        this->setCollectionCount(this->getCollectionCount() + sketch.getCount());
+        return true;
+    }
+
+    void clearStatisticData() override
+    {
+        m_sketch.clear();
+        m_sum = 0;
+        m_min = std::numeric_limits<T>::max();
+        m_max = std::numeric_limits<T>::lowest();
+        this->setCollectionCount(0);
+    }
+
+    void registerOutputFields(StatisticFieldsOutput* statOutput) override
+    {
+        h_count = statOutput->registerField<uint64_t>("Count");
+        h_sum   = statOutput->registerField<T>("Sum");
+        h_min   = statOutput->registerField<T>("Min");
+        h_max   = statOutput->registerField<T>("Max");
+        for ( auto q : m_quantiles ) {
+            h_quantiles.push_back(statOutput->registerField<double>(getQuantileFieldName(q).c_str()));
+        }
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        uint64_t count = this->getCollectionCount();
+        statOutput->outputField(h_count, count);
+        statOutput->outputField(h_sum, m_sum);
+        statOutput->outputField(h_min, count ? m_min : 0);
+        statOutput->outputField(h_max, count ? m_max : 0);
+        for ( size_t i = 0; i < m_quantiles.size(); i++ ) {
+            statOutput->outputField(h_quantiles[i], m_sketch.getQuantile(m_quantiles[i]));
+        }
+    }
+
+    bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
+    {
+        switch ( mode ) {
+        case StatisticBase::STAT_MODE_COUNT:
+        case StatisticBase::STAT_MODE_PERIODIC:
+        case StatisticBase::STAT_MODE_DUMP_AT_END:
+            return true;
+        default:
+            return false;
+        }
+        return false;
+    }
+
+private:
+    QuantileSketch      m_sketch;
+    std::vector<double> m_quantiles;
+    T                   m_sum;
+    T                   m_min;
+    T                   m_max;
+
+    StatisticOutput::fieldHandle_t              h_count;
+    StatisticOutput::fieldHandle_t              h_sum;
+    StatisticOutput::fieldHandle_t              h_min;
+    StatisticOutput::fieldHandle_t              h_max;
+    std::vector<StatisticOutput::fieldHandle_t> h_quantiles;
+};
+
+} // namespace Statistics
+} // namespace SST
+
+#endif // SST_CORE_STATAPI_STATQUANTILE_H
@@ -12,24 +12,203 @@
 #ifndef SST_CORE_STATAPI_STATUNIQUECOUNT_H
 #define SST_CORE_STATAPI_STATUNIQUECOUNT_H
 
+#include "sst/core/output.h"
+#include "sst/core/serialization/serializable.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/statapi/statbase.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <set>
+#include <type_traits>
+#include <vector>
+
 namespace SST {
 class BaseComponent;
 namespace Statistics {
 
+/**
+    \class HyperLogLog
+
+    Fixed-memory estimator of the number of distinct values added to it.
+    A value's hash selects one of 2^precision registers, which keeps the
+    longest run of leading zeros seen in the remaining hash bits.  The
+    relative standard error of the estimate is about
+    1.04 / sqrt(2^precision).
+
+    Two estimators with the same precision merge exactly by taking the
+    per-register maximum, so counts from different components, threads
+    or ranks (the class is serializable) can be combined into a global
+    count.
+*/
+class HyperLogLog : public SST::Core::Serialization::serializable
+{
+public:
+    static constexpr uint32_t minPrecision = 4;
+    static constexpr uint32_t maxPrecision = 18;
+
+    /** Create an estimator
+     * @param precision - Number of index bits; uses 2^precision one byte registers
+     */
+    HyperLogLog(uint32_t precision = 14) : m_precision(precision), m_registers((size_t)1 << precision, 0) {}
+
+    /** Add a value to the estimator */
+    template <typename T>
+    void add(T value)
+    {
+        addHash(hash(value));
+    }
+
+    /** Add a 64-bit hash to the estimator */
+    void addHash(uint64_t hash)
+    {
+        uint64_t index = hash >> (64 - m_precision);
+        uint64_t rest  = hash << m_precision;
+        uint8_t  rank  = rest ? __builtin_clzll(rest) + 1 : 64 - m_precision + 1;
+        if ( rank > m_registers[index] ) m_registers[index] = rank;
+    }
+
+    /** Return the estimated number of distinct values */
+    uint64_t getEstimate() const
+    {
+        double   m     = (double)m_registers.size();
+        double   sum   = 0.0;
+        uint64_t zeros = 0;
+        for ( auto reg : m_registers ) {
+            sum += std::ldexp(1.0, -reg);
+            if ( 0 == reg ) zeros++;
+        }
+
+        double alpha;
+        switch ( m_registers.size() ) {
+        case 16:
+            alpha = 0.673;
+            break;
+        case 32:
+            alpha = 0.697;
+            break;
+        case 64:
+            alpha = 0.709;
+            break;
+        default:
+            alpha = 0.7213 / (1.0 + 1.079 / m);
+            break;
+        }
+
+        double estimate = alpha * m * m / sum;
+        // Small range correction (linear counting).  With a 64-bit hash
+        // no large range correction is needed.
+        if ( estimate <= 2.5 * m && zeros > 0 ) estimate = m * std::log(m / (double)zeros);
+        return (uint64_t)std::llround(estimate);
+    }
+
+    /** Merge another estimator into this one.
+     * @return false if the estimators have different precisions and
+     * could not be merged
+     */
+    bool merge(const HyperLogLog& other)
+    {
+        if ( other.m_precision != m_precision ) return false;
+        for ( size_t i = 0; i < m_registers.size(); i++ ) {
+            if ( other.m_registers[i] > m_registers[i] ) m_registers[i] = other.m_registers[i];
+        }
+        return true;
+    }
+
+    /** Reset the estimator to empty */
+    void clear() { std::fill(m_registers.begin(), m_registers.end(), 0); }
+
+    /** Return the precision (number of index bits) */
+    uint32_t getPrecision() const { return m_precision; }
+
+    /** Hash a value of any arithmetic type to 64 bits */
+    template <typename T>
+    static uint64_t hash(T value)
+    {
+        return hashBits(getValueBits(value));
+    }
+
+    /** Return the bits of a value, zero extended to 64 bits.  Values
+     * that compare equal have the same bits, so hashBits(getValueBits(v))
+     * is the same as hash(v). */
+    template <typename T>
+    static uint64_t getValueBits(T value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "HyperLogLog only supports arithmetic types");
+        // Normalize -0.0 so that it counts as the same value as 0.0
+        if constexpr ( std::is_floating_point<T>::value ) {
+            if ( value == 0 ) value = 0;
+        }
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(T));
+        return bits;
+    }
+
+    /** Hash the bits returned by getValueBits() to 64 bits */
+    static uint64_t hashBits(uint64_t bits)
+    {
+        // splitmix64 finalizer
+        bits = (bits ^ (bits >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        bits = (bits ^ (bits >> 27)) * 0x94d049bb133111ebULL;
+        return bits ^ (bits >> 31);
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& m_precision;
+        ser& m_registers;
+    }
+
+    ImplementSerializable(SST::Statistics::HyperLogLog)
+
+private:
+    uint32_t             m_precision;
+    std::vector<uint8_t> m_registers;
+};
+
+/**
+    \class UniqueCountStatisticBase
+
+    Type independent access to the state of a UniqueCountStatistic, so
+    that statistic outputs can merge the unique values (or estimators)
+    of several statistics instead of adding up their counts.
+*/
+class UniqueCountStatisticBase
+{
+public:
+    virtual ~UniqueCountStatisticBase() {}
+
+    /** Return true if the count is estimated with a HyperLogLog */
+    virtual bool isApproximate() const = 0;
+
+    /** Return the HyperLogLog estimator.  Only meaningful in hyperloglog mode. */
+    virtual const HyperLogLog& getHyperLogLog() const = 0;
+
+    /** Insert the bits (see HyperLogLog::getValueBits()) of every
+     * unique value into bits.  Only meaningful in exact mode. */
+    virtual void getUniqueValueBits(std::set<uint64_t>& bits) const = 0;
+
+    /** Name of the field holding the unique count */
+    static constexpr const char* uniqueItemsFieldName = "UniqueItems";
+};
+
 /**
     \class UniqueCountStatistic
 
     Creates a Statistic which counts unique values provided to it.
 
+    By default every distinct value is kept in a set and the count is
+    exact.  With mode = "hyperloglog" the count is estimated in fixed
+    memory (2^precision bytes) with constant time insertion; see
+    HyperLogLog.
+
     @tparam T A template for holding the main data type of this statistic
 */
 
 template <typename T>
-class UniqueCountStatistic : public Statistic<T>
+class UniqueCountStatistic : public Statistic<T>, public UniqueCountStatisticBase
 {
 public:
     SST_ELI_DECLARE_STATISTIC_TEMPLATE(
@@ -44,10 +223,57 @@ public:
         BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams) :
         Statistic<T>(comp, statName, statSubId, statParams)
     {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("mode");
+        allowedKeySet.insert("precision");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        // Process the Parameters
+        std::string mode      = statParams.find<std::string>("mode", "exact");
+        uint32_t    precision = statParams.find<uint32_t>("precision", 14);
+        if ( mode == "hyperloglog" ) { m_useHLL = true; }
+        else if ( mode == "exact" ) {
+            m_useHLL = false;
+        }
+        else {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "UniqueCountStatistic %s: mode must be exact or hyperloglog, got %s\n",
+                statName.c_str(), mode.c_str());
+        }
+        if ( precision < HyperLogLog::minPrecision || precision > HyperLogLog::maxPrecision ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "UniqueCountStatistic %s: precision must be between %" PRIu32 " and %" PRIu32 "\n",
+                statName.c_str(), HyperLogLog::minPrecision, HyperLogLog::maxPrecision);
+        }
+        if ( m_useHLL ) m_hll = HyperLogLog(precision);
+
         // Set the Name of this Statistic
         this->setStatisticTypeName("UniqueCount");
     }
 
+    /** Return the number of unique values (an estimate in hyperloglog mode) */
+    uint64_t getUniqueCount() const { return m_useHLL ? m_hll.getEstimate() : uniqueSet.size(); }
+
+    /** Return true if the count is estimated with a HyperLogLog */
+    bool isApproximate() const override { return m_useHLL; }
+
+    /** Return the HyperLogLog estimator, e.g. to merge it with another.
+     * Only meaningful in hyperloglog mode. */
+    const HyperLogLog& getHyperLogLog() const override { return m_hll; }
+
+    void getUniqueValueBits(std::set<uint64_t>& bits) const override
+    {
+        for ( auto& value : uniqueSet ) {
+            bits.insert(HyperLogLog::getValueBits(value));
+        }
+    }
+
+    /** Merge an estimator (with the same precision) into this statistic.
+     * @return false if not in hyperloglog mode or the estimator could not be merged
+     */
+    bool merge(const HyperLogLog& hll) { return m_useHLL && m_hll.merge(hll); }
+
     ~UniqueCountStatistic() {};
 
 protected:
@@ -55,23 +281,35 @@ protected:
     Present a new value to the Statistic to be included in the unique set
         @param data New data item to be included in the unique set
     */
-    void addData_impl(T data) override { uniqueSet.insert(data); }
+    void addData_impl(T data) override
+    {
+        if ( m_useHLL ) { m_hll.add(data); }
+        else {
+            uniqueSet.insert(data);
+        }
+    }
 
 private:
-    void clearStatisticData() override { uniqueSet.clear(); }
+    void clearStatisticData() override
+    {
+        uniqueSet.clear();
+        m_hll.clear();
+    }
 
     void registerOutputFields(StatisticFieldsOutput* statOutput) override
     {
-        uniqueCountField = statOutput->registerField<uint64_t>("UniqueItems");
+        uniqueCountField = statOutput->registerField<uint64_t>(uniqueItemsFieldName);
     }
 
     void outputStatisticFields(StatisticFieldsOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
     {
-        statOutput->outputField(uniqueCountField, (uint64_t)uniqueSet.size());
+        statOutput->outputField(uniqueCountField, getUniqueCount());
     }
 
 private:
     std::set<T>                    uniqueSet;
+    HyperLogLog                    m_hll { HyperLogLog::minPrecision };
+    bool                           m_useHLL;
     StatisticOutput::fieldHandle_t uniqueCountField;
 };
 
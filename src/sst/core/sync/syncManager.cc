@@ -17,6 +17,7 @@
 #include "sst/core/objectComms.h"
 #include "sst/core/profile/syncProfileTool.h"
 #include "sst/core/simulation_impl.h"
+#include "sst/core/statapi/statengine.h"
 #include "sst/core/sync/rankSyncParallelSkip.h"
 #include "sst/core/sync/rankSyncSerialSkip.h"
 #include "sst/core/sync/threadSyncDirectSkip.h"
@@ -355,7 +356,14 @@ SyncManager::execute(void)
 
         RankExecBarrier[3].wait();
 
-        if ( exit != nullptr && rank.thread == 0 ) exit->check();
+        // Every rank is here, so stat outputs can reduce across ranks.
+        // Whether any of them has work to do rides along with the exit
+        // check.
+        if ( rank.thread == 0 ) {
+            SimTime_t now     = sim->getCurrentSimCycle();
+            int       pending = Statistics::StatisticProcessingEngine::stat_outputs_need_synchronize(now);
+            if ( exit->check(pending) > 0 ) Statistics::StatisticProcessingEngine::stat_outputs_synchronize(now);
+        }
 
         RankExecBarrier[4].wait();
 
@@ -366,6 +374,12 @@ SyncManager::execute(void)
 
         threadSync->execute();
 
+        // With one rank, a thread sync is the only point where every
+        // thread is known to have finished the earlier times
+        if ( num_ranks.rank == 1 && rank.thread == 0 &&
+             Statistics::StatisticProcessingEngine::stat_outputs_need_synchronize(sim->getCurrentSimCycle()) )
+            Statistics::StatisticProcessingEngine::stat_outputs_synchronize(sim->getCurrentSimCycle());
+
         if ( /*num_ranks.rank == 1*/ min_part == MAX_SIMTIME_T ) {
             if ( exit->getRefCount() == 0 ) { endSimulation(exit->getEndTime()); }
         }
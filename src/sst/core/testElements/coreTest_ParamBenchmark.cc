@@ -0,0 +1,88 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_ParamBenchmark.h"
+
+#include "sst/core/unitAlgebra.h"
+
+#include <chrono>
+#include <cinttypes>
+
+namespace SST {
+namespace CoreTestParamBenchmark {
+
+ParamBenchmarkSubComp::ParamBenchmarkSubComp(ComponentId_t id, Params& params) : ParamBenchmarkSubCompAPI(id)
+{
+    int64_t     int_value;
+    uint64_t    uint_value;
+    double      double_value;
+    bool        bool_value;
+    std::string string_value;
+    UnitAlgebra clock;
+
+    if ( params.find<bool>("use_keys", false) ) {
+        static const Params::Key int_key("int_param");
+        static const Params::Key uint_key("uint_param");
+        static const Params::Key double_key("double_param");
+        static const Params::Key bool_key("bool_param");
+        static const Params::Key string_key("string_param");
+        static const Params::Key clock_key("clock");
+
+        int_value    = params.find<int64_t>(int_key, -1);
+        uint_value   = params.find<uint64_t>(uint_key, 1);
+        double_value = params.find<double>(double_key, 1.0);
+        bool_value   = params.find<bool>(bool_key, false);
+        string_value = params.find<std::string>(string_key, "");
+        clock        = params.find<UnitAlgebra>(clock_key, "1GHz");
+    }
+    else {
+        int_value    = params.find<int64_t>("int_param", -1);
+        uint_value   = params.find<uint64_t>("uint_param", 1);
+        double_value = params.find<double>("double_param", 1.0);
+        bool_value   = params.find<bool>("bool_param", false);
+        string_value = params.find<std::string>("string_param", "");
+        clock        = params.find<UnitAlgebra>("clock", "1GHz");
+    }
+
+    checksum = (uint64_t)int_value + uint_value + (uint64_t)(double_value * 1000.0) + (bool_value ? 1 : 0) +
+               string_value.size() + clock.getRoundedValue();
+}
+
+coreTestParamBenchmarkComponent::coreTestParamBenchmarkComponent(ComponentId_t id, Params& params) : Component(id)
+{
+    Output&  out        = getSimulationOutput();
+    int      count      = params.find<int>("count", 1000);
+    bool     print_rate = params.find<bool>("print_rate", false);
+    uint64_t checksum   = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( int i = 0; i < count; ++i ) {
+        ParamBenchmarkSubCompAPI* sub = loadAnonymousSubComponent<ParamBenchmarkSubCompAPI>(
+            "coreTestElement.ParamBenchmarkSubComp", "subcomp", i, ComponentInfo::SHARE_NONE, params);
+        checksum += sub->getChecksum();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    out.output(
+        "Component %s: constructed %d subcomponents, checksum = %" PRIu64 "\n", getName().c_str(), count, checksum);
+    if ( print_rate ) {
+        out.output(
+            "Component %s: %.0f subcomponents per second (%s keys)\n", getName().c_str(), count / elapsed.count(),
+            params.find<bool>("use_keys", false) ? "handle" : "string");
+    }
+}
+
+coreTestParamBenchmarkComponent::coreTestParamBenchmarkComponent() : Component(-1) {}
+
+} // namespace CoreTestParamBenchmark
+} // namespace SST
@@ -0,0 +1,117 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_PARAMBENCHMARK_H
+#define SST_CORE_CORETEST_PARAMBENCHMARK_H
+
+#include "sst/core/component.h"
+#include "sst/core/subcomponent.h"
+
+namespace SST {
+namespace CoreTestParamBenchmark {
+
+/*
+  Measures construction throughput of subcomponents that read their
+  configuration from Params.  The component loads a number of
+  anonymous subcomponents, all from the same Params object, and each
+  subcomponent looks up its parameters either by name or through
+  Params::Key handles.  Both modes must produce the same checksum.
+ */
+
+class ParamBenchmarkSubCompAPI : public SST::SubComponent
+{
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_API(SST::CoreTestParamBenchmark::ParamBenchmarkSubCompAPI)
+
+    ParamBenchmarkSubCompAPI(ComponentId_t id) : SubComponent(id) {}
+    virtual ~ParamBenchmarkSubCompAPI() {}
+
+    // Combines the values of all the parameters that were read
+    virtual uint64_t getChecksum() = 0;
+};
+
+class ParamBenchmarkSubComp : public ParamBenchmarkSubCompAPI
+{
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        ParamBenchmarkSubComp,
+        "coreTestElement",
+        "ParamBenchmarkSubComp",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Subcomponent that reads a fixed set of parameters on construction",
+        SST::CoreTestParamBenchmark::ParamBenchmarkSubCompAPI
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "use_keys",     "Look up parameters through Params::Key handles instead of by name", "false" },
+        { "int_param",    "Integer parameter", "-1" },
+        { "uint_param",   "Unsigned integer parameter", "1" },
+        { "double_param", "Floating point parameter", "1.0" },
+        { "bool_param",   "Boolean parameter", "false" },
+        { "string_param", "String parameter", "" },
+        { "clock",        "Frequency parameter", "1GHz" }
+    )
+
+    ParamBenchmarkSubComp(ComponentId_t id, Params& params);
+    ~ParamBenchmarkSubComp() {}
+
+    uint64_t getChecksum() override { return checksum; }
+
+private:
+    uint64_t checksum;
+};
+
+class coreTestParamBenchmarkComponent : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestParamBenchmarkComponent,
+        "coreTestElement",
+        "coreTestParamBenchmarkComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Params lookup and subcomponent construction benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "count",      "Number of subcomponents to construct", "1000" },
+        { "print_rate", "Print the measured construction rate", "false" },
+        { "use_keys",   "Passed to the subcomponents", "false" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        { "subcomp", "Slot for the benchmarked subcomponents", "SST::CoreTestParamBenchmark::ParamBenchmarkSubCompAPI" }
+    )
+
+    coreTestParamBenchmarkComponent(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestParamBenchmarkComponent() {}
+    void setup() {}
+    void finish() {}
+
+private:
+    coreTestParamBenchmarkComponent();                                       // for serialization only
+    coreTestParamBenchmarkComponent(const coreTestParamBenchmarkComponent&); // do not implement
+    void operator=(const coreTestParamBenchmarkComponent&);                  // do not implement
+};
+
+} // namespace CoreTestParamBenchmark
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_PARAMBENCHMARK_H
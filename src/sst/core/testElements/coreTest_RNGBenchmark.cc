@@ -0,0 +1,139 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_RNGBenchmark.h"
+
+#include "sst/core/rng/discrete.h"
+#include "sst/core/rng/expon.h"
+#include "sst/core/rng/gaussian.h"
+#include "sst/core/rng/marsaglia.h"
+#include "sst/core/rng/mersenne.h"
+#include "sst/core/rng/philox.h"
+#include "sst/core/rng/poisson.h"
+#include "sst/core/rng/xorshift.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <vector>
+
+using namespace SST::RNG;
+
+namespace SST {
+namespace CoreTestRNGBenchmark {
+
+coreTestRNGBenchmarkComponent::coreTestRNGBenchmarkComponent(ComponentId_t id, Params& params) : Component(id)
+{
+    Output&             out        = getSimulationOutput();
+    std::string         rng_type   = params.find<std::string>("rng", "philox");
+    std::string         distrib    = params.find<std::string>("distrib", "none");
+    uint64_t            count      = params.find<uint64_t>("count", 1000000);
+    size_t              batch      = params.find<size_t>("batch", 1);
+    uint32_t            seed       = params.find<uint32_t>("seed", 1447);
+    bool                print_rate = params.find<bool>("print_rate", false);
+    double              probs[4]   = { 0.1, 0.2, 0.3, 0.4 };
+    Random*             rng        = nullptr;
+    RandomDistribution* dist       = nullptr;
+
+    if ( batch == 0 ) { out.fatal(CALL_INFO, 1, "Component %s: batch must be at least 1\n", getName().c_str()); }
+
+    if ( rng_type == "mersenne" ) { rng = new MersenneRNG(seed); }
+    else if ( rng_type == "marsaglia" ) {
+        rng = new MarsagliaRNG(seed, seed + 1);
+    }
+    else if ( rng_type == "xorshift" ) {
+        rng = new XORShiftRNG(seed);
+    }
+    else if ( rng_type == "philox" ) {
+        rng = new PhiloxRNG(seed);
+    }
+    else {
+        out.fatal(CALL_INFO, 1, "Component %s: unknown rng %s\n", getName().c_str(), rng_type.c_str());
+    }
+
+    if ( distrib == "gaussian" ) { dist = new GaussianDistribution(0.0, 1.0, rng); }
+    else if ( distrib == "expon" ) {
+        dist = new ExponentialDistribution(1.0, rng);
+    }
+    else if ( distrib == "discrete" ) {
+        dist = new DiscreteDistribution(probs, 4, rng);
+    }
+    else if ( distrib == "poisson" ) {
+        dist = new PoissonDistribution(4.0, rng);
+    }
+    else if ( distrib != "none" && distrib != "uniform" ) {
+        out.fatal(CALL_INFO, 1, "Component %s: unknown distrib %s\n", getName().c_str(), distrib.c_str());
+    }
+
+    const bool            integers = distrib == "none";
+    const bool            uniform  = distrib == "uniform";
+    std::vector<uint64_t> ints(integers ? batch : 0);
+    std::vector<double>   values(integers ? 0 : batch);
+    uint64_t              checksum = 0;
+    double                sum      = 0.0;
+    double                sum_sq   = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t drawn = 0; drawn < count; ) {
+        const size_t n = count - drawn < batch ? count - drawn : batch;
+
+        if ( integers ) {
+            if ( batch == 1 ) { ints[0] = rng->generateNextUInt64(); }
+            else {
+                rng->fillUInt64(ints.data(), n);
+            }
+            for ( size_t i = 0; i < n; i++ ) {
+                checksum += ints[i];
+            }
+        }
+        else {
+            if ( batch == 1 ) { values[0] = uniform ? rng->nextUniform() : dist->getNextDouble(); }
+            else if ( uniform ) {
+                rng->fillUniform(values.data(), n);
+            }
+            else {
+                dist->fill(values.data(), n);
+            }
+            for ( size_t i = 0; i < n; i++ ) {
+                sum += values[i];
+                sum_sq += values[i] * values[i];
+            }
+        }
+        drawn += n;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if ( integers ) {
+        out.output(
+            "Component %s: drew %" PRIu64 " values, checksum = %" PRIu64 "\n", getName().c_str(), count, checksum);
+    }
+    else {
+        const double mean = sum / count;
+        out.output(
+            "Component %s: drew %" PRIu64 " values, mean = %.2f, stddev = %.2f\n", getName().c_str(), count, mean,
+            std::sqrt(sum_sq / count - mean * mean));
+    }
+    if ( print_rate ) {
+        out.output(
+            "Component %s: %.0f values per second (%s rng, %s distribution, batch %zu)\n", getName().c_str(),
+            count / elapsed.count(), rng_type.c_str(), distrib.c_str(), batch);
+    }
+
+    delete dist;
+    delete rng;
+}
+
+coreTestRNGBenchmarkComponent::coreTestRNGBenchmarkComponent() : Component(-1) {}
+
+} // namespace CoreTestRNGBenchmark
+} // namespace SST
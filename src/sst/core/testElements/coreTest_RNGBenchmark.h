@@ -0,0 +1,78 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_RNGBENCHMARK_H
+#define SST_CORE_CORETEST_RNGBENCHMARK_H
+
+#include "sst/core/component.h"
+
+namespace SST {
+namespace CoreTestRNGBenchmark {
+
+/*
+  Measures the throughput of the random number generators and
+  distributions, drawing values either one call at a time or in
+  batches through the fill functions.  Without a distribution the
+  component draws 64-bit integers and prints their checksum, which
+  must be the same for every batch size.  With a distribution, or
+  uniform doubles straight from the generator, it prints the mean and
+  standard deviation of the values.
+ */
+
+class coreTestRNGBenchmarkComponent : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestRNGBenchmarkComponent,
+        "coreTestElement",
+        "coreTestRNGBenchmarkComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Random number generator and distribution benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "rng",        "Random number generator: mersenne, marsaglia, xorshift or philox", "philox" },
+        { "distrib",    "Distribution to sample: none, uniform, gaussian, expon, discrete or poisson", "none" },
+        { "count",      "Number of values to draw", "1000000" },
+        { "batch",      "Number of values drawn per call.  1 draws each value with its own call", "1" },
+        { "seed",       "The seed for the random number generator", "1447" },
+        { "print_rate", "Print the measured rate of values drawn", "false" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestRNGBenchmarkComponent(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestRNGBenchmarkComponent() {}
+    void setup() {}
+    void finish() {}
+
+private:
+    coreTestRNGBenchmarkComponent();                                     // for serialization only
+    coreTestRNGBenchmarkComponent(const coreTestRNGBenchmarkComponent&); // do not implement
+    void operator=(const coreTestRNGBenchmarkComponent&);                // do not implement
+};
+
+} // namespace CoreTestRNGBenchmark
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_RNGBENCHMARK_H
@@ -13,11 +13,19 @@
 
 #include "sst/core/testElements/coreTest_RNGComponent.h"
 
+#include "sst/core/rng/discrete.h"
+#include "sst/core/rng/expon.h"
+#include "sst/core/rng/gaussian.h"
 #include "sst/core/rng/marsaglia.h"
 #include "sst/core/rng/mersenne.h"
+#include "sst/core/rng/philox.h"
+#include "sst/core/rng/poisson.h"
+#include "sst/core/rng/uniform.h"
 #include "sst/core/rng/xorshift.h"
 
 #include <assert.h>
+#include <cmath>
+#include <vector>
 
 using namespace SST;
 using namespace SST::RNG;
@@ -33,53 +41,260 @@ coreTestRNGComponent::coreTestRNGComponent(ComponentId_t id, Params& params) : C
 
     std::string rngType = params.find<std::string>("rng", "mersenne");
 
+    if ( rngType == "philox" ) checkPhiloxKnownAnswers();
+    if ( params.find<bool>("check_fill", false) ) checkFills(rngType, params);
+
+    rng = createRNG(rngType, params, 1);
+
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    // set our clock
+    registerClock("1GHz", new Clock::Handler<coreTestRNGComponent>(this, &coreTestRNGComponent::tick));
+}
+
+coreTestRNGComponent::~coreTestRNGComponent()
+{
+    delete output;
+}
+
+coreTestRNGComponent::coreTestRNGComponent() : Component(-1)
+{
+    // for serialization only
+}
+
+/*
+    Builds the generator named by rngType from the seed parameters. The announcement of
+    which generator is used is printed at the given verbosity level.
+*/
+Random*
+coreTestRNGComponent::createRNG(const std::string& rngType, Params& params, uint32_t level)
+{
     if ( rngType == "mersenne" ) {
         const uint32_t seed = (uint32_t)params.find<int64_t>("seed", 1447);
 
-        output->verbose(CALL_INFO, 1, 0, "Using Mersenne Generator with seed: %" PRIu32 "\n", seed);
-        rng = new MersenneRNG(seed);
+        output->verbose(CALL_INFO, level, 0, "Using Mersenne Generator with seed: %" PRIu32 "\n", seed);
+        return new MersenneRNG(seed);
     }
     else if ( rngType == "marsaglia" ) {
         const uint32_t m_w = (uint32_t)params.find<int64_t>("seed_w", 0);
         const uint32_t m_z = (uint32_t)params.find<int64_t>("seed_z", 0);
 
         if ( m_w == 0 || m_z == 0 ) {
-            output->verbose(CALL_INFO, 1, 0, "Using Marsaglia Generator with no seeds...\n");
-            rng = new MarsagliaRNG();
+            output->verbose(CALL_INFO, level, 0, "Using Marsaglia Generator with no seeds...\n");
+            return new MarsagliaRNG();
         }
         else {
             output->verbose(
-                CALL_INFO, 1, 0, "Using Marsaglia Generator with seeds: Z=%" PRIu32 ", W=%" PRIu32 "\n", m_w, m_z);
-            rng = new MarsagliaRNG(m_z, m_w);
+                CALL_INFO, level, 0, "Using Marsaglia Generator with seeds: Z=%" PRIu32 ", W=%" PRIu32 "\n", m_w, m_z);
+            return new MarsagliaRNG(m_z, m_w);
         }
     }
     else if ( rngType == "xorshift" ) {
         uint32_t seed = (uint32_t)params.find<int64_t>("seed", 57);
-        output->verbose(CALL_INFO, 1, 0, "Using XORShift Generator with seed: %" PRIu32 "\n", seed);
-        rng = new XORShiftRNG(seed);
+        output->verbose(CALL_INFO, level, 0, "Using XORShift Generator with seed: %" PRIu32 "\n", seed);
+        return new XORShiftRNG(seed);
+    }
+    else if ( rngType == "philox" ) {
+        uint32_t seed   = params.find<uint32_t>("seed", 1447);
+        uint32_t stream = params.find<uint32_t>("stream", 0);
+        uint64_t skip   = params.find<uint64_t>("skip", 0);
+        output->verbose(
+            CALL_INFO, level, 0, "Using Philox Generator with seed: %" PRIu32 ", stream: %" PRIu32 "\n", seed, stream);
+        PhiloxRNG* philox = new PhiloxRNG(seed, getId(), stream);
+        philox->skip(skip);
+        return philox;
     }
     else {
         output->verbose(
-            CALL_INFO, 1, 0, "Generator: %s is unknown, using Mersenne with standard seed\n", rngType.c_str());
-        rng = new MersenneRNG(1447);
+            CALL_INFO, level, 0, "Generator: %s is unknown, using Mersenne with standard seed\n", rngType.c_str());
+        return new MersenneRNG(1447);
     }
+}
 
-    // tell the simulator not to end without us
-    registerAsPrimaryComponent();
-    primaryComponentDoNotEndSim();
+/*
+    Checks generateBlock() against the known answers published with the Philox4x32-10
+    reference implementation. The counter words are the low and high halves of the
+    block index, then the low and high halves of the component ID.
+*/
+void
+coreTestRNGComponent::checkPhiloxKnownAnswers()
+{
+    struct KnownAnswer
+    {
+        uint32_t ctr[4];
+        uint32_t key[2];
+        uint32_t out[4];
+    };
 
-    // set our clock
-    registerClock("1GHz", new Clock::Handler<coreTestRNGComponent>(this, &coreTestRNGComponent::tick));
+    const KnownAnswer answers[] = {
+        { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+          { 0x00000000, 0x00000000 },
+          { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 } },
+        { { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+          { 0xffffffff, 0xffffffff },
+          { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd } },
+        { { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 },
+          { 0xa4093822, 0x299f31d0 },
+          { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } },
+    };
+
+    for ( const auto& answer : answers ) {
+        const uint64_t index     = ((uint64_t)answer.ctr[1] << 32) | answer.ctr[0];
+        const uint64_t component = ((uint64_t)answer.ctr[3] << 32) | answer.ctr[2];
+        uint32_t       out[4];
+
+        PhiloxRNG::generateBlock(answer.key, component, index, out);
+        for ( int i = 0; i < 4; i++ ) {
+            if ( out[i] != answer.out[i] ) {
+                output->fatal(
+                    CALL_INFO, 1,
+                    "Philox known answer mismatch for counter %08" PRIx32 " %08" PRIx32 " %08" PRIx32 " %08" PRIx32
+                    ", word %d: %08" PRIx32 " != %08" PRIx32 "\n",
+                    answer.ctr[0], answer.ctr[1], answer.ctr[2], answer.ctr[3], i, out[i], answer.out[i]);
+            }
+        }
+    }
 }
 
-coreTestRNGComponent::~coreTestRNGComponent()
+// The fills are done in uneven pieces, so that they start and end inside the blocks of
+// the generators that produce several values at a time
+static const size_t fill_pieces[] = { 1, 3, 1000, 4096, 9 };
+static const size_t fill_count    = 5109;
+
+/*
+    Draws fill_count values one call at a time with scalar and in pieces with fill, and
+    fails if they differ.
+*/
+template <typename T, typename ScalarT, typename FillT>
+void
+coreTestRNGComponent::checkSame(const char* name, ScalarT scalar, FillT fill)
 {
-    delete output;
+    std::vector<T> expected(fill_count);
+    std::vector<T> actual(fill_count);
+
+    for ( auto& value : expected ) {
+        value = scalar();
+    }
+
+    size_t offset = 0;
+    for ( size_t piece : fill_pieces ) {
+        fill(actual.data() + offset, piece);
+        offset += piece;
+    }
+
+    for ( size_t i = 0; i < fill_count; i++ ) {
+        if ( expected[i] != actual[i] ) {
+            output->fatal(CALL_INFO, 1, "%s does not match the scalar calls at value %zu\n", name, i);
+        }
+    }
 }
 
-coreTestRNGComponent::coreTestRNGComponent() : Component(-1)
+/*
+    Checks the fill functions of the generator and of the distributions that promise the
+    same values as their scalar calls, each against a second generator with the same
+    seeds. The Gaussian fill draws different values, so only the share of its values in
+    the tails is checked.
+*/
+void
+coreTestRNGComponent::checkFills(const std::string& rngType, Params& params)
 {
-    // for serialization only
+    if ( rngType == "marsaglia" &&
+         (params.find<uint32_t>("seed_w", 0) == 0 || params.find<uint32_t>("seed_z", 0) == 0) ) {
+        output->fatal(CALL_INFO, 1, "check_fill needs seed_w and seed_z for the Marsaglia generator\n");
+    }
+
+    Random* scalar = nullptr;
+    Random* batch  = nullptr;
+    auto    reseed = [&]() {
+        delete scalar;
+        delete batch;
+        scalar = createRNG(rngType, params, 2);
+        batch  = createRNG(rngType, params, 2);
+    };
+
+    reseed();
+    checkSame<uint32_t>(
+        "fillUInt32", [&]() { return scalar->generateNextUInt32(); },
+        [&](uint32_t* out, size_t count) { batch->fillUInt32(out, count); });
+    reseed();
+    checkSame<uint64_t>(
+        "fillUInt64", [&]() { return scalar->generateNextUInt64(); },
+        [&](uint64_t* out, size_t count) { batch->fillUInt64(out, count); });
+    reseed();
+    checkSame<double>(
+        "fillUniform", [&]() { return scalar->nextUniform(); },
+        [&](double* out, size_t count) { batch->fillUniform(out, count); });
+
+    reseed();
+    {
+        ExponentialDistribution scalarDist(1.0, scalar);
+        ExponentialDistribution batchDist(1.0, batch);
+        checkSame<double>(
+            "ExponentialDistribution::fill", [&]() { return scalarDist.getNextDouble(); },
+            [&](double* out, size_t count) { batchDist.fill(out, count); });
+    }
+
+    reseed();
+    {
+        const double         probs[4] = { 0.1, 0.2, 0.3, 0.4 };
+        DiscreteDistribution scalarDist(probs, 4, scalar);
+        DiscreteDistribution batchDist(probs, 4, batch);
+        checkSame<double>(
+            "DiscreteDistribution::fill", [&]() { return scalarDist.getNextDouble(); },
+            [&](double* out, size_t count) { batchDist.fill(out, count); });
+    }
+
+    reseed();
+    {
+        UniformDistribution scalarDist(4, scalar);
+        UniformDistribution batchDist(4, batch);
+        checkSame<double>(
+            "UniformDistribution::fill", [&]() { return scalarDist.getNextDouble(); },
+            [&](double* out, size_t count) { batchDist.fill(out, count); });
+    }
+
+    // The Poisson fill takes its uniform numbers in blocks, so also check that it leaves
+    // the generator where the scalar calls do
+    reseed();
+    {
+        PoissonDistribution scalarDist(4.0, scalar);
+        PoissonDistribution batchDist(4.0, batch);
+        checkSame<double>(
+            "PoissonDistribution::fill", [&]() { return scalarDist.getNextDouble(); },
+            [&](double* out, size_t count) { batchDist.fill(out, count); });
+        if ( scalar->generateNextUInt64() != batch->generateNextUInt64() ) {
+            output->fatal(CALL_INFO, 1, "PoissonDistribution::fill drew more values from the generator than needed\n");
+        }
+    }
+
+    // P(|x| > 3) for a standard normal, allowing five standard deviations of the count
+    reseed();
+    {
+        const size_t         count = 1000000;
+        const double         p     = 0.0026997960632601866;
+        GaussianDistribution dist(0.0, 1.0, batch);
+        std::vector<double>  values(count);
+        dist.fill(values.data(), count);
+
+        size_t tail = 0;
+        for ( double value : values ) {
+            if ( std::fabs(value) > 3.0 ) tail++;
+        }
+
+        const double expected = p * count;
+        if ( std::fabs(tail - expected) > 5.0 * std::sqrt(expected * (1.0 - p)) ) {
+            output->fatal(
+                CALL_INFO, 1, "GaussianDistribution::fill drew %zu of %zu values beyond 3 standard deviations\n",
+                tail, count);
+        }
+    }
+
+    delete scalar;
+    delete batch;
+
+    output->output("Fill functions match the scalar calls for the %s generator\n", rngType.c_str());
 }
 
 bool coreTestRNGComponent::tick(Cycle_t)
@@ -38,7 +38,10 @@ public:
         { "seed_w",  "The seed to use for the random number generator", "7" },
         { "seed_z",  "The seed to use for the random number generator", "5" },
         { "seed",    "The seed to use for the random number generator.", "11" },
-        { "rng",     "The random number generator to use (Marsaglia or Mersenne), default is Mersenne", "Mersenne"},
+        { "rng",     "The random number generator to use (Marsaglia, Mersenne, XORShift or Philox), default is Mersenne", "Mersenne"},
+        { "stream",  "The stream of the Philox generator to use", "0" },
+        { "skip",    "The number of 32-bit values the Philox generator skips before the first one is used", "0" },
+        { "check_fill", "Check the fill functions of the generator against its scalar calls before it is used", "false" },
         { "count",   "The number of random numbers to generate, default is 1000", "1000" },
         { "verbose", "Sets the output verbosity of the component", "0" }
     )
@@ -66,6 +69,12 @@ private:
     void operator=(const coreTestRNGComponent&);       // do not implement
 
     virtual bool tick(SST::Cycle_t);
+    Random*      createRNG(const std::string& rngType, SST::Params& params, uint32_t level);
+    void         checkPhiloxKnownAnswers();
+    void         checkFills(const std::string& rngType, SST::Params& params);
+
+    template <typename T, typename ScalarT, typename FillT>
+    void checkSame(const char* name, ScalarT scalar, FillT fill);
 
     Output*     output;
     Random*     rng;
@@ -31,6 +31,8 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
     test_array(false),
     test_map(false),
     test_set(false),
+    test_hash_map(false),
+    test_hash_set(false),
     count(0),
     check(true),
     late_write(false),
@@ -49,6 +51,12 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
     else if ( obj_type == "set" ) {
         test_set = true;
     }
+    else if ( obj_type == "hash_map" ) {
+        test_hash_map = true;
+    }
+    else if ( obj_type == "hash_set" ) {
+        test_hash_set = true;
+    }
 
     myid = params.find<int>("myid", -1);
     if ( myid == -1 ) { out.fatal(CALL_INFO, 1, "ERROR: myid is a required parameter\n"); }
@@ -61,6 +69,8 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
 
     bool conflicting_write = params.find<bool>("conflicting_write", "false");
 
+    bool init_write = params.find<bool>("init_write", "false");
+
     late_write = params.find<bool>("late_write", "false");
 
     pub = params.find<bool>("publish", "true");
@@ -95,7 +105,12 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
 
             if ( myid == 0 || (multiple_initializers && (myid == num_entities - 1)) ) {
                 for ( int i = 0; i < num_entities; ++i ) {
-                    array.write(i, i + (conflicting_write ? myid : 0));
+                    // ID 0 leaves the odd entries at the init value for
+                    // ID N-1 to write
+                    if ( init_write && myid == 0 && (i % 2) == 1 )
+                        array.write(i, -1);
+                    else
+                        array.write(i, i + (conflicting_write ? myid : 0));
                 }
             }
         }
@@ -140,6 +155,40 @@ coreTestSharedObjectsComponent::coreTestSharedObjectsComponent(SST::ComponentId_
         }
         if ( pub ) set.publish();
     }
+    else if ( test_hash_map && !late_initialize ) {
+        if ( full_initialization ) {
+            hash_map.initialize("test_shared_hash_map", v_type, num_entities);
+            if ( double_initialize ) hash_map.initialize("test_shared_hash_map", v_type);
+            if ( myid == 0 || (multiple_initializers && (myid == num_entities - 1)) ) {
+                for ( int i = 0; i < num_entities; ++i ) {
+                    hash_map.write(i, i + (conflicting_write ? myid : 0));
+                }
+            }
+        }
+        else {
+            hash_map.initialize("test_shared_hash_map", v_type);
+            if ( double_initialize ) hash_map.initialize("test_shared_hash_map", v_type);
+            hash_map.write(myid, myid);
+        }
+        if ( pub ) hash_map.publish();
+    }
+    else if ( test_hash_set && !late_initialize ) {
+        if ( full_initialization ) {
+            hash_set.initialize("test_shared_hash_set", v_type, num_entities);
+            if ( double_initialize ) hash_set.initialize("test_shared_hash_set", v_type);
+            if ( myid == 0 || (multiple_initializers && (myid == num_entities - 1)) ) {
+                for ( int i = 0; i < num_entities; ++i ) {
+                    hash_set.insert(setItem(i, i + (conflicting_write ? myid : 0)));
+                }
+            }
+        }
+        else {
+            hash_set.initialize("test_shared_hash_set", v_type);
+            if ( double_initialize ) hash_set.initialize("test_shared_hash_set", v_type);
+            hash_set.insert(setItem(myid, myid));
+        }
+        if ( pub ) hash_set.publish();
+    }
 
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
@@ -177,6 +226,22 @@ coreTestSharedObjectsComponent::init(unsigned int UNUSED(phase))
             out.fatal(CALL_INFO, 100, "ERROR: SharedSet fully published, but should not have been\n");
         }
     }
+    else if ( test_hash_map ) {
+        if ( !hash_map.isFullyPublished() && pub ) {
+            out.fatal(CALL_INFO, 100, "ERROR: SharedHashMap not fully published, but should have been\n");
+        }
+        if ( hash_map.isFullyPublished() && !pub ) {
+            out.fatal(CALL_INFO, 100, "ERROR: SharedHashMap fully published, but should not have been\n");
+        }
+    }
+    else if ( test_hash_set ) {
+        if ( !hash_set.isFullyPublished() && pub ) {
+            out.fatal(CALL_INFO, 100, "ERROR: SharedHashSet not fully published, but should have been\n");
+        }
+        if ( hash_set.isFullyPublished() && !pub ) {
+            out.fatal(CALL_INFO, 100, "ERROR: SharedHashSet fully published, but should not have been\n");
+        }
+    }
 }
 
 void
@@ -210,6 +275,22 @@ coreTestSharedObjectsComponent::setup()
             }
         }
     }
+    else if ( test_hash_map ) {
+        if ( late_write ) { hash_map.write(0, 10); }
+        else {
+            for ( auto x : hash_map ) {
+                if ( x.second < 0 ) { out.fatal(CALL_INFO, 100, "ERROR: SharedHashMap data is messed up\n"); }
+            }
+        }
+    }
+    else if ( test_hash_set ) {
+        if ( late_write ) { hash_set.insert(setItem(0, 0)); }
+        else {
+            for ( auto x : hash_set ) {
+                if ( x.key < 0 ) { out.fatal(CALL_INFO, 100, "ERROR: SharedHashSet data is messed up\n"); }
+            }
+        }
+    }
 }
 
 void
@@ -231,6 +312,17 @@ bool coreTestSharedObjectsComponent::tick(SST::Cycle_t)
         else if ( test_map ) {
             if ( map[count] != count ) { out.fatal(CALL_INFO, 101, "SharedMap does not have the correct data\n"); }
         }
+        else if ( test_hash_map ) {
+            if ( hash_map[count] != count ) {
+                out.fatal(CALL_INFO, 101, "SharedHashMap does not have the correct data\n");
+            }
+        }
+        else if ( test_hash_set ) {
+            auto item = hash_set.find(setItem(count, 0));
+            if ( item == hash_set.end() || item->value != count ) {
+                out.fatal(CALL_INFO, 101, "SharedHashSet does not have the correct data\n");
+            }
+        }
     }
 
     count++;
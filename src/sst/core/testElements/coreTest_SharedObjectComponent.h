@@ -15,6 +15,8 @@
 #include "sst/core/component.h"
 #include "sst/core/output.h"
 #include "sst/core/shared/sharedArray.h"
+#include "sst/core/shared/sharedHashMap.h"
+#include "sst/core/shared/sharedHashSet.h"
 #include "sst/core/shared/sharedMap.h"
 #include "sst/core/shared/sharedSet.h"
 
@@ -50,6 +52,18 @@ struct setItem : public SST::Core::Serialization::serializable
     ImplementSerializable(SST::CoreTestSharedObjectsComponent::setItem);
 };
 
+// For SharedHashSet, items with the same key are the same set item,
+// matching operator< for SharedSet
+struct setItemHash
+{
+    size_t operator()(const setItem& item) const { return std::hash<int>()(item.key); }
+};
+
+struct setItemKeyEqual
+{
+    bool operator()(const setItem& a, const setItem& b) const { return a.key == b.key; }
+};
+
 class coreTestSharedObjectsComponent : public SST::Component
 {
 public:
@@ -64,12 +78,13 @@ public:
     )
 
     SST_ELI_DOCUMENT_PARAMS(
-        { "object_type", "Type of object to test ( array | map | set )", "array"},
+        { "object_type", "Type of object to test ( array | map | set | hash_map | hash_set )", "array"},
         { "num_entities", "Number of entities in the sim", "12"},
         { "myid", "ID Number (0 <= myid < num_entities)", nullptr},
         { "full_initialization", "If true, id 0 will initialize whole array, otherwise each id will contribute", "true"},
         { "multiple_initializers", "If doing full_initialization, this will cause ID N-1 to also initialize array", "false"},
         { "conflicting_write", "Controls whether a conflicting write is done when full_initialization and multiple_initializers are turned on (otherwise it has no effect)", "false"},
+        { "init_write", "If true, ID 0 writes the init value to the odd entries when full_initialization and multiple_initializers are turned on (otherwise it has no effect)", "false"},
         { "verify_mode", "Sets verify mode for SharedArray ( FE | INIT | NONE )", "INIT" },
         { "late_write", "Controls whether a late write is done", "false" },
         { "publish", "Controls whether publish() is called or not", "true"},
@@ -105,6 +120,8 @@ private:
     bool test_array;
     bool test_map;
     bool test_set;
+    bool test_hash_map;
+    bool test_hash_set;
 
     int myid;
     int num_entities;
@@ -115,9 +132,11 @@ private:
     bool pub;
     bool late_initialize;
 
-    Shared::SharedArray<int>    array;
-    Shared::SharedMap<int, int> map;
-    Shared::SharedSet<setItem>  set;
+    Shared::SharedArray<int>                                     array;
+    Shared::SharedMap<int, int>                                  map;
+    Shared::SharedSet<setItem>                                   set;
+    Shared::SharedHashMap<int, int>                              hash_map;
+    Shared::SharedHashSet<setItem, setItemHash, setItemKeyEqual> hash_set;
 };
 
 } // namespace CoreTestSharedObjectsComponent
@@ -0,0 +1,225 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_TunnelBenchmark.h"
+
+#include "sst/core/interprocess/shmchild.h"
+#include "sst/core/interprocess/shmparent.h"
+#include "sst/core/interprocess/tunneldef.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+using namespace SST::Core::Interprocess;
+
+namespace SST {
+namespace CoreTestTunnelBenchmark {
+
+coreTestTunnelBenchmarkComponent::coreTestTunnelBenchmarkComponent(ComponentId_t id, Params& params) :
+    Component(id),
+    received(0),
+    out_of_order(0),
+    checksum(0),
+    cpu_time(0.0)
+{
+    Output&     out         = getSimulationOutput();
+    uint64_t    messages    = params.find<uint64_t>("messages", 100000);
+    size_t      buffer_size = params.find<size_t>("buffer_size", 1024);
+    std::string buffer_type = params.find<std::string>("buffer_type", "mutex");
+    size_t      batch       = params.find<size_t>("batch", 1);
+    uint64_t    burst       = params.find<uint64_t>("burst", 0);
+    uint64_t    idle_us     = params.find<uint64_t>("idle_us", 0);
+    size_t      payload     = params.find<size_t>("payload_size", 0);
+    size_t      slab_size   = params.find<size_t>("slab_size", 16777216);
+    bool        print_rate  = params.find<bool>("print_rate", false);
+
+    if ( batch == 0 ) { out.fatal(CALL_INFO, 1, "Component %s: batch must be at least 1\n", getName().c_str()); }
+    if ( buffer_type != "mutex" && buffer_type != "spsc" ) {
+        out.fatal(CALL_INFO, 1, "Component %s: unknown buffer_type %s\n", getName().c_str(), buffer_type.c_str());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if ( payload != 0 ) {
+        if ( buffer_type == "mutex" ) {
+            runPayload<CircularBuffer<PayloadHandle>>(messages, buffer_size, payload, slab_size);
+        }
+        else {
+            runPayload<SPSCCircularBuffer<PayloadHandle>>(messages, buffer_size, payload, slab_size);
+        }
+    }
+    else if ( buffer_type == "mutex" ) {
+        run<CircularBuffer<uint64_t>>(messages, buffer_size, batch, burst, idle_us);
+    }
+    else {
+        run<SPSCCircularBuffer<uint64_t>>(messages, buffer_size, batch, burst, idle_us);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    out.output(
+        "Component %s: received %" PRIu64 " messages, %" PRIu64 " out of order, checksum = %" PRIu64 "\n",
+        getName().c_str(), received, out_of_order, checksum);
+    if ( print_rate ) {
+        out.output(
+            "Component %s: %.0f messages per second (%s buffer, batch %zu)\n", getName().c_str(),
+            messages / elapsed.count(), buffer_type.c_str(), batch);
+        if ( payload != 0 ) {
+            out.output(
+                "Component %s: %.2f GB per second in %zu byte payloads\n", getName().c_str(),
+                messages * payload / elapsed.count() / 1e9, payload);
+        }
+        out.output(
+            "Component %s: reader used %.1f ms of CPU in %.1f ms\n", getName().c_str(), cpu_time * 1000.0,
+            elapsed.count() * 1000.0);
+    }
+}
+
+void
+coreTestTunnelBenchmarkComponent::checkAlignment(const void* ptr)
+{
+    // Each structure in the region starts on its own cache line
+    if ( (uintptr_t)ptr % 64 != 0 ) {
+        getSimulationOutput().fatal(
+            CALL_INFO, 1, "Component %s: tunnel structure at %p is not cache line aligned\n", getName().c_str(), ptr);
+    }
+}
+
+template <typename BuffT>
+void
+coreTestTunnelBenchmarkComponent::run(
+    uint64_t messages, size_t buffer_size, size_t batch, uint64_t burst, uint64_t idle_us)
+{
+    typedef TunnelDef<uint64_t, uint64_t, BuffT> tunnel_t;
+
+    SHMParent<tunnel_t> parent((uint32_t)getId(), 1, buffer_size);
+    tunnel_t*           tunnel = parent.getTunnel();
+    std::string         region = parent.getRegionName();
+    checkAlignment(tunnel->getSharedData());
+
+    // The writer attaches to the region by name, like a child process
+    std::thread writer([region, messages, batch, burst, idle_us]() {
+        SHMChild<tunnel_t>    child(region);
+        tunnel_t*             tunnel = child.getTunnel();
+        std::vector<uint64_t> values(batch);
+        uint64_t              next = 1;
+        while ( next <= messages ) {
+            uint64_t last = burst == 0 ? messages : std::min(messages, next + burst - 1);
+            while ( next <= last ) {
+                if ( batch == 1 ) {
+                    tunnel->writeMessage(0, next++);
+                    continue;
+                }
+
+                size_t count = 0;
+                while ( count < batch && next <= last )
+                    values[count++] = next++;
+                tunnel->writeMessages(0, values.data(), count);
+            }
+
+            // Leave the reader idle between bursts
+            if ( next <= messages ) std::this_thread::sleep_for(std::chrono::microseconds(idle_us));
+        }
+    });
+
+    struct timespec cpu_start;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+
+    std::vector<uint64_t> values(batch);
+    while ( received < messages ) {
+        size_t count;
+        if ( batch == 1 ) {
+            values[0] = tunnel->readMessage(0);
+            count     = 1;
+        }
+        else {
+            count = tunnel->readMessages(0, values.data(), batch);
+        }
+
+        for ( size_t i = 0; i < count; ++i ) {
+            if ( values[i] != ++received ) out_of_order++;
+            checksum += values[i];
+        }
+    }
+
+    struct timespec cpu_end;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+    cpu_time = (cpu_end.tv_sec - cpu_start.tv_sec) + (cpu_end.tv_nsec - cpu_start.tv_nsec) / 1e9;
+
+    writer.join();
+}
+
+template <typename BuffT>
+void
+coreTestTunnelBenchmarkComponent::runPayload(uint64_t messages, size_t buffer_size, size_t payload, size_t slab_size)
+{
+    typedef TunnelDef<uint64_t, PayloadHandle, BuffT> tunnel_t;
+
+    SHMParent<tunnel_t> parent((uint32_t)getId(), 1, buffer_size, 1, slab_size);
+    tunnel_t*           tunnel = parent.getTunnel();
+    PayloadSlab*        slab   = tunnel->getPayloadSlab();
+    std::string         region = parent.getRegionName();
+    checkAlignment(tunnel->getSharedData());
+    checkAlignment(slab);
+
+    if ( payload > slab->getMaxPayloadSize() ) {
+        getSimulationOutput().fatal(
+            CALL_INFO, 1, "Component %s: payload_size %zu does not fit in a slab of %zu bytes\n", getName().c_str(),
+            payload, slab_size);
+    }
+
+    // The writer fills each payload in place and sends only its handle
+    std::thread writer([region, messages, payload]() {
+        SHMChild<tunnel_t> child(region);
+        tunnel_t*          tunnel = child.getTunnel();
+        PayloadSlab*       slab   = tunnel->getPayloadSlab();
+        for ( uint64_t next = 1; next <= messages; ++next ) {
+            PayloadHandle handle = slab->allocate(payload);
+            uint64_t*     data   = (uint64_t*)slab->getPayload(handle);
+            std::fill(data, data + payload / sizeof(uint64_t), next);
+            tunnel->writeMessage(0, handle);
+        }
+    });
+
+    struct timespec cpu_start;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+
+    while ( received < messages ) {
+        PayloadHandle   handle = tunnel->readMessage(0);
+        const uint64_t* data   = (const uint64_t*)slab->getPayload(handle);
+        ++received;
+
+        // Every word of the payload must hold the message number
+        bool   good  = handle.length == payload;
+        size_t words = handle.length / sizeof(uint64_t);
+        for ( size_t i = 0; i < words; ++i ) {
+            good &= data[i] == received;
+        }
+        if ( !good ) out_of_order++;
+        checksum += words == 0 ? received : data[0];
+        slab->release(handle);
+    }
+
+    struct timespec cpu_end;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+    cpu_time = (cpu_end.tv_sec - cpu_start.tv_sec) + (cpu_end.tv_nsec - cpu_start.tv_nsec) / 1e9;
+
+    writer.join();
+}
+
+coreTestTunnelBenchmarkComponent::coreTestTunnelBenchmarkComponent() : Component(-1) {}
+
+} // namespace CoreTestTunnelBenchmark
+} // namespace SST
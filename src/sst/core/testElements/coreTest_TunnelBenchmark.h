@@ -0,0 +1,97 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_TUNNELBENCHMARK_H
+#define SST_CORE_CORETEST_TUNNELBENCHMARK_H
+
+#include "sst/core/component.h"
+
+namespace SST {
+namespace CoreTestTunnelBenchmark {
+
+/*
+  Measures the throughput of the circular buffers used by the
+  interprocess tunnels.  The component creates a shared memory tunnel
+  with one buffer, attaches a child to it from a second thread the
+  way an external front end would, and has the child write a
+  sequence of numbers that the component reads back.  Every buffer
+  type and batch size must receive the same numbers in order.
+
+  With payload_size set, the child instead fills payloads in the
+  tunnel's payload slab and sends their handles, and the component
+  checks and releases each payload.  batch and burst are not used.
+ */
+
+class coreTestTunnelBenchmarkComponent : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestTunnelBenchmarkComponent,
+        "coreTestElement",
+        "coreTestTunnelBenchmarkComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Interprocess tunnel circular buffer benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "messages",     "Number of messages to send through the tunnel", "100000" },
+        { "buffer_size",  "Number of messages the buffer can hold", "1024" },
+        { "buffer_type",  "Type of circular buffer: mutex or spsc", "mutex" },
+        { "batch",        "Number of messages written and read at once", "1" },
+        { "burst",        "Number of messages the writer sends before going idle.  0 never idles", "0" },
+        { "idle_us",      "Microseconds the writer stays idle between bursts", "0" },
+        { "payload_size", "If not 0, send payloads of this many bytes through a payload slab instead of numbers", "0" },
+        { "slab_size",    "Bytes of payload the tunnel's payload slab can hold", "16777216" },
+        { "print_rate",   "Print the measured message rate and the CPU time used by the reader", "false" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestTunnelBenchmarkComponent(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestTunnelBenchmarkComponent() {}
+    void setup() {}
+    void finish() {}
+
+private:
+    coreTestTunnelBenchmarkComponent();                                        // for serialization only
+    coreTestTunnelBenchmarkComponent(const coreTestTunnelBenchmarkComponent&); // do not implement
+    void operator=(const coreTestTunnelBenchmarkComponent&);                   // do not implement
+
+    template <typename BuffT>
+    void run(uint64_t messages, size_t buffer_size, size_t batch, uint64_t burst, uint64_t idle_us);
+
+    template <typename BuffT>
+    void runPayload(uint64_t messages, size_t buffer_size, size_t payload, size_t slab_size);
+
+    void checkAlignment(const void* ptr);
+
+    uint64_t received;
+    uint64_t out_of_order;
+    uint64_t checksum;
+    double   cpu_time;
+};
+
+} // namespace CoreTestTunnelBenchmark
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_TUNNELBENCHMARK_H
@@ -0,0 +1,66 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Builds the same 10x10 torus as test_Component.py, using the bulk
+# builder API
+
+# Define SST core options
+sst.setProgramOption("stop-at", "25us")
+
+params = {
+    "workPerCycle" : "1000",
+    "commSize" : "100",
+    "commFreq" : "1000"
+}
+
+# Define the simulation components.  Most of them share one params
+# dict.  The first row uses a parameter template with a local override
+# and the second row adds the template after the component is created.
+override = sst.createParamTemplate(dict(params, commFreq = "0"))
+ids = sst.addComponents([("c%d_%d" % (x, y), "coreTestElement.coreTestComponent",
+                          override if y == 0 else None if y == 1 else params)
+                         for y in range(10) for x in range(10)])
+for x in range(10):
+    sst.findComponentByName("c%d_0" % x).addParam("commFreq", "1000")
+    sst.findComponentByName("c%d_1" % x).addParamTemplate(sst.createParamTemplate(params))
+
+# Template ids are 32 bits, so a larger id must not wrap around to an
+# existing template
+for add in (lambda: sst.addComponents([("bad", "coreTestElement.coreTestComponent", override + 2**32)]),
+            lambda: sst.findComponentByName("c0_0").addParamTemplate(override + 2**32)):
+    try:
+        add()
+    except OverflowError:
+        pass
+    else:
+        raise RuntimeError("A parameter template id above 32 bits was accepted")
+
+def comp_id(x, y):
+    return ids[(y % 10) * 10 + (x % 10)]
+
+# Define the simulation links.  North/south links refer to components by
+# id, east/west links by name.
+links = []
+for y in range(10):
+    for x in range(10):
+        links.append((comp_id(x, y), "Nlink", comp_id(x, y + 1), "Slink", "10000ps"))
+        links.append(("c%d_%d" % (x, y), "Elink", "c%d_%d" % ((x + 1) % 10, y), "Wlink", sst.UnitAlgebra("10ns")))
+sst.addLinks(links)
+
+# The generated link names are reserved, so connecting a port a second
+# time is an error
+try:
+    sst.addLinks(links[:1])
+except ValueError:
+    pass
+else:
+    raise RuntimeError("addLinks() reused a link name")
@@ -0,0 +1,36 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Define SST core options
+sst.setProgramOption("stop-at", "1us")
+
+# Both components read the same parameters, one by name and one through
+# Params::Key handles, and must report the same checksum.  Set
+# print_rate to compare the construction throughput of the two.
+params = {
+    "count" : 2000,
+    "print_rate" : False,
+    "int_param" : -5,
+    "uint_param" : 18446744073709551615,
+    "double_param" : 2.5,
+    "bool_param" : True,
+    "string_param" : "benchmark",
+    "clock" : "2GHz"
+}
+
+by_name = sst.Component("by_name", "coreTestElement.coreTestParamBenchmarkComponent")
+by_name.addParams(params)
+by_name.addParam("use_keys", False)
+
+by_key = sst.Component("by_key", "coreTestElement.coreTestParamBenchmarkComponent")
+by_key.addParams(params)
+by_key.addParam("use_keys", True)
@@ -0,0 +1,36 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+########################################################################
+# Four unlinked components on a line.  The last one is explicitly
+# placed at the origin, next to Right, so a geometric partition into
+# two parts must give {Left0, Left1} and {Right, Origin}.  If the
+# origin were mistaken for "no coordinates", Origin would be assigned
+# linearly to the first part instead.
+########################################################################
+
+placements = [
+    ("Left0", -11.0),
+    ("Left1", -10.0),
+    ("Right", 1.0),
+    ("Origin", 0.0)
+]
+
+for name, x in placements:
+    comp = sst.Component(name, "coreTestElement.StatisticsComponent.int")
+    comp.addParams({
+        "rng" : "marsaglia",
+        "count" : "10",
+        "seed_w" : "1447",
+        "seed_z" : "1053"
+    })
+    comp.setCoordinates(x, 0.0, 0.0)
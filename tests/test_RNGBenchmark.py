@@ -0,0 +1,41 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Define SST core options
+sst.setProgramOption("stop-at", "1us")
+
+# Each pair draws the same values, one call per value and in batches
+# through the fill functions.  The generators must report the same
+# checksum either way.  The Gaussian batches use the ziggurat method,
+# so only their mean and standard deviation agree.  Set print_rate to
+# compare the throughput of the two paths.
+tests = [
+    ("xorshift", "none"),
+    ("philox", "none"),
+    ("mersenne", "none"),
+    ("philox", "uniform"),
+    ("philox", "expon"),
+    ("philox", "discrete"),
+    ("philox", "gaussian"),
+]
+
+for (rng, distrib) in tests:
+    for batch in (1, 1000):
+        name = "{0}_{1}_{2}".format(rng, distrib, "scalar" if batch == 1 else "batch")
+        comp = sst.Component(name, "coreTestElement.coreTestRNGBenchmarkComponent")
+        comp.addParams({
+            "rng" : rng,
+            "distrib" : distrib,
+            "count" : 200000,
+            "batch" : batch,
+            "print_rate" : False
+        })
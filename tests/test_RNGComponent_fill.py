@@ -0,0 +1,32 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Define SST core options
+sst.setProgramOption("stop-at", "10000s")
+
+# Each component checks the fill functions of its generator before
+# drawing its values
+generators = {
+    "mersenne" : { "seed" : "1447" },
+    "marsaglia" : { "seed_w" : "7", "seed_z" : "5" },
+    "xorshift" : { "seed" : "57" },
+    "philox" : { "seed" : "1447", "stream" : "1", "skip" : "7" },
+}
+
+for (rng, seeds) in generators.items():
+    comp = sst.Component("fill_" + rng, "coreTestElement.coreTestRNGComponent")
+    comp.addParams(seeds)
+    comp.addParams({
+          "count" : "10",
+          "rng" : rng,
+          "check_fill" : "true"
+    })
@@ -0,0 +1,107 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+########################################################################
+# This script is run by the test suite writing statistics to CSV and
+# then to the binary columnar format or the reduced output.  The binary
+# file is checked against the CSV output and the reduced file against a
+# reference file.
+#
+# Usage: --model-options="<csv|binary|reduce> <filepath>"
+########################################################################
+
+output_type = sys.argv[1]
+output_file = sys.argv[2]
+
+sst.setProgramOptions({
+    "partitioner" : "roundrobin"
+})
+
+sst.setStatisticLoadLevel(7)
+
+if output_type == "binary":
+    # Use a small chunk size so that multiple chunks are written
+    sst.setStatisticOutput("sst.statOutputBinary", {
+        "filepath" : output_file,
+        "chunkrows" : "7"
+    })
+elif output_type == "reduce":
+    sst.setStatisticOutput("sst.statOutputReduce", {
+        "filepath" : output_file
+    })
+else:
+    sst.setStatisticOutput("sst.statOutputCSV", {
+        "filepath" : output_file,
+        "separator" : ", ",
+        "outputrank" : "0"
+    })
+
+StatBin0 = sst.Component("StatBin0", "coreTestElement.StatisticsComponent.int")
+StatBin0.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1447",
+      "seed_z" : "1053"
+})
+
+StatBin0.enableStatistics(["stat1_U32", "stat3_I32"], {
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "5 ns"})
+
+StatBin0.enableStatistics(["stat2_U64"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "1000",
+    "binwidth" : "1000",
+    "numbins"  : "17",
+    "rate" : "10 ns"})
+
+StatBin0.enableStatistics(["stat4_I64"], {
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "9 events",
+    "resetOnOutput" : True})
+
+StatBin1 = sst.Component("StatBin1", "coreTestElement.StatisticsComponent.int")
+StatBin1.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1448",
+      "seed_z" : "1054"
+})
+
+StatBin1.enableAllStatistics({
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "13 ns" })
+
+StatBin2 = sst.Component("StatBin2", "coreTestElement.StatisticsComponent.float")
+StatBin2.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1449",
+      "seed_z" : "1055"
+})
+
+StatBin2.enableAllStatistics({
+    "type" : "sst.AccumulatorStatistic",
+    "rate" : "11 ns" })
+
+if output_type == "reduce":
+    # A linked pair of components on different ranks makes the ranks
+    # synchronize while statistics are collected, which is when the
+    # reduced output writes the periods that have ended
+    Link0 = sst.Component("Link0", "coreTestElement.coreTestLinks")
+    Link0.addParams({ "id" : "0" })
+    Link1 = sst.Component("Link1", "coreTestElement.coreTestLinks")
+    Link1.addParams({ "id" : "1" })
+
+    sst.Link("LinkEast").connect( (Link0, "Elink", "1ns"), (Link1, "Wlink", "1ns") )
+    sst.Link("LinkWest").connect( (Link0, "Wlink", "1ns"), (Link1, "Elink", "1ns") )
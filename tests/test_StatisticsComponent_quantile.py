@@ -0,0 +1,105 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+########################################################################
+# Components are fed the same random values.  Some track them with a
+# QuantileStatistic and one with a unit width histogram, which holds
+# the exact distribution that the quantiles are checked against.  A
+# second pair of components gets a few values from another seed.
+#
+# With the reduced output the two quantile components are on different
+# ranks and their sketches are merged, and so are the histograms.
+#
+# Usage: --model-options="<csv|reduce> <filepath>"
+########################################################################
+
+output_type = sys.argv[1]
+output_file = sys.argv[2]
+
+sst.setProgramOptions({
+    "partitioner" : "roundrobin"
+})
+
+sst.setStatisticLoadLevel(7)
+if output_type == "reduce":
+    sst.setStatisticOutput("sst.statOutputReduce", {
+        "filepath" : output_file
+    })
+else:
+    sst.setStatisticOutput("sst.statOutputCSV", {
+        "filepath" : output_file,
+        "separator" : ", ",
+        "outputrank" : "0"
+    })
+
+rng_params = {
+      "rng" : "marsaglia",
+      "count" : "1000",
+      "seed_w" : "1447",
+      "seed_z" : "1053"
+}
+
+few_rng_params = {
+      "rng" : "marsaglia",
+      "count" : "20",
+      "seed_w" : "1449",
+      "seed_z" : "1055"
+}
+
+quantile_params = {
+    "type" : "sst.QuantileStatistic",
+    "quantiles" : "[0.0, 0.25, 0.5, 0.9, 0.99, 1.0]",
+    "accuracy" : "0.01",
+    "rate" : "0 ns"}
+
+QuantComp = sst.Component("QuantComp", "coreTestElement.StatisticsComponent.int")
+QuantComp.addParams(rng_params)
+QuantComp.enableStatistics(["stat1_U32", "stat3_I32"], quantile_params)
+
+# The partitioner places components on ranks in turn
+FewQuantComp = sst.Component("FewQuantComp", "coreTestElement.StatisticsComponent.int")
+FewQuantComp.addParams(few_rng_params)
+FewQuantComp.enableStatistics(["stat1_U32"], quantile_params)
+
+# Too few buckets for the range, so the lowest buckets get collapsed.
+# Its sketch would lose accuracy when merged, so it is left out of the
+# reduced output.
+if output_type != "reduce":
+    QuantSmallComp = sst.Component("QuantSmallComp", "coreTestElement.StatisticsComponent.int")
+    QuantSmallComp.addParams(rng_params)
+    QuantSmallComp.enableStatistics(["stat1_U32"], dict(quantile_params, maxbins = "64"))
+
+HistComp = sst.Component("HistComp", "coreTestElement.StatisticsComponent.int")
+HistComp.addParams(rng_params)
+HistComp.enableStatistics(["stat1_U32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "0",
+    "binwidth" : "1",
+    "numbins"  : "500",
+    "rate" : "0 ns"})
+
+HistComp.enableStatistics(["stat3_I32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "-300",
+    "binwidth" : "1",
+    "numbins"  : "600",
+    "rate" : "0 ns"})
+
+FewHistComp = sst.Component("FewHistComp", "coreTestElement.StatisticsComponent.int")
+FewHistComp.addParams(few_rng_params)
+FewHistComp.enableStatistics(["stat1_U32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : "0",
+    "binwidth" : "1",
+    "numbins"  : "500",
+    "rate" : "0 ns"})
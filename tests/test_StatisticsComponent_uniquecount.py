@@ -0,0 +1,90 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+########################################################################
+# In csv mode two components are fed the same random values.  One
+# counts unique values exactly and the other estimates the count with
+# HyperLogLog.
+#
+# In reduce mode two pairs of components draw overlapping values (the
+# second component of each pair draws the first half of the values of
+# the first) and the counts are merged with sst.statOutputReduce.  One
+# pair counts stat1/stat2 exactly, the other estimates stat3/stat4.
+#
+# Usage: --model-options="<csv|reduce> <filepath>"
+########################################################################
+
+output_type = sys.argv[1]
+output_file = sys.argv[2]
+
+sst.setProgramOptions({
+    "partitioner" : "roundrobin"
+})
+
+sst.setStatisticLoadLevel(7)
+if output_type == "reduce":
+    sst.setStatisticOutput("sst.statOutputReduce", {
+        "filepath" : output_file,
+        "separator" : ", "
+    })
+else:
+    sst.setStatisticOutput("sst.statOutputCSV", {
+        "filepath" : output_file,
+        "separator" : ", ",
+        "outputrank" : "0"
+    })
+
+rng_params = {
+      "rng" : "marsaglia",
+      "count" : "5000",
+      "seed_w" : "1447",
+      "seed_z" : "1053"
+}
+
+half_rng_params = dict(rng_params, count="2500")
+
+exact_params = {
+    "type" : "sst.UniqueCountStatistic",
+    "rate" : "0 ns"}
+
+hll_params = {
+    "type" : "sst.UniqueCountStatistic",
+    "mode" : "hyperloglog",
+    "precision" : "12",
+    "rate" : "0 ns"}
+
+if output_type == "reduce":
+    # With roundrobin on two ranks each rank gets one component of each pair
+    ExactA = sst.Component("ExactA", "coreTestElement.StatisticsComponent.int")
+    ExactA.addParams(rng_params)
+    ExactA.enableStatistics(["stat1_U32", "stat2_U64"], exact_params)
+
+    ExactB = sst.Component("ExactB", "coreTestElement.StatisticsComponent.int")
+    ExactB.addParams(half_rng_params)
+    ExactB.enableStatistics(["stat1_U32", "stat2_U64"], exact_params)
+
+    HLLA = sst.Component("HLLA", "coreTestElement.StatisticsComponent.int")
+    HLLA.addParams(rng_params)
+    HLLA.enableStatistics(["stat3_I32", "stat4_I64"], hll_params)
+
+    HLLB = sst.Component("HLLB", "coreTestElement.StatisticsComponent.int")
+    HLLB.addParams(half_rng_params)
+    HLLB.enableStatistics(["stat3_I32", "stat4_I64"], hll_params)
+else:
+    ExactComp = sst.Component("ExactComp", "coreTestElement.StatisticsComponent.int")
+    ExactComp.addParams(rng_params)
+    ExactComp.enableAllStatistics(exact_params)
+
+    HLLComp = sst.Component("HLLComp", "coreTestElement.StatisticsComponent.int")
+    HLLComp.addParams(rng_params)
+    HLLComp.enableAllStatistics(hll_params)
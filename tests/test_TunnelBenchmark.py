@@ -0,0 +1,65 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Define SST core options
+sst.setProgramOption("stop-at", "1us")
+
+# Each component sends the same messages through a tunnel with a
+# different buffer type and batch size, and all must receive them in
+# order.  Set print_rate to compare the throughput of the buffers.
+params = {
+    "messages" : 20000,
+    "buffer_size" : 256,
+    "print_rate" : False
+}
+
+configs = [
+    ("mutex", "mutex", 1),
+    ("mutex_batch", "mutex", 16),
+    ("spsc", "spsc", 1),
+    ("spsc_batch", "spsc", 16)
+]
+
+for name, buffer_type, batch in configs:
+    comp = sst.Component(name, "coreTestElement.coreTestTunnelBenchmarkComponent")
+    comp.addParams(params)
+    comp.addParam("buffer_type", buffer_type)
+    comp.addParam("batch", batch)
+
+# The writer goes idle between bursts, so the reader waits on an empty
+# buffer.  With print_rate set, the reader's CPU time shows whether it
+# sleeps instead of spinning while it waits.
+for name, buffer_type in [("mutex_idle", "mutex"), ("spsc_idle", "spsc")]:
+    comp = sst.Component(name, "coreTestElement.coreTestTunnelBenchmarkComponent")
+    comp.addParams(params)
+    comp.addParams({
+        "buffer_type" : buffer_type,
+        "burst" : 1000,
+        "idle_us" : 1000
+    })
+
+# Payloads are filled in place in a payload slab that is too small to
+# hold them all, so the slab has to reuse the released space.
+payload_configs = [
+    ("mutex_payload", "mutex", 10000),
+    ("spsc_payload", "spsc", 65536)
+]
+
+for name, buffer_type, payload_size in payload_configs:
+    comp = sst.Component(name, "coreTestElement.coreTestTunnelBenchmarkComponent")
+    comp.addParams({
+        "messages" : 2000,
+        "buffer_size" : 64,
+        "buffer_type" : buffer_type,
+        "payload_size" : payload_size,
+        "slab_size" : 1048576
+    })
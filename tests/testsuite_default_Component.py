@@ -56,14 +56,17 @@ class testcase_Component(SSTTestCase):
     def test_Component_time_overflow(self):
         self.component_test_template("Component_time_overflow", 1)
 
+    def test_Component_bulk(self):
+        self.component_test_template("Component_bulk", reftype = "Component")
+
 #####
 
-    def component_test_template(self, testtype, exp_rc = 0):
+    def component_test_template(self, testtype, exp_rc = 0, reftype = None):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
         sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
-        reffile = "{0}/refFiles/test_{1}.out".format(testsuitedir, testtype)
+        reffile = "{0}/refFiles/test_{1}.out".format(testsuitedir, reftype or testtype)
         outfile = "{0}/test_{1}.out".format(outdir, testtype)
         errfile = "{0}/test_{1}.err".format(outdir, testtype)
 
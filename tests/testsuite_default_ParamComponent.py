@@ -53,15 +53,18 @@ class testcase_ParamComponent(SSTTestCase):
     def test_ParamComponent(self):
         self.param_component_test_template("param_component")
 
+    def test_ParamBenchmark(self):
+        self.param_component_test_template("param_benchmark", "ParamBenchmark")
+
 #####
 
-    def param_component_test_template(self, testtype):
+    def param_component_test_template(self, testtype, testname = "ParamComponent"):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
-        sdlfile = "{0}/test_ParamComponent.py".format(testsuitedir)
-        reffile = "{0}/refFiles/test_ParamComponent.out".format(testsuitedir)
-        outfile = "{0}/test_ParamComponent.out".format(outdir)
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testname)
+        reffile = "{0}/refFiles/test_{1}.out".format(testsuitedir, testname)
+        outfile = "{0}/test_{1}.out".format(outdir, testname)
 
         self.run_sst(sdlfile, outfile)
 
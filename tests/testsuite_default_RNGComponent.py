@@ -62,6 +62,40 @@ class testcase_RNGComponent(SSTTestCase):
     def test_RNG_xorshift(self):
         self.RNG_test_template("xorshift")
 
+    def test_RNG_philox(self):
+        self.RNG_test_template("philox")
+
+    def test_RNGBenchmark(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_RNGBenchmark.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_RNGBenchmark.out".format(testsuitedir)
+        outfile = "{0}/test_RNGBenchmark.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        # Perform the test
+        filter1 = StartsWithFilter("WARNING: No components are")
+        ws_filter = IgnoreWhiteSpaceFilter()
+        cmp_result = testing_compare_filtered_diff("RNGBenchmark", outfile, reffile, True, [filter1, ws_filter])
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def test_RNG_fill(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_RNGComponent_fill.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_RNGComponent_fill.out".format(testsuitedir)
+        outfile = "{0}/test_RNGComponent_fill.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        # Perform the test
+        filter1 = StartsWithFilter("WARNING: No components are")
+        cmp_result = testing_compare_filtered_diff("RNG_fill", outfile, reffile, True, [filter1])
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
 #####
 
     def RNG_test_template(self, testtype):
@@ -23,6 +23,16 @@ from sst_unittest_support import *
 module_init = 0
 module_sema = threading.Semaphore()
 
+have_mpi = sst_core_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", default=0, disable_warning=True) == 1
+launchable_ranks = {}
+
+def can_run_ranks(num_ranks):
+    """ Returns True if mpirun can launch num_ranks ranks on this host """
+    if num_ranks not in launchable_ranks:
+        launchable_ranks[num_ranks] = have_mpi and \
+            os_simple_command("mpirun -np {0} -map-by numa:PE=1 true".format(num_ranks))[0] == 0
+    return launchable_ranks[num_ranks]
+
 def initializeTestModule_SingleInstance(class_inst):
     global module_init
     global module_sema
@@ -61,6 +71,7 @@ class testcase_SharedObject(SSTTestCase):
     #     no_verify
     #   multi - also has ID N-1 initialize array
     #     no conflict - both IDs write same data
+    #     init write - ID 0 leaves some entries at the init value
     #     conflict - IDs write different data
     #       init_verify
     #       fe_verify
@@ -84,6 +95,9 @@ class testcase_SharedObject(SSTTestCase):
     def test_SharedObject_array_full_multi(self):
         self.sharedobject_test_template("array_full_multi", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true")
 
+    def test_SharedObject_array_full_multi_init_write(self):
+        self.sharedobject_test_template("array_full_multi_init_write", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=init_write:true")
+
     def test_SharedObject_array_full_multi_conflict_init(self):
         self.sharedobject_test_template("array_full_multi_conflict_init", 1, "--param=object_type:array --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=conflicting_write:true")
 
@@ -93,9 +107,15 @@ class testcase_SharedObject(SSTTestCase):
     def test_SharedObject_array_full_multi_conflict_none(self):
         self.sharedobject_test_template("array_full_multi_conflict_none", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=conflicting_write:true --param=verify_mode:NONE")
 
+    def test_SharedObject_array_full_node_shared(self):
+        self.sharedobject_test_template("array_full_node_shared", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:true", "--node-shared-arrays")
+
     def test_SharedObject_array_partial(self):
         self.sharedobject_test_template("array_partial", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:false")
 
+    def test_SharedObject_array_partial_node_shared(self):
+        self.sharedobject_test_template("array_partial_node_shared", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:false", "--node-shared-arrays")
+
     def test_SharedObject_array_partial_nopub(self):
         self.sharedobject_test_template("array_partial_nopub", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:false --param=publish:false")
 
@@ -228,20 +248,135 @@ class testcase_SharedObject(SSTTestCase):
     def test_SharedObject_set_late_initialize(self):
         self.sharedobject_test_template("set_late_initialize", 1, "--param=object_type:set --param=num_entities:12 --param=late_initialize:true")
 
+
+    # SharedHashMap Tests
+    # Same cases as the SharedMap tests
+
+    def test_SharedObject_hash_map_full_single_init(self):
+        self.sharedobject_test_template("hash_map_full_single_init", 0, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:true")
+
+    def test_SharedObject_hash_map_full_single_fe(self):
+        self.sharedobject_test_template("hash_map_full_single_fe", 0, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:true --param=verify_mode:FE")
+
+    def test_SharedObject_hash_map_full_single_none(self):
+        self.sharedobject_test_template("hash_map_full_single_none", 0, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:true --param=verify_mode:NONE")
+
+    def test_SharedObject_hash_map_full_multi(self):
+        self.sharedobject_test_template("hash_map_full_multi", 0, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true")
+
+    def test_SharedObject_hash_map_full_multi_conflict_init(self):
+        self.sharedobject_test_template("hash_map_full_multi_conflict_init", 1, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=conflicting_write:true")
+
+    def test_SharedObject_hash_map_full_multi_conflict_fe(self):
+        self.sharedobject_test_template("hash_map_full_multi_conflict_fe", 1, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=conflicting_write:true --param=verify_mode:FE")
+
+    def test_SharedObject_hash_map_full_multi_conflict_none(self):
+        self.sharedobject_test_template("hash_map_full_multi_conflict_none", 0, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=conflicting_write:true --param=verify_mode:NONE")
+
+    def test_SharedObject_hash_map_partial(self):
+        self.sharedobject_test_template("hash_map_partial", 0, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:false")
+
+    def test_SharedObject_hash_map_partial_nopub(self):
+        self.sharedobject_test_template("hash_map_partial_nopub", 0, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:false --param=publish:false")
+
+    def test_SharedObject_hash_map_partial_late(self):
+        self.sharedobject_test_template("hash_map_partial_late", 1, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:false --param=late_write:true")
+
+    def test_SharedObject_hash_map_partial_late_nopub(self):
+        self.sharedobject_test_template("hash_map_partial_late_nopub", 1, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:false --param=late_write:true --param=publish:false")
+
+    def test_SharedObject_hash_map_partial_doubleinit(self):
+        self.sharedobject_test_template("hash_map_partial_doubleinit", 1, "--param=object_type:hash_map --param=num_entities:12 --param=full_initialization:false --param=double_initialize:true")
+
+    def test_SharedObject_hash_map_late_initialize(self):
+        self.sharedobject_test_template("hash_map_late_initialize", 1, "--param=object_type:hash_map --param=num_entities:12 --param=late_initialize:true")
+
+
+    # SharedHashSet Tests
+    # Same cases as the SharedSet tests
+
+    def test_SharedObject_hash_set_full_single_init(self):
+        self.sharedobject_test_template("hash_set_full_single_init", 0, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:true")
+
+    def test_SharedObject_hash_set_full_single_fe(self):
+        self.sharedobject_test_template("hash_set_full_single_fe", 0, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:true --param=verify_mode:FE")
+
+    def test_SharedObject_hash_set_full_single_none(self):
+        self.sharedobject_test_template("hash_set_full_single_none", 0, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:true --param=verify_mode:NONE")
+
+    def test_SharedObject_hash_set_full_multi(self):
+        self.sharedobject_test_template("hash_set_full_multi", 0, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true")
+
+    def test_SharedObject_hash_set_full_multi_conflict_init(self):
+        self.sharedobject_test_template("hash_set_full_multi_conflict_init", 1, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=conflicting_write:true")
+
+    def test_SharedObject_hash_set_full_multi_conflict_fe(self):
+        self.sharedobject_test_template("hash_set_full_multi_conflict_fe", 1, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=conflicting_write:true --param=verify_mode:FE")
+
+    def test_SharedObject_hash_set_full_multi_conflict_none(self):
+        self.sharedobject_test_template("hash_set_full_multi_conflict_none", 0, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=conflicting_write:true --param=verify_mode:NONE")
+
+    def test_SharedObject_hash_set_partial(self):
+        self.sharedobject_test_template("hash_set_partial", 0, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:false")
+
+    def test_SharedObject_hash_set_partial_nopub(self):
+        self.sharedobject_test_template("hash_set_partial_nopub", 0, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:false --param=publish:false")
+
+    def test_SharedObject_hash_set_partial_late(self):
+        self.sharedobject_test_template("hash_set_partial_late", 1, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:false --param=late_write:true")
+
+    def test_SharedObject_hash_set_partial_late_nopub(self):
+        self.sharedobject_test_template("hash_set_partial_late_nopub", 1, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:false --param=late_write:true --param=publish:false")
+
+    def test_SharedObject_hash_set_partial_doubleinit(self):
+        self.sharedobject_test_template("hash_set_partial_doubleinit", 1, "--param=object_type:hash_set --param=num_entities:12 --param=full_initialization:false --param=double_initialize:true")
+
+    def test_SharedObject_hash_set_late_initialize(self):
+        self.sharedobject_test_template("hash_set_late_initialize", 1, "--param=object_type:hash_set --param=num_entities:12 --param=late_initialize:true")
+
+
+    # Exchange Tests
+    # Changes are merged by recursive doubling.  With three ranks, one
+    # rank is above the largest power of two and folds into rank 0.
+
+    def test_SharedObject_array_partial_3ranks(self):
+        self.sharedobject_test_template("array_partial_3ranks", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:false", num_ranks=3)
+
+    def test_SharedObject_array_full_multi_3ranks(self):
+        self.sharedobject_test_template("array_full_multi_3ranks", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true", num_ranks=3)
+
+    # ID 0 and ID N-1 are on different ranks, so the init value writes
+    # are merged with the data writes
+    def test_SharedObject_array_full_multi_init_write_3ranks(self):
+        self.sharedobject_test_template("array_full_multi_init_write_3ranks", 0, "--param=object_type:array --param=num_entities:12 --param=full_initialization:true --param=multiple_initializers:true --param=init_write:true", num_ranks=3)
+
+    def test_SharedObject_map_partial_3ranks(self):
+        self.sharedobject_test_template("map_partial_3ranks", 0, "--param=object_type:map --param=num_entities:12 --param=full_initialization:false", num_ranks=3)
+
+    def test_SharedObject_set_partial_3ranks(self):
+        self.sharedobject_test_template("set_partial_3ranks", 0, "--param=object_type:set --param=num_entities:12 --param=full_initialization:false", num_ranks=3)
+
 #####
 
-    def sharedobject_test_template(self, testtype, exp_rc, options):
+    def sharedobject_test_template(self, testtype, exp_rc, options, sst_args = "", num_ranks = None):
+        if num_ranks is not None and not can_run_ranks(num_ranks):
+            self.skipTest("mpirun cannot launch {0} ranks on this host".format(num_ranks))
+
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
-        model_options = '--model-options="{0}"'.format(options)
+        model_options = '--model-options="{0}" {1}'.format(options, sst_args)
 
         # Set the various file paths
         sdlfile = "{0}/test_SharedObject.py".format(testsuitedir)
         #reffile = "{0}/sharedobject_tests/refFiles/test_{1}.out".format(testsuitedir, testtype)
         outfile = "{0}/test_SharedObject_{1}.out".format(outdir, testtype)
 
-        self.run_sst(sdlfile, outfile, other_args=model_options, expected_rc = exp_rc)
+        if num_ranks is None:
+            self.run_sst(sdlfile, outfile, other_args=model_options, expected_rc = exp_rc)
+        else:
+            self.run_sst(sdlfile, outfile, other_args=model_options, expected_rc = exp_rc,
+                         num_ranks=num_ranks, num_threads=1)
 
         # No need to perform test since we're just looking for it to
         # complete without an error
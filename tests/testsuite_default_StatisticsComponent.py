@@ -13,6 +13,9 @@
 
 import os
 import filecmp
+import glob
+import re
+import struct
 
 from sst_unittest import *
 from sst_unittest_support import *
@@ -23,6 +26,17 @@ from sst_unittest_support import *
 module_init = 0
 module_sema = threading.Semaphore()
 
+have_mpi = sst_core_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", default=0, disable_warning=True) == 1
+have_two_ranks = None
+
+def can_run_two_ranks():
+    """ Returns True if mpirun can launch two ranks on this host, which
+        the tests of the cross-rank reductions need """
+    global have_two_ranks
+    if have_two_ranks is None:
+        have_two_ranks = have_mpi and os_simple_command("mpirun -np 2 -map-by numa:PE=1 true")[0] == 0
+    return have_two_ranks
+
 def initializeTestModule_SingleInstance(class_inst):
     global module_init
     global module_sema
@@ -59,6 +73,268 @@ class testcase_StatisticComponent(SSTTestCase):
     def test_StatisticsBasic(self):
         self.Statistics_test_template("basic")
 
+    def test_StatisticsBinaryOutput(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_binary.py".format(testsuitedir)
+        csv_file = "{0}/test_StatisticsComponent_binary_stats.csv".format(outdir)
+        bin_file = "{0}/test_StatisticsComponent_binary_stats.bin".format(outdir)
+        outfile_csv = "{0}/test_StatisticsComponent_binary_csv.out".format(outdir)
+        outfile_bin = "{0}/test_StatisticsComponent_binary_bin.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile_csv, other_args='--model-options="csv {0}"'.format(csv_file))
+        self.run_sst(sdlfile, outfile_bin, other_args='--model-options="binary {0}"'.format(bin_file))
+
+        # The CSV output is the reference for the binary output.  Field
+        # registration order can differ between runs when using threads,
+        # so rows are compared by column name.  Unwritten fields are "0"
+        # in CSV and a zero value in binary, so compare numerically.
+        csv_rows = []
+        for filename in self._per_rank_files(csv_file):
+            with open(filename) as fp:
+                lines = fp.read().splitlines()
+            header = lines[0].split(", ")
+            csv_rows += [self._parse_stat_row(header, row) for row in lines[1:]]
+
+        # Decode the binary files with sst-stat-dump, which uses the
+        # C++ reader
+        bin_rows = []
+        for filename in self._per_rank_files(bin_file):
+            rtn, output = self._stat_dump(filename)
+            self.assertEqual(rtn, 0, "sst-stat-dump failed on {0}:\n{1}".format(filename, output))
+            lines = output.splitlines()
+            header = lines[0].split(", ")
+            bin_rows += [self._parse_stat_row(header, row) for row in lines[1:]]
+
+        self.assertTrue(len(csv_rows) > 0, "No statistics were written to {0}".format(csv_file))
+        self.assertEqual(sorted(csv_rows), sorted(bin_rows), "Decoded binary statistics do not match CSV output")
+
+        # The reader must reject damaged files instead of reading past
+        # the end of them
+        filename = self._per_rank_files(bin_file)[0]
+        with open(filename, "rb") as fp:
+            data = fp.read()
+        (footer,) = struct.unpack_from("=Q", data, len(data) - 16)
+        # The chunk index follows the statistic table in the footer
+        (num_stats,) = struct.unpack_from("=I", data, footer)
+        index = footer + 4
+        for _ in range(4 * num_stats):
+            index += 2 + struct.unpack_from("=H", data, index)[0]
+        damaged = {
+            "truncated" : data[:len(data) // 2],
+            "no_trailer" : data[:-16],
+            "footer_offset" : data[:-16] + struct.pack("=Q", len(data) * 2) + data[-8:],
+            "column_count" : data[:20] + struct.pack("=I", 0x7fffffff) + data[24:],
+            "chunk_count" : data[:index] + struct.pack("=Q", 1 << 60) + data[index + 8:],
+            "chunk_rows" : data[:-24] + struct.pack("=Q", 1 << 40) + data[-16:],
+        }
+        for name, contents in damaged.items():
+            damaged_file = "{0}/test_StatisticsComponent_binary_{1}.bin".format(outdir, name)
+            with open(damaged_file, "wb") as fp:
+                fp.write(contents)
+            rtn, output = self._stat_dump(damaged_file)
+            self.assertEqual(rtn, 1, "sst-stat-dump did not reject a file with a bad {0}".format(name))
+
+        rtn, output = self._stat_dump("--help")
+        self.assertEqual(rtn, 0, "sst-stat-dump --help failed:\n{0}".format(output))
+
+    def test_StatisticsReduceOutput(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_binary.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_StatisticsComponent_reduce.csv".format(testsuitedir)
+        reduce_file = "{0}/test_StatisticsComponent_reduce_global.csv".format(outdir)
+        outfile = "{0}/test_StatisticsComponent_reduce.out".format(outdir)
+
+        # Fields from different components are only ever merged when
+        # they are integers, so the result does not depend on the
+        # number of ranks or the order of the merges
+        num_ranks = 2 if can_run_two_ranks() else 1
+        self.run_sst(sdlfile, outfile, other_args='--model-options="reduce {0}"'.format(reduce_file),
+                     num_ranks=num_ranks, num_threads=1)
+
+        # Only rank 0 writes the reduced file
+        self.assertEqual(self._per_rank_files(reduce_file), [reduce_file], "Reduced output was written per rank")
+
+        cmp_result = testing_compare_diff("reduce", reduce_file, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(reduce_file, reffile))
+
+    def test_StatisticsQuantile(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_quantile.py".format(testsuitedir)
+        stat_file = "{0}/test_StatisticsComponent_quantile_stats.csv".format(outdir)
+        outfile = "{0}/test_StatisticsComponent_quantile.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args='--model-options="csv {0}"'.format(stat_file))
+
+        rows = self._read_stat_rows(stat_file)
+
+        for stat in ["stat1_U32", "stat3_I32"]:
+            quant = rows[("QuantComp", stat)]
+            values = self._histogram_values(rows[("HistComp", stat)])
+
+            self.assertEqual(int(quant["Count.u64"]), len(values), "Wrong count for {0}".format(stat))
+            self.assertEqual(float(quant["Min.{0}".format(stat[-3:].lower())]), values[0])
+            self.assertEqual(float(quant["Max.{0}".format(stat[-3:].lower())]), values[-1])
+
+            quantiles = [("p0", 0.0), ("p25", 0.25), ("p50", 0.5), ("p90", 0.9), ("p99", 0.99), ("p100", 1.0)]
+            self._check_quantiles(stat, quant, values, quantiles)
+
+            # With few buckets only the lowest values lose accuracy
+            if stat == "stat1_U32":
+                self._check_quantiles(stat, rows[("QuantSmallComp", stat)], values, quantiles[3:])
+
+    def test_StatisticsQuantileReduce(self):
+        if not can_run_two_ranks():
+            self.skipTest("mpirun cannot launch two ranks on this host")
+
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_quantile.py".format(testsuitedir)
+        csv_file = "{0}/test_StatisticsComponent_quantile_reduce_stats.csv".format(outdir)
+        reduce_file = "{0}/test_StatisticsComponent_quantile_reduce_global.csv".format(outdir)
+        outfile_csv = "{0}/test_StatisticsComponent_quantile_reduce_csv.out".format(outdir)
+        outfile_reduce = "{0}/test_StatisticsComponent_quantile_reduce.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile_csv, other_args='--model-options="csv {0}"'.format(csv_file))
+        self.run_sst(sdlfile, outfile_reduce, other_args='--model-options="reduce {0}"'.format(reduce_file),
+                     num_ranks=2, num_threads=1)
+
+        rows = self._read_stat_rows(csv_file)
+        reduced = self._read_stat_rows(reduce_file, key_columns=(1, 3))
+
+        # The two quantile statistics ran on different ranks with
+        # different values
+        stat = "stat1_U32"
+        merged = reduced[(stat, "Quantile")]
+        per_rank = [rows[("QuantComp", stat)], rows[("FewQuantComp", stat)]]
+        values = sorted(self._histogram_values(rows[("HistComp", stat)]) +
+                        self._histogram_values(rows[("FewHistComp", stat)]))
+        self.assertEqual(int(merged["Count.u64"]), len(values), "Wrong merged count for {0}".format(stat))
+
+        quantiles = [("p0", 0.0), ("p25", 0.25), ("p50", 0.5), ("p90", 0.9), ("p99", 0.99), ("p100", 1.0)]
+        self._check_quantiles(stat, merged, values, quantiles)
+
+        # Make sure the test can tell merged quantiles from the largest
+        # per-rank quantile
+        differ = False
+        for name, q in quantiles:
+            exact = values[int(q * (len(values) - 1))]
+            largest = max(float(row["{0}.f64".format(name)]) for row in per_rank)
+            if abs(largest - exact) > 0.02 * abs(exact) + 1e-6:
+                differ = True
+        self.assertTrue(differ, "The merged quantiles of {0} equal the largest per-rank quantiles".format(stat))
+
+    def test_StatisticsUniqueCountHLL(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_uniquecount.py".format(testsuitedir)
+        stat_file = "{0}/test_StatisticsComponent_uniquecount_stats.csv".format(outdir)
+        outfile = "{0}/test_StatisticsComponent_uniquecount.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args='--model-options="csv {0}"'.format(stat_file))
+
+        counts = self._read_unique_counts(stat_file)
+
+        # Precision 12 has a standard error of about 1.6%, allow 4 sigma
+        for stat in ["stat1_U32", "stat2_U64", "stat3_I32", "stat4_I64"]:
+            exact = counts[("ExactComp", stat)]
+            estimate = counts[("HLLComp", stat)]
+            self.assertTrue(exact > 0, "No unique values counted for {0}".format(stat))
+            self.assertTrue(abs(estimate - exact) <= 0.065 * exact,
+                            "{0}: estimate {1} is not close to exact count {2}".format(stat, estimate, exact))
+
+    def test_StatisticsUniqueCountReduce(self):
+        if not can_run_two_ranks():
+            self.skipTest("mpirun cannot launch two ranks on this host")
+
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_uniquecount.py".format(testsuitedir)
+        csv_file = "{0}/test_StatisticsComponent_uniquecount_reduce_stats.csv".format(outdir)
+        reduce_file = "{0}/test_StatisticsComponent_uniquecount_reduce_global.csv".format(outdir)
+        outfile_csv = "{0}/test_StatisticsComponent_uniquecount_reduce_csv.out".format(outdir)
+        outfile_reduce = "{0}/test_StatisticsComponent_uniquecount_reduce.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile_csv, other_args='--model-options="csv {0}"'.format(csv_file))
+        self.run_sst(sdlfile, outfile_reduce, other_args='--model-options="reduce {0}"'.format(reduce_file),
+                     num_ranks=2, num_threads=1)
+
+        counts = self._read_unique_counts(csv_file)
+        reduced = self._read_stat_rows(reduce_file, key_columns=(1, 3))
+
+        # The values on the two ranks overlap, so the merged count is
+        # the count of the larger component, not the sum of both
+        for stat in ["stat1_U32", "stat2_U64", "stat3_I32", "stat4_I64"]:
+            exact = counts[("ExactComp", stat)]
+            row = reduced[(stat, "UniqueCount")]
+            merged = int(row["UniqueItems.u64"])
+            self.assertEqual(int(row["NumMerged"]), 2, "{0} was not merged from both ranks".format(stat))
+            if stat in ["stat1_U32", "stat2_U64"]:
+                self.assertEqual(merged, exact, "{0}: merged count {1} is not {2}".format(stat, merged, exact))
+            else:
+                self.assertTrue(abs(merged - exact) <= 0.065 * exact,
+                                "{0}: merged estimate {1} is not close to exact count {2}".format(stat, merged, exact))
+
+    def _check_quantiles(self, stat, row, values, quantiles):
+        for name, q in quantiles:
+            exact = values[int(q * (len(values) - 1))]
+            estimate = float(row["{0}.f64".format(name)])
+            self.assertTrue(abs(estimate - exact) <= 0.01 * abs(exact) + 1e-6,
+                            "{0} {1}: estimate {2} is not within 1% of {3}".format(stat, name, estimate, exact))
+
+#####
+
+    def _read_stat_rows(self, filename, key_columns=(0, 1)):
+        """ Read the rows of a CSV statistic file, and its per-rank
+            files, into dicts of column name to value """
+        rows = {}
+        for filename in self._per_rank_files(filename):
+            with open(filename) as fp:
+                lines = fp.read().splitlines()
+            header = lines[0].split(", ")
+            for row in lines[1:]:
+                fields = row.split(", ")
+                rows[tuple(fields[i] for i in key_columns)] = dict(zip(header, fields))
+        return rows
+
+    def _read_unique_counts(self, filename):
+        """ Read the UniqueItems column of a CSV statistic file, keyed
+            by component and statistic name """
+        return {key : int(row["UniqueItems.u64"]) for key, row in self._read_stat_rows(filename).items()}
+
+    def _histogram_values(self, row):
+        """ Rebuild the values counted in the unit width bins of a histogram row """
+        values = []
+        for name, count in row.items():
+            match = re.match(r"Bin\d+:(-?\d+)-", name)
+            if match:
+                values += [int(match.group(1))] * int(float(count))
+        return sorted(values)
+
+    def _parse_stat_row(self, header, row):
+        fields = row.split(", ")
+        values = sorted((header[i], float(fields[i])) for i in range(4, len(fields)) if float(fields[i]) != 0.0)
+        return tuple(fields[0:4] + values)
+
+    def _per_rank_files(self, filename):
+        basename, extension = os.path.splitext(filename)
+        files = sorted(glob.glob("{0}_*{1}".format(basename, extension)))
+        if len(files) == 0:
+            files = [filename]
+        return files
+
+    def _stat_dump(self, filename):
+        sst_app_path = sstsimulator_conf_get_value_str('SSTCore', 'bindir', default="UNDEFINED")
+        return os_simple_command("{0}/sst-stat-dump {1}".format(sst_app_path, filename))
+
 #####
 
     def Statistics_test_template(self, testtype):
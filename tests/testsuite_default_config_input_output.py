@@ -11,6 +11,7 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import filecmp
 import os
 import sys
 
@@ -75,11 +76,74 @@ class testcase_Config_input_output(SSTTestCase):
     def test_json_io_parallel(self):
         self.configio_test_template("json_io_parallel", "6 6", "json", True, "MULTI")
 
+    # Large enough that each thread formats more than one block of
+    # elements.  The output must match the single thread output and
+    # be written back unchanged when it is reloaded.
+    def test_json_io_threads(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        json_single = "{0}/test_configio_json_io_threads_1.json".format(outdir)
+        json_multi = "{0}/test_configio_json_io_threads_2.json".format(outdir)
+        json_check = "{0}/test_configio_json_io_threads_check.json".format(outdir)
+        outfile = "{0}/test_configio_json_io_threads.out".format(outdir)
+
+        # A single thread run always uses the sst.single partitioner,
+        # so that program option is left out of the comparison
+        def read_json(path):
+            with open(path) as f:
+                return [line for line in f if "\"partitioner\":" not in line]
+
+        options = "--run-mode=init --output-json={0} --model-options=\"40 40\""
+        self.run_sst(sdlfile, outfile, num_ranks=1, num_threads=1, other_args=options.format(json_single))
+        self.run_sst(sdlfile, outfile, num_ranks=1, num_threads=2, other_args=options.format(json_multi))
+        self.assertTrue(read_json(json_single) == read_json(json_multi),
+                        "JSON file {0} does not match {1}".format(json_multi, json_single))
+
+        self.run_sst(json_multi, outfile, num_ranks=1, num_threads=2, check_sdl_file=False,
+                     other_args="--run-mode=init --output-json={0}".format(json_check))
+        self.assertTrue(filecmp.cmp(json_multi, json_check, shallow=False),
+                        "Reloaded JSON file {0} does not match {1}".format(json_check, json_multi))
+
+    # Components are built as they are read, so the parameter
+    # templates they refer to must come first
+    def test_json_section_order(self):
+        outdir = test_output_get_run_dir()
+
+        jsonfile = "{0}/test_configio_json_section_order.json".format(outdir)
+        outfile = "{0}/test_configio_json_section_order.out".format(outdir)
+        errfile = "{0}/test_configio_json_section_order.err".format(outdir)
+
+        with open(jsonfile, "w") as f:
+            f.write('{ "components": [ { "name": "c0", "type": "coreTestElement.coreTestComponent",\n'
+                    '                    "param_templates": [ 0 ] } ],\n'
+                    '  "param_templates": [ { "workPerCycle": "1000" } ],\n'
+                    '  "links": [] }\n')
+
+        self.run_sst(jsonfile, outfile, errfile, check_sdl_file=False, expected_rc=1)
+        with open(errfile) as f:
+            err = f.read()
+        self.assertTrue("\"param_templates\" section must come before the \"components\" section" in err,
+                        "Error file {0} does not report the section order".format(errfile))
+
+    # Binary graphs are reloaded on the same number of ranks, each
+    # reading its own section of the file
+    def test_binary_io(self):
+        self.configio_test_template("binary_io", "6 6", "sstgraph", False, "SINGLE")
+
+    def test_binary_io_comp(self):
+        self.configio_test_template("binary_io_comp", "", "sstgraph", False, "SINGLE", True)
+
 
     @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
     def test_python_single_parallel_load(self):
         self.configio_test_template("python_single_parallel_load", "6 6", "py", False, "SINGLE")
 
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_json_single_parallel_load(self):
+        self.configio_test_template("json_single_parallel_load", "6 6", "json", False, "SINGLE")
+
 
 #####
 
@@ -90,6 +154,7 @@ class testcase_Config_input_output(SSTTestCase):
         output_config = "{0}/test_configio_{1}.{2}".format(outdir,testtype,output_type)
         if ( output_type == "py" ): out_flag = "--output-config"
         elif ( output_type == "json"): out_flag = "--output-json"
+        elif ( output_type == "sstgraph"): out_flag = "--output-graph"
         else:
             print("Unknown output type: {0}".format(output_type))
             sys.exit(1)
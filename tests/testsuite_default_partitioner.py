@@ -63,8 +63,109 @@ class testcase_Partitioners(SSTTestCase):
     def test_simple(self):
         self.partitioner_test_template("simple", "6 6", "sst.simple")
 
+    def test_multilevel(self):
+        self.partitioner_test_template("multilevel", "6 6", "sst.multilevel")
+
+    def test_multilevel_cut(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Partition an 8x8 torus into 8 parts and compare the number of
+        # cut links against the partitioners that ignore the links
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        cuts = {}
+        for name in ["linear", "simple", "multilevel"]:
+            partfile = "{0}/test_partitioner_cut_{1}_partition.txt".format(outdir, name)
+            outfile = "{0}/test_partitioner_cut_{1}.out".format(outdir, name)
+            options = "--model-options=\"8 8\" --run-mode=init --partitioner=sst.{0} --output-partition={1}".format(
+                name, partfile)
+            if name == "multilevel":
+                options += " --verbose --partitioner-params=imbalance=0.05,coarsest_size=16"
+            self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=8)
+            cuts[name] = self._mesh_cut(partfile, 8, 8)
+
+        # The partitioner reports the same cut and stays within the
+        # requested imbalance
+        reported = None
+        with open(outfile) as fp:
+            for line in fp:
+                if "- Edge cut:" in line:
+                    fields = line.split()
+                    reported = int(fields[fields.index("cut:") + 1])
+                    imbalance = float(fields[-1])
+        self.assertEqual(reported, cuts["multilevel"], "Reported cut does not match the partition: {0}".format(cuts))
+        self.assertLessEqual(imbalance, 0.05, "Partition is out of balance: {0}".format(imbalance))
+
+        self.assertLess(cuts["multilevel"], cuts["linear"], "Cut is not better than linear: {0}".format(cuts))
+        self.assertLess(cuts["multilevel"], cuts["simple"], "Cut is not better than simple: {0}".format(cuts))
+
+    def test_geometric(self):
+        self.partitioner_test_template("geometric", "6 6", "sst.geometric")
+
+    def test_geometric_origin(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Partitioner_coordinates.py".format(testsuitedir)
+        partfile = "{0}/test_partitioner_geometric_origin_partition.txt".format(outdir)
+        outfile = "{0}/test_partitioner_geometric_origin.out".format(outdir)
+
+        # A component explicitly placed at (0,0,0) has coordinates
+        options = "--partitioner=sst.geometric --output-partition={0}".format(partfile)
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=2)
+
+        parts = {}
+        with open(partfile) as fp:
+            for line in fp:
+                if line.startswith("Rank:"):
+                    current = line.split()[1]
+                elif "(ID=" in line:
+                    parts[line.split()[0]] = current
+
+        self.assertEqual(parts["Left0"], parts["Left1"], "Left components were split: {0}".format(parts))
+        self.assertEqual(parts["Right"], parts["Origin"], "Origin was not placed by its coordinates: {0}".format(parts))
+        self.assertNotEqual(parts["Left0"], parts["Right"], "Components were not partitioned: {0}".format(parts))
+
+    def test_twolevel(self):
+        self.partitioner_test_template("twolevel", "6 6", "sst.multilevel --thread-partitioner=sst.linear")
+
+    def test_profiled(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Measure component and link costs in a serial run, then use
+        # them to partition the parallel run
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        costfile = "{0}/test_partitioner_costs_profiled.txt".format(outdir)
+        outfile = "{0}/test_partitioner_costs_profiled.out".format(outdir)
+        profile = "events:sst.profile.handler.event.cost[event];clocks:sst.profile.handler.clock.cost[clock]"
+        options = "--model-options=\"6 6\" --enable-profiling=\"{0}\" --profiling-output={1}".format(profile, costfile)
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=1)
+
+        self.partitioner_test_template("profiled", "6 6", "sst.profiled --partitioner-cost-file={0}".format(costfile))
+
 #####
 
+    # Count the links of an x_size by y_size test_MessageMesh torus that
+    # cross partitions, given an --output-partition file
+    def _mesh_cut(self, partfile, x_size, y_size):
+        parts = {}
+        with open(partfile) as fp:
+            for line in fp:
+                if line.startswith("Rank:"):
+                    current = line.split()[1]
+                elif "(ID=" in line:
+                    parts[line.split()[0]] = current
+
+        cut = 0
+        for i in range(x_size * y_size):
+            x = i % x_size
+            y = i // x_size
+            for j in [(x + 1) % x_size + y * x_size, x + ((y + 1) % y_size) * x_size]:
+                if parts["component{0}".format(i)] != parts["component{0}".format(j)]:
+                    cut += 1
+        return cut
+
     def partitioner_test_template(self, testtype, model_options, partitioner):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()